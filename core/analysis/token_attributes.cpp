@@ -23,6 +23,9 @@
 #include "shared.hpp"
 #include "token_attributes.hpp"
 #include "store/store_utils.hpp"
+#include "utils/math_utils.hpp"
+
+#include <array>
 
 namespace {
 
@@ -37,6 +40,17 @@ struct empty_position final : irs::position {
 empty_position NO_POSITION;
 const irs::document INVALID_DOCUMENT;
 
+// normalization factors indexed by quantized field length
+const auto QUANTIZED_NORMS = []() noexcept {
+  std::array<float_t, 256> norms;
+  norms[0] = irs::norm::DEFAULT(); // empty fields aren't normalized
+  for (size_t i = 1; i < norms.size(); ++i) {
+    const auto num_terms = irs::math::byte4_to_int(irs::byte_type(i));
+    norms[i] = 1.f / float_t(std::sqrt(double_t(num_terms)));
+  }
+  return norms;
+}();
+
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -62,13 +76,15 @@ REGISTER_ATTRIBUTE(norm);
 
 norm::norm() noexcept
   : payload_(nullptr),
-    doc_(&INVALID_DOCUMENT) {
+    doc_(&INVALID_DOCUMENT),
+    norms_(nullptr) {
 }
 
 void norm::clear() noexcept {
   column_it_.reset();
   payload_ = nullptr;
   doc_ = &INVALID_DOCUMENT;
+  norms_ = nullptr;
 }
 
 bool norm::empty() const noexcept {
@@ -76,6 +92,15 @@ bool norm::empty() const noexcept {
 }
 
 bool norm::reset(const sub_reader& reader, field_id column, const document& doc) {
+  norms_ = reader.norms(column);
+
+  if (norms_) {
+    column_it_.reset();
+    payload_ = nullptr;
+    doc_ = &doc;
+    return true;
+  }
+
   const auto* column_reader = reader.column_reader(column);
 
   if (!column_reader) {
@@ -96,6 +121,10 @@ bool norm::reset(const sub_reader& reader, field_id column, const document& doc)
 }
 
 float_t norm::read() const {
+  if (norms_) {
+    return quantized_norm::decode(norms_[doc_->value]);
+  }
+
   assert(column_it_);
   if (doc_->value != column_it_->seek(doc_->value)) {
     return DEFAULT();
@@ -106,6 +135,45 @@ float_t norm::read() const {
   return read_zvfloat(in);
 }
 
+byte_type norm::read_quantized() const {
+  return norms_
+    ? norms_[doc_->value]
+    : quantized_norm::encode(read());
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                    quantized_norm
+// -----------------------------------------------------------------------------
+
+REGISTER_ATTRIBUTE(quantized_norm);
+
+/*static*/ byte_type quantized_norm::encode(uint32_t num_terms) noexcept {
+  return math::int_to_byte4(num_terms);
+}
+
+/*static*/ byte_type quantized_norm::encode(float_t norm) noexcept {
+  // norm = 1/sqrt(num_terms)
+  if (norm <= 0.f || norm >= norm::DEFAULT()) {
+    return encode(1U);
+  }
+
+  const auto num_terms = std::round(1. / (double_t(norm) * norm));
+
+  return encode(num_terms < double_t(std::numeric_limits<uint32_t>::max())
+                  ? uint32_t(num_terms)
+                  : std::numeric_limits<uint32_t>::max());
+}
+
+/*static*/ float_t quantized_norm::decode(byte_type value) noexcept {
+  return QUANTIZED_NORMS[value];
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                    postings_block
+// -----------------------------------------------------------------------------
+
+REGISTER_ATTRIBUTE(postings_block);
+
 // -----------------------------------------------------------------------------
 // --SECTION--                                                          position
 // -----------------------------------------------------------------------------
@@ -128,6 +128,8 @@ struct IRESEARCH_API granularity_prefix final : attribute {
 /// @class norm
 /// @brief this marker attribute is only used in field::features in order to
 ///        allow evaluation of the field normalization factor 
+/// @note norms cached by a segment (see 'sub_reader::norms') are used instead
+///       of the column if available, values are quantized in that case
 //////////////////////////////////////////////////////////////////////////////
 struct IRESEARCH_API norm final : attribute {
   // DO NOT CHANGE NAME
@@ -147,17 +149,105 @@ struct IRESEARCH_API norm final : attribute {
   float_t read() const;
   bool empty() const noexcept;
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns quantized normalization factor of the current document
+  //////////////////////////////////////////////////////////////////////////////
+  byte_type read_quantized() const;
+
   void clear() noexcept;
 
  private:
   doc_iterator::ptr column_it_;
   const payload* payload_;
   const document* doc_;
+  const byte_type* norms_; // cached quantized norms indexed by document
 }; // norm
 
 static_assert(std::is_nothrow_move_constructible_v<norm>);
 static_assert(std::is_nothrow_move_assignable_v<norm>);
 
+//////////////////////////////////////////////////////////////////////////////
+/// @class quantized_norm
+/// @brief lossy 1-byte representation of the number of terms in a field
+///        within the current document, exposed by iterators capable of
+///        providing field normalization factor without accessing 'norm'
+///        column, e.g. over postings storing norms inline
+//////////////////////////////////////////////////////////////////////////////
+struct IRESEARCH_API quantized_norm final : attribute {
+  static constexpr string_ref type_name() noexcept {
+    return "iresearch::quantized_norm";
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns quantized representation of the specified field length
+  //////////////////////////////////////////////////////////////////////////////
+  static byte_type encode(uint32_t num_terms) noexcept;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns quantized representation of the specified normalization factor
+  //////////////////////////////////////////////////////////////////////////////
+  static byte_type encode(float_t norm) noexcept;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns normalization factor (same as 'norm::read()') corresponding
+  ///          to the specified quantized value
+  //////////////////////////////////////////////////////////////////////////////
+  static float_t decode(byte_type value) noexcept;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns normalization factor of the current document
+  //////////////////////////////////////////////////////////////////////////////
+  float_t read() const noexcept { return decode(value); }
+
+  byte_type value{ 1 }; // corresponds to 'norm::DEFAULT()'
+}; // quantized_norm
+
+//////////////////////////////////////////////////////////////////////////////
+/// @class postings_block
+/// @brief bulk access to documents following the current one, exposed by
+///        iterators over postings decoded a block at a time, lets consumers
+///        process (e.g. score) a whole block of documents in one go
+/// @note a block is bound to the iterator exposing it, so that iterators
+///       wrapping another one (e.g. filtering out documents) don't leak
+///       a block of the underlying postings by forwarding attributes
+//////////////////////////////////////////////////////////////////////////////
+class IRESEARCH_API postings_block : public attribute {
+ public:
+  static constexpr string_ref type_name() noexcept {
+    return "iresearch::postings_block";
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns block exposed by a specified iterator itself, nullptr if the
+  ///          iterator has no block or forwards one of an underlying iterator
+  //////////////////////////////////////////////////////////////////////////////
+  static postings_block* get(doc_iterator& it) noexcept {
+    auto* block = irs::get_mutable<postings_block>(&it);
+    return block && block->owner_ == &it ? block : nullptr;
+  }
+
+  explicit postings_block(const doc_iterator& owner) noexcept
+    : owner_(&owner) {
+  }
+
+  virtual ~postings_block() = default;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief fills 'docs', 'freqs' and 'norms' with documents following the
+  ///        current one up to the end of the decoded block (decoding the next
+  ///        block if necessary) and moves iterator to the last of them
+  /// @returns number of documents fetched, 0 if iterator is exhausted
+  //////////////////////////////////////////////////////////////////////////////
+  virtual size_t fetch() = 0;
+
+  const doc_id_t* docs{}; // document ids
+  const uint32_t* freqs{}; // term frequencies, nullptr if not available
+  const byte_type* norms{}; // quantized norms, nullptr if not available
+
+ private:
+  const doc_iterator* owner_; // iterator exposing the block
+}; // postings_block
+
 //////////////////////////////////////////////////////////////////////////////
 /// @class position 
 /// @brief iterator represents term positions in a document
@@ -298,6 +298,9 @@ struct IRESEARCH_API columnstore_reader {
     virtual ~column_reader() = default;
 
     // returns corresponding column reader
+    // @note a value returned by a reader is valid until the next call of the
+    //       same reader if blocks of the column may be evicted from an enabled
+    //       'column_cache', and as long as the column otherwise
     virtual columnstore_reader::values_reader_f values() const = 0;
 
     // returns the corresponding column iterator
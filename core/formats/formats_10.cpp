@@ -44,6 +44,7 @@
 #include "index/index_reader.hpp"
 #include "index/index_meta.hpp"
 
+#include "store/directory_attributes.hpp"
 #include "store/memory_directory.hpp"
 #include "store/store_utils.hpp"
 
@@ -208,7 +209,7 @@ inline void prepare_output(
   format_utils::write_header(*out, format, version);
 }
 
-inline void prepare_input(
+inline int32_t prepare_input(
     std::string& str,
     index_input::ptr& in,
     IOAdvice advice,
@@ -228,7 +229,7 @@ inline void prepare_input(
     ));
   }
 
-  format_utils::check_header(*in, format, min_ver, max_ver);
+  return format_utils::check_header(*in, format, min_ver, max_ver);
 }
 
 // ----------------------------------------------------------------------------
@@ -268,7 +269,19 @@ class postings_writer_base : public irs::postings_writer {
   static constexpr int32_t FORMAT_POSITIONS_ZEROBASED = FORMAT_SSE_POSITIONS_ONEBASED + 1;
   // positions are stored zero based, sse used
   static constexpr int32_t FORMAT_SSE_POSITIONS_ZEROBASED = FORMAT_POSITIONS_ZEROBASED + 1;
-  static constexpr int32_t FORMAT_MAX = FORMAT_SSE_POSITIONS_ZEROBASED;
+
+  // max term frequency is stored per skip entry and per term
+  // allowing to evaluate score upper bounds for blocks of postings
+  static constexpr int32_t FORMAT_BLOCK_MAX = FORMAT_SSE_POSITIONS_ZEROBASED + 1;
+  // max term frequency is stored per skip entry and per term, sse used
+  static constexpr int32_t FORMAT_SSE_BLOCK_MAX = FORMAT_BLOCK_MAX + 1;
+
+  // quantized normalization factor is stored along with the frequency
+  // of every document for fields having both frequencies and norms
+  static constexpr int32_t FORMAT_INLINE_NORMS = FORMAT_SSE_BLOCK_MAX + 1;
+  // quantized normalization factor is stored inline, sse used
+  static constexpr int32_t FORMAT_SSE_INLINE_NORMS = FORMAT_INLINE_NORMS + 1;
+  static constexpr int32_t FORMAT_MAX = FORMAT_SSE_INLINE_NORMS;
 
   static constexpr uint32_t MAX_SKIP_LEVELS = 10;
   static constexpr uint32_t BLOCK_SIZE = 128;
@@ -288,7 +301,9 @@ class postings_writer_base : public irs::postings_writer {
       postings_format_version_(postings_format_version),
       terms_format_version_(terms_format_version),
       pos_min_(postings_format_version_ >= FORMAT_POSITIONS_ZEROBASED ?   // first position offsets now is format dependent
-               pos_limits::invalid(): pos_limits::min()) {
+               pos_limits::invalid(): pos_limits::min()),
+      block_max_(postings_format_version_ >= FORMAT_BLOCK_MAX),
+      inline_norms_(postings_format_version_ >= FORMAT_INLINE_NORMS) {
     assert(postings_format_version >= FORMAT_MIN && postings_format_version <= FORMAT_MAX);
     assert(terms_format_version >= TERMS_FORMAT_MIN && terms_format_version <= TERMS_FORMAT_MAX);
   }
@@ -300,6 +315,7 @@ class postings_writer_base : public irs::postings_writer {
 
   virtual void begin_field(const irs::flags& field) final {
     features_ = ::features(field);
+    norms_ = inline_norms_ && features_.freq() && field.check<norm>();
     docs_.value.clear();
     last_state_.clear();
   }
@@ -347,27 +363,35 @@ class postings_writer_base : public irs::postings_writer {
       return delta == deltas;
     }
 
-    void push(doc_id_t doc, uint32_t freq) noexcept {
+    void push(doc_id_t doc, uint32_t freq, byte_type norm) noexcept {
       *this->delta++ = doc - last;
       *this->freq++ = freq;
+      *this->norm++ = norm;
       last = doc;
+      block_max_freq = std::max(block_max_freq, freq);
     }
 
     void reset() noexcept {
       stream::reset();
       delta = deltas;
       freq = freqs;
+      norm = norms;
       last = doc_limits::invalid();
       block_last = doc_limits::invalid();
+      block_max_freq = 0;
     }
 
     doc_id_t skip_doc[MAX_SKIP_LEVELS]{};
+    uint32_t skip_max_freq[MAX_SKIP_LEVELS]{}; // max frequency since the last skip entry
     doc_id_t deltas[BLOCK_SIZE]{}; // document deltas
     uint32_t freqs[BLOCK_SIZE]{};
+    byte_type norms[BLOCK_SIZE]{}; // quantized normalization factors
     doc_id_t* delta{ deltas };
     uint32_t* freq{ freqs };
+    byte_type* norm{ norms };
     doc_id_t last{ doc_limits::invalid() }; // last buffered document id
     doc_id_t block_last{ doc_limits::invalid() }; // last document id in a block
+    uint32_t block_max_freq{}; // max frequency within a block
   }; // doc_stream
 
   struct pos_stream : stream {
@@ -429,7 +453,7 @@ class postings_writer_base : public irs::postings_writer {
   void end_term(version10::term_meta& meta, const uint32_t* tfreq);
 
   template<typename FormatTraits>
-  void begin_doc(doc_id_t id, const frequency* freq);
+  void begin_doc(doc_id_t id, const frequency* freq, const quantized_norm* norm);
   template<typename FormatTraits>
   void add_position(uint32_t pos, const offset* offs, const payload* pay);
   void end_doc();
@@ -453,6 +477,9 @@ class postings_writer_base : public irs::postings_writer {
   const int32_t postings_format_version_;
   const int32_t terms_format_version_;
   uint32_t pos_min_; // initial base value for writing positions offsets
+  const bool block_max_; // store max term frequencies
+  const bool inline_norms_; // store normalization factors within postings
+  bool norms_{}; // current field stores normalization factors within postings
 };
 
 void postings_writer_base::prepare(index_output& out, const irs::flush_state& state) {
@@ -516,6 +543,15 @@ void postings_writer_base::encode(
   if (meta.freq != integer_traits<uint32_t>::const_max) {
     assert(meta.freq >= meta.docs_count);
     out.write_vint(meta.freq - meta.docs_count);
+
+    if (block_max_ && meta.docs_count > 1) {
+      assert(meta.max_freq <= meta.freq);
+      out.write_vint(meta.max_freq);
+    }
+
+    if (norms_ && 1 == meta.docs_count) {
+      out.write_byte(meta.e_single_norm);
+    }
   }
 
   out.write_vlong(meta.doc_start - last_state_.doc_start);
@@ -561,6 +597,11 @@ void postings_writer_base::write_skip(size_t level, index_output& out) {
   doc_.skip_doc[level] = doc_.block_last;
   doc_.skip_ptr[level] = doc_ptr;
 
+  if (block_max_ && features_.freq()) {
+    out.write_vint(doc_.skip_max_freq[level]);
+    doc_.skip_max_freq[level] = 0;
+  }
+
   if (features_.position()) {
     assert(pos_);
 
@@ -602,12 +643,23 @@ void postings_writer_base::begin_term() {
 
   doc_.last = doc_limits::min(); // for proper delta of 1st id
   doc_.block_last = doc_limits::invalid();
+  doc_.block_max_freq = 0;
+  std::fill_n(doc_.skip_max_freq, MAX_SKIP_LEVELS, 0);
   skip_.reset();
 }
 
 void postings_writer_base::end_doc() {
   if (doc_.full()) {
     doc_.block_last = doc_.last;
+
+    if (block_max_) {
+      // every skip level covers the block being finished
+      for (auto& max_freq : doc_.skip_max_freq) {
+        max_freq = std::max(max_freq, doc_.block_max_freq);
+      }
+      doc_.block_max_freq = 0;
+    }
+
     doc_.end = doc_out_->file_pointer();
     if (features_.position()) {
       assert(pos_ && pos_out_);
@@ -624,6 +676,7 @@ void postings_writer_base::end_doc() {
 
     doc_.delta = doc_.deltas;
     doc_.freq = doc_.freqs;
+    doc_.norm = doc_.norms;
   }
 }
 
@@ -634,6 +687,7 @@ void postings_writer_base::end_term(version10::term_meta& meta, const uint32_t*
 
   if (1 == meta.docs_count) {
     meta.e_single_doc = doc_.deltas[0];
+    meta.e_single_norm = doc_.norms[0];
   } else {
     // write remaining documents using
     // variable length encoding
@@ -642,6 +696,7 @@ void postings_writer_base::end_term(version10::term_meta& meta, const uint32_t*
 
     if (features_.freq()) {
       auto* doc_freq = doc_.freqs;
+      auto* doc_norm = doc_.norms;
       for (; doc_delta < doc_.delta; ++doc_delta) {
         const uint32_t freq = *doc_freq;
 
@@ -652,7 +707,12 @@ void postings_writer_base::end_term(version10::term_meta& meta, const uint32_t*
           out.write_vint(freq);
         }
 
+        if (norms_) {
+          out.write_byte(*doc_norm);
+        }
+
         ++doc_freq;
+        ++doc_norm;
       }
     } else {
       for (; doc_delta < doc_.delta; ++doc_delta) {
@@ -737,7 +797,9 @@ void postings_writer_base::end_term(version10::term_meta& meta, const uint32_t*
   docs_count_ = 0;
   doc_.delta = doc_.deltas;
   doc_.freq = doc_.freqs;
+  doc_.norm = doc_.norms;
   doc_.last = 0;
+  doc_.block_max_freq = 0;
   meta.doc_start = doc_.start;
 
   if (pos_) {
@@ -754,7 +816,10 @@ void postings_writer_base::end_term(version10::term_meta& meta, const uint32_t*
 }
 
 template<typename FormatTraits>
-void postings_writer_base::begin_doc(doc_id_t id, const frequency* freq) {
+void postings_writer_base::begin_doc(
+    doc_id_t id,
+    const frequency* freq,
+    const quantized_norm* norm) {
   if (doc_limits::valid(doc_.block_last) && doc_.empty()) {
     skip_.skip(docs_count_);
   }
@@ -766,13 +831,18 @@ void postings_writer_base::begin_doc(doc_id_t id, const frequency* freq) {
     ));
   }
 
-  doc_.push(id, freq ? freq->value : 0);
+  doc_.push(id, freq ? freq->value : 0,
+            norm ? norm->value : quantized_norm::encode(1U));
 
   if (doc_.full()) {
     FormatTraits::write_block(*doc_out_, doc_.deltas, buf_);
 
     if (freq) {
       FormatTraits::write_block(*doc_out_, doc_.freqs, buf_);
+
+      if (norms_) {
+        doc_out_->write_bytes(doc_.norms, BLOCK_SIZE);
+      }
     }
   }
   if (pos_) {
@@ -844,9 +914,14 @@ class postings_writer final: public postings_writer_base {
     pos_ = irs::position::empty();
     offs_ = nullptr;
     pay_ = nullptr;
+    norm_ = nullptr;
 
     freq_ = irs::get<frequency>(attrs);
     if (freq_) {
+      if (norms_) {
+        norm_ = irs::get<quantized_norm>(attrs);
+      }
+
       auto* pos = irs::get_mutable<irs::position>(&attrs);
       if (pos) {
         pos_ = pos;
@@ -857,6 +932,7 @@ class postings_writer final: public postings_writer_base {
   }
 
   const frequency* freq_{};
+  const quantized_norm* norm_{};
   irs::position* pos_{};
   const offset* offs_{};
   const payload* pay_{};
@@ -892,7 +968,7 @@ irs::postings_writer::state postings_writer<FormatTraits, VolatileAttributes>::w
     const auto did = docs.value();
     assert(doc_limits::valid(did));
 
-    begin_doc<FormatTraits>(did, freq_);
+    begin_doc<FormatTraits>(did, freq_, norm_);
     docs_.value.set(did);
 
     assert(pos_);
@@ -904,6 +980,7 @@ irs::postings_writer::state postings_writer<FormatTraits, VolatileAttributes>::w
     ++meta->docs_count;
     if (freq_) {
       meta->freq += freq_->value;
+      meta->max_freq = std::max(meta->max_freq, freq_->value);
     }
 
     end_doc();
@@ -927,6 +1004,7 @@ struct skip_state {
   size_t pend_pos{}; // positions to skip before new document block
   doc_id_t doc{ doc_limits::invalid() }; // last document in a previous block
   uint32_t pay_pos{}; // payload size to skip before in new document block
+  uint32_t max_freq{}; // max frequency within a skipped range
 }; // skip_state
 
 struct skip_context : skip_state {
@@ -1546,16 +1624,21 @@ struct position<IteratorTraits, false> : attribute {
 ///////////////////////////////////////////////////////////////////////////////
 template<typename IteratorTraits>
 class doc_iterator final
-    : public frozen_attributes<5, irs::doc_iterator> {
+    : public frozen_attributes<8, irs::doc_iterator> {
  public:
   doc_iterator() noexcept
     : attributes{{
         { type<document>::id(), &doc_ },
         { type<cost>::id(), &cost_    },
         { type<score>::id(), &scr_    },
-        { type<frequency>::id(),     IteratorTraits::frequency() ? &freq_ : nullptr  },
-        { type<irs::position>::id(), IteratorTraits::position()  ? &pos_  : nullptr  },
+        { type<frequency>::id(),      IteratorTraits::frequency() ? &freq_ : nullptr  },
+        { type<irs::position>::id(),  IteratorTraits::position()  ? &pos_  : nullptr  },
+        { type<irs::impact>::id(),    nullptr }, // set in 'prepare' if available
+        { type<quantized_norm>::id(), IteratorTraits::norm()      ? &norm_ : nullptr  },
+        { type<postings_block>::id(), IteratorTraits::position()  ? nullptr : &block_ },
       }},
+      impact_(*this),
+      block_(*this),
       skip_levels_(1),
       skip_(postings_writer_base::BLOCK_SIZE, postings_writer_base::SKIP_N) {
     assert(
@@ -1569,13 +1652,18 @@ class doc_iterator final
       const attribute_provider& attrs,
       const index_input* doc_in,
       [[maybe_unused]] const index_input* pos_in,
-      [[maybe_unused]] const index_input* pay_in) {
+      [[maybe_unused]] const index_input* pay_in,
+      bool block_max,
+      bool norms) {
     features_ = field; // set field features
+    block_max_ = block_max && features_.freq();
+    norms_ = norms && features_.freq();
 
     assert(!IteratorTraits::frequency() || IteratorTraits::frequency() == features_.freq());
     assert(!IteratorTraits::position() || IteratorTraits::position() == features_.position());
     assert(!IteratorTraits::offset() || IteratorTraits::offset() == features_.offset());
     assert(!IteratorTraits::payload() || IteratorTraits::payload() == features_.payload());
+    assert(!IteratorTraits::norm() || norms_);
 
     // add mandatory attributes
     begin_ = end_ = docs_;
@@ -1613,6 +1701,11 @@ class doc_iterator final
       assert(irs::get<frequency>(attrs));
       term_freq_ = irs::get<frequency>(attrs)->value;
 
+      if (block_max_) {
+        impact_.reset(1 == term_state_.docs_count ? term_freq_ : term_state_.max_freq);
+        *ref(type<irs::impact>::id()) = &impact_;
+      }
+
       if constexpr (IteratorTraits::position()) {
         doc_state state;
         state.pos_in = pos_in;
@@ -1638,6 +1731,7 @@ class doc_iterator final
     if (1 == term_state_.docs_count) {
       *docs_ = (doc_limits::min)() + term_state_.e_single_doc;
       *doc_freqs_ = term_freq_;
+      *doc_norms_ = term_state_.e_single_norm;
       doc_freq_ = doc_freqs_;
       ++end_;
     }
@@ -1672,6 +1766,9 @@ class doc_iterator final
             assert((doc_freq_ - 1) >= doc_freqs_ && (doc_freq_ - 1) < std::end(doc_freqs_));
             freq_.value = doc_freq_[-1];
           }
+          if constexpr (IteratorTraits::norm()) {
+            norm_.value = doc_norms_[relative_pos() - 1];
+          }
           return doc_.value;
         }
       } else {
@@ -1681,6 +1778,9 @@ class doc_iterator final
         pos_.notify(freq_.value);
 
         if (doc_.value >= target) {
+          if constexpr (IteratorTraits::norm()) {
+            norm_.value = doc_norms_[relative_pos() - 1];
+          }
           pos_.clear();
           return doc_.value;
         }
@@ -1723,6 +1823,10 @@ class doc_iterator final
     if constexpr (IteratorTraits::frequency()) {
       freq_.value = *doc_freq_++; // update frequency attribute
 
+      if constexpr (IteratorTraits::norm()) {
+        norm_.value = doc_norms_[relative_pos() - 1]; // update norm attribute
+      }
+
       if constexpr (IteratorTraits::position()) {
         pos_.notify(freq_.value);
         pos_.clear();
@@ -1739,7 +1843,101 @@ class doc_iterator final
 #endif
 
  private:
+  ////////////////////////////////////////////////////////////////////////////
+  /// @class impact
+  /// @brief frequency bounds backed by skip-list metadata
+  ////////////////////////////////////////////////////////////////////////////
+  class impact final : public irs::impact {
+   public:
+    explicit impact(doc_iterator& it) noexcept
+      : it_(&it) {
+    }
+
+    void reset(uint32_t max_freq) noexcept {
+      max_freq_ = block_max_freq_ = max_freq;
+    }
+
+    void block(uint32_t max_freq) noexcept {
+      block_max_freq_ = max_freq;
+    }
+
+    virtual doc_id_t shallow_seek(doc_id_t target) override {
+      return it_->shallow_seek(target);
+    }
+
+   private:
+    doc_iterator* it_;
+  }; // impact
+
+  ////////////////////////////////////////////////////////////////////////////
+  /// @class block
+  /// @brief bulk access to the decoded block of postings
+  ////////////////////////////////////////////////////////////////////////////
+  class block final : public postings_block {
+   public:
+    explicit block(doc_iterator& it) noexcept
+      : postings_block(it),
+        it_(&it) {
+    }
+
+    virtual size_t fetch() override {
+      return it_->fetch();
+    }
+
+   private:
+    doc_iterator* it_;
+  }; // block
+
   void seek_to_block(doc_id_t target);
+  void seek_skip(doc_id_t target);
+  doc_id_t shallow_seek(doc_id_t target);
+
+  size_t fetch() {
+    if constexpr (IteratorTraits::position()) {
+      // positions would have to be skipped document by document,
+      // 'postings_block' isn't exposed
+      assert(false);
+      return 0;
+    }
+
+    if (begin_ == end_) {
+      cur_pos_ += relative_pos();
+
+      if (cur_pos_ == term_state_.docs_count) {
+        doc_.value = doc_limits::eof();
+        begin_ = end_ = docs_; // seal the iterator
+        return 0;
+      }
+
+      refill();
+    }
+
+    // turn deltas of the remaining documents into document ids in-place,
+    // the buffer isn't read again until the next refill
+    const auto pos = relative_pos();
+    auto* docs = docs_ + pos;
+    for (auto doc = doc_.value; docs != end_; ++docs) {
+      *docs = (doc += *docs);
+    }
+
+    const size_t count = end_ - begin_;
+    block_.docs = begin_;
+    begin_ = end_;
+    doc_.value = end_[-1];
+
+    if constexpr (IteratorTraits::frequency()) {
+      block_.freqs = doc_freqs_ + pos;
+      doc_freq_ = doc_freqs_ + pos + count;
+      freq_.value = doc_freq_[-1];
+
+      if constexpr (IteratorTraits::norm()) {
+        block_.norms = doc_norms_ + pos;
+        norm_.value = block_.norms[count - 1];
+      }
+    }
+
+    return count;
+  }
 
   // returns current position in the document block 'docs_'
   size_t relative_pos() noexcept {
@@ -1751,6 +1949,10 @@ class doc_iterator final
     state.doc = in.read_vint();
     state.doc_ptr += in.read_vlong();
 
+    if (block_max_) {
+      state.max_freq = in.read_vint();
+    }
+
     if (features_.position()) {
       state.pend_pos = in.read_vint();
       state.pos_ptr += in.read_vlong();
@@ -1777,6 +1979,10 @@ class doc_iterator final
         } else {
           doc_freqs_[i] = doc_in_->read_vint();
         }
+
+        if (norms_) {
+          doc_norms_[i] = doc_in_->read_byte();
+        }
       }
     } else {
       for (size_t i = 0; i < size; ++i) {
@@ -1806,6 +2012,12 @@ class doc_iterator final
         IteratorTraits::skip_block(*doc_in_);
       }
 
+      if constexpr (IteratorTraits::norm()) {
+        doc_in_->read_bytes(doc_norms_, postings_writer_base::BLOCK_SIZE);
+      } else if (norms_) {
+        doc_in_->seek(doc_in_->file_pointer() + postings_writer_base::BLOCK_SIZE);
+      }
+
       end_ = docs_ + postings_writer_base::BLOCK_SIZE;
     } else {
       read_end_block(left);
@@ -1823,12 +2035,16 @@ class doc_iterator final
 
   irs::cost cost_;
   irs::score scr_;
+  impact impact_;
+  block block_;
   std::vector<skip_state> skip_levels_;
   skip_reader skip_;
-  skip_context* skip_ctx_; // pointer to used skip context, will be used by skip reader
+  skip_context skip_last_; // where the block containing the last skip target starts
+  size_t skipped_{}; // number of documents preceding 'skip_last_'
   uint32_t enc_buf_[postings_writer_base::BLOCK_SIZE]; // buffer for encoding
   doc_id_t docs_[postings_writer_base::BLOCK_SIZE]{ }; // doc values
   uint32_t doc_freqs_[postings_writer_base::BLOCK_SIZE]; // document frequencies
+  byte_type doc_norms_[postings_writer_base::BLOCK_SIZE]; // quantized document norms
   uint32_t cur_pos_{};
   const doc_id_t* begin_{docs_};
   doc_id_t* end_{docs_};
@@ -1836,82 +2052,116 @@ class doc_iterator final
   uint32_t term_freq_{}; // total term frequency
   document doc_;
   frequency freq_;
+  quantized_norm norm_;
   index_input::ptr doc_in_;
   version10::term_meta term_state_;
   features features_; // field features
   position<IteratorTraits> pos_;
+  bool block_max_{}; // skip-list stores max frequencies
+  bool norms_{}; // postings store normalization factors
 }; // doc_iterator
 
 template<typename IteratorTraits>
-void doc_iterator<IteratorTraits>::seek_to_block(doc_id_t target) {
-  // check whether it make sense to use skip-list
-  if (skip_levels_.front().doc < target && term_state_.docs_count > postings_writer_base::BLOCK_SIZE) {
-    skip_context last; // where block starts
-    skip_ctx_ = &last;
+void doc_iterator<IteratorTraits>::seek_skip(doc_id_t target) {
+  assert(term_state_.docs_count > postings_writer_base::BLOCK_SIZE);
 
-    // init skip writer in lazy fashion
-    if (!skip_) {
-      auto skip_in = doc_in_->dup();
+  // init skip writer in lazy fashion
+  if (!skip_) {
+    auto skip_in = doc_in_->dup();
 
-      if (!skip_in) {
-        IR_FRMT_ERROR("Failed to duplicate input in: %s", __FUNCTION__);
+    if (!skip_in) {
+      IR_FRMT_ERROR("Failed to duplicate input in: %s", __FUNCTION__);
 
-        throw io_error("Failed to duplicate document input");
-      }
+      throw io_error("Failed to duplicate document input");
+    }
 
-      skip_in->seek(term_state_.doc_start + term_state_.e_skip_start);
+    skip_in->seek(term_state_.doc_start + term_state_.e_skip_start);
 
-      skip_.prepare(
-        std::move(skip_in),
-        [this](size_t level, index_input& in) {
-          skip_state& last = *skip_ctx_;
-          auto& last_level = skip_ctx_->level;
-          auto& next = skip_levels_[level];
+    skip_.prepare(
+      std::move(skip_in),
+      [this](size_t level, index_input& in) {
+        skip_state& last = skip_last_;
+        auto& last_level = skip_last_.level;
+        auto& next = skip_levels_[level];
 
-          if (last_level > level) {
-            // move to the more granular level
-            next = last;
-          } else {
-            // store previous step on the same level
-            last = next;
-          }
+        if (last_level > level) {
+          // move to the more granular level
+          next = last;
+        } else {
+          // store previous step on the same level
+          last = next;
+        }
 
-          last_level = level;
+        last_level = level;
 
-          if (in.eof()) {
-            // stream exhausted
-            return (next.doc = doc_limits::eof());
-          }
+        if (in.eof()) {
+          // stream exhausted
+          return (next.doc = doc_limits::eof());
+        }
 
-          return read_skip(next, in);
-      });
+        return read_skip(next, in);
+    });
 
-      // initialize skip levels
-      const auto num_levels = skip_.num_levels();
-      if (num_levels) {
-        skip_levels_.resize(num_levels);
+    // initialize skip levels
+    const auto num_levels = skip_.num_levels();
+    if (num_levels) {
+      skip_levels_.resize(num_levels);
 
-        // since we store pointer deltas, add postings offset
-        auto& top = skip_levels_.back();
-        top.doc_ptr = term_state_.doc_start;
-        top.pos_ptr = term_state_.pos_start;
-        top.pay_ptr = term_state_.pay_start;
-      }
+      // since we store pointer deltas, add postings offset
+      auto& top = skip_levels_.back();
+      top.doc_ptr = term_state_.doc_start;
+      top.pos_ptr = term_state_.pos_start;
+      top.pay_ptr = term_state_.pay_start;
+    }
+  }
+
+  skipped_ = skip_.seek(target);
+}
+
+template<typename IteratorTraits>
+void doc_iterator<IteratorTraits>::seek_to_block(doc_id_t target) {
+  // check whether it make sense to use skip-list
+  if (term_state_.docs_count > postings_writer_base::BLOCK_SIZE) {
+    if (skip_levels_.front().doc < target) {
+      seek_skip(target);
     }
 
-    const size_t skipped = skip_.seek(target);
-    if (skipped > (cur_pos_ + relative_pos())) {
-      doc_in_->seek(last.doc_ptr);
-      doc_.value = last.doc;
-      cur_pos_ = skipped;
+    // skip-list might have been already moved by 'shallow_seek',
+    // jump unless the block start has been passed or overshoots the target
+    if (skipped_ > (cur_pos_ + relative_pos()) && skip_last_.doc < target) {
+      doc_in_->seek(skip_last_.doc_ptr);
+      doc_.value = skip_last_.doc;
+      cur_pos_ = skipped_;
       begin_ = end_ = docs_; // will trigger refill in "next"
       if constexpr (IteratorTraits::position()) {
-        pos_.prepare(last); // notify positions
+        pos_.prepare(skip_last_); // notify positions
       }
     }
   }
 }
 
+template<typename IteratorTraits>
+doc_id_t doc_iterator<IteratorTraits>::shallow_seek(doc_id_t target) {
+  assert(block_max_);
+
+  if (term_state_.docs_count > postings_writer_base::BLOCK_SIZE) {
+    if (skip_levels_.front().doc < target) {
+      seek_skip(target);
+    }
+
+    const auto& block = skip_levels_.front();
+
+    if (!doc_limits::eof(block.doc)) {
+      impact_.block(block.max_freq);
+      return block.doc;
+    }
+  }
+
+  // the last block isn't covered by skip-list
+  impact_.block(impact_.max_freq());
+  return doc_limits::eof();
+}
+
 // ----------------------------------------------------------------------------
 // --SECTION--                                                index_meta_writer
 // ----------------------------------------------------------------------------
@@ -3520,6 +3770,11 @@ class sparse_block : util::noncopyable {
     return visitor(begin->key, value);
   }
 
+  // memory occupied by a loaded block
+  size_t memory() const noexcept {
+    return sizeof(*this) + data_.capacity();
+  }
+
  private:
   // TODO: use single memory block for both index & data
 
@@ -3697,6 +3952,11 @@ class dense_block : util::noncopyable {
     return visitor(key, value);
   }
 
+  // memory occupied by a loaded block
+  size_t memory() const noexcept {
+    return sizeof(*this) + data_.capacity();
+  }
+
  private:
   // TODO: use single memory block for both index & data
 
@@ -3866,6 +4126,11 @@ class dense_fixed_offset_block : util::noncopyable {
     return visitor(key, value);
   }
 
+  // memory occupied by a loaded block
+  size_t memory() const noexcept {
+    return sizeof(*this) + data_.capacity();
+  }
+
  private:
   doc_id_t base_key_{}; // base key
   uint32_t base_offset_{}; // base offset
@@ -3978,6 +4243,11 @@ class sparse_mask_block : util::noncopyable {
     return true;
   }
 
+  // memory occupied by a loaded block
+  size_t memory() const noexcept {
+    return sizeof(*this);
+  }
+
  private:
   // all blocks except the tail one are going to be fully filled,
   // so we store keys in a fixed length array since we could
@@ -4093,6 +4363,11 @@ class dense_mask_block {
     return true;
   }
 
+  // memory occupied by a loaded block
+  size_t memory() const noexcept {
+    return sizeof(*this);
+  }
+
  private:
   doc_id_t min_;
   doc_id_t max_;
@@ -4180,35 +4455,84 @@ class context_provider: private util::noncopyable {
     : pool_(std::max(size_t(1), max_pool_size)) {
   }
 
-  void prepare(index_input::ptr&& stream, encryption::stream::ptr&& cipher) noexcept {
+  ~context_provider() {
+    if (cache_) {
+      try {
+        cache_->remove(cache_id_); // release memory occupied by our blocks
+      } catch (...) {
+        // blocks will be evicted eventually
+      }
+    }
+  }
+
+  void prepare(
+      index_input::ptr&& stream,
+      encryption::stream::ptr&& cipher,
+      const std::shared_ptr<column_cache>& cache) noexcept {
     assert(stream);
 
     stream_ = std::move(stream);
     cipher_ = std::move(cipher);
+    cache_ = cache ? cache : column_cache::global_ptr();
+    cache_id_ = cache_->register_owner();
   }
 
   bounded_object_pool<read_context_t>::ptr get_context() const {
     return pool_.emplace(*stream_, cipher_.get());
   }
 
+  // shared cache of loaded blocks, disabled if its memory limit is 0
+  column_cache* cache() const noexcept { return cache_.get(); }
+  uint64_t cache_id() const noexcept { return cache_id_; }
+
  private:
   mutable bounded_object_pool<read_context_t> pool_;
   encryption::stream::ptr cipher_;
   index_input::ptr stream_;
+  std::shared_ptr<column_cache> cache_; // cache from directory attributes
+                                        // or the global one
+  uint64_t cache_id_{}; // identifies our blocks in 'cache_'
 }; // context_provider
 
-// in case of success caches block pointed
-// instance, nullptr otherwise
+// a reference to a block loaded into a shared cache, keeps
+// the block alive even if it's already evicted from the cache
+typedef column_cache::value_type block_pin;
+
+// caches block pointed by 'ref' either in the shared column
+// cache (if enabled) and pins it by 'pin' or forever in 'ref'
 template<typename BlockRef>
 const typename BlockRef::block_t& load_block(
     const context_provider& ctxs,
     compression::decompressor* decomp,
     bool decrypt,
-    BlockRef& ref) {
+    BlockRef& ref,
+    block_pin& pin) {
   typedef typename BlockRef::block_t block_t;
 
   const auto* cached = ref.pblock.load();
 
+  if (!cached && ctxs.cache()->max_memory()) {
+    auto& cache = *ctxs.cache();
+
+    pin = cache.get(ctxs.cache_id(), ref.offset);
+
+    if (!pin) {
+      auto block = memory::make_shared<block_t>();
+
+      {
+        auto ctx = ctxs.get_context();
+        assert(ctx);
+        ctx->load(*block, decomp, decrypt, ref.offset);
+      }
+
+      const size_t size = block->memory();
+      pin = block;
+      cache.put(ctxs.cache_id(), ref.offset, std::move(block), size);
+    }
+
+    return *static_cast<const block_t*>(pin.get());
+  }
+
   if (!cached) {
     auto ctx = ctxs.get_context();
     assert(ctx);
@@ -4375,11 +4699,14 @@ class column_iterator final
     }
 
     try {
-      const auto& cached = load_block(*column_->ctxs_, column_->decompressor(), column_->encrypted(), *begin_);
+      block_pin pin; // previous block must stay alive until comparison below
+      const auto& cached = load_block(*column_->ctxs_, column_->decompressor(), column_->encrypted(), *begin_, pin);
 
       if (block_ != cached) {
         block_.reset(cached, payload_);
       }
+
+      pin_ = std::move(pin);
     } catch (...) {
       // unable to load block, seal the iterator
       block_.seal();
@@ -4396,6 +4723,7 @@ class column_iterator final
   }
 
   block_iterator_t block_;
+  block_pin pin_; // keeps current block alive while it's in use
   irs::payload payload_;
   irs::document doc_;
   irs::cost cost_;
@@ -4416,8 +4744,8 @@ if (column.empty()) {
     return columnstore_reader::empty_reader();
   }
 
-  return [&column](doc_id_t key, bytes_ref& value) {
-    return column.value(key, value);
+  return [&column, pin = block_pin()](doc_id_t key, bytes_ref& value) mutable {
+    return column.value(key, value, pin); // 'value' is valid until next call
   };
 }
 
@@ -4495,7 +4823,7 @@ class sparse_column final : public column {
     refs_ = std::move(refs);
   }
 
-  bool value(doc_id_t key, bytes_ref& value) const {
+  bool value(doc_id_t key, bytes_ref& value, block_pin& pin) const {
     // find the right block
     const auto rbegin = refs_.rbegin(); // upper bound
     const auto rend = refs_.rend();
@@ -4509,7 +4837,7 @@ class sparse_column final : public column {
       return false;
     }
 
-    const auto& cached = load_block(*ctxs_, decompressor(), encrypted(), *it);
+    const auto& cached = load_block(*ctxs_, decompressor(), encrypted(), *it, pin);
 
     return cached.value(key, value);
   }
@@ -4679,7 +5007,7 @@ class dense_fixed_offset_column final : public column {
     min_ = this->max() - this->count() + 1;
   }
 
-  bool value(doc_id_t key, bytes_ref& value) const {
+  bool value(doc_id_t key, bytes_ref& value, block_pin& pin) const {
     const auto base_key = key - min_;
 
     if (base_key >= this->count()) {
@@ -4691,7 +5019,7 @@ class dense_fixed_offset_column final : public column {
 
     auto& ref = const_cast<block_ref&>(refs_[block_idx]);
 
-    const auto& cached = load_block(*ctxs_, decompressor(), encrypted(), ref);
+    const auto& cached = load_block(*ctxs_, decompressor(), encrypted(), ref, pin);
 
     return cached.value(key, value);
   }
@@ -4842,7 +5170,7 @@ class dense_fixed_offset_column<dense_mask_block> final : public column {
     min_ = this->max() - this->count();
   }
 
-  bool value(doc_id_t key, bytes_ref& value) const noexcept {
+  bool value(doc_id_t key, bytes_ref& value, block_pin& /*pin*/) const noexcept {
     value = bytes_ref::NIL;
     return key > min_ && key <= this->max();
   }
@@ -5112,7 +5440,10 @@ bool reader::prepare(const directory& dir, const segment_meta& meta) {
   }
 
   // noexcept
-  context_provider::prepare(std::move(stream), std::move(cipher));
+  context_provider::prepare(
+    std::move(stream),
+    std::move(cipher),
+    dir.attributes().get<column_cache>());
   columns_ = std::move(columns);
 
   return true;
@@ -5147,6 +5478,8 @@ class postings_reader_base : public irs::postings_reader {
   index_input::ptr doc_in_;
   index_input::ptr pos_in_;
   index_input::ptr pay_in_;
+  bool block_max_{}; // postings store max term frequencies
+  bool inline_norms_{}; // postings store normalization factors
 }; // postings_reader
 
 void postings_reader_base::prepare(
@@ -5156,7 +5489,7 @@ void postings_reader_base::prepare(
   std::string buf;
 
   // prepare document input
-  prepare_input(
+  const auto version = prepare_input(
     buf, doc_in_, irs::IOAdvice::RANDOM, state,
     postings_writer_base::DOC_EXT,
     postings_writer_base::DOC_FORMAT_NAME,
@@ -5164,6 +5497,9 @@ void postings_reader_base::prepare(
     postings_writer_base::FORMAT_MAX
   );
 
+  block_max_ = version >= postings_writer_base::FORMAT_BLOCK_MAX;
+  inline_norms_ = version >= postings_writer_base::FORMAT_INLINE_NORMS;
+
   // Since terms doc postings too large
   //  it is too costly to verify checksum of
   //  the entire file. Here we perform cheap
@@ -5241,6 +5577,16 @@ size_t postings_reader_base::decode(
   term_meta.docs_count = vread<uint32_t>(p);
   if (term_freq) {
     term_freq->value = term_meta.docs_count + vread<uint32_t>(p);
+
+    if (block_max_) {
+      term_meta.max_freq = term_meta.docs_count > 1
+        ? vread<uint32_t>(p)
+        : term_freq->value;
+    }
+
+    if (inline_norms_ && 1 == term_meta.docs_count && meta.check<norm>()) {
+      term_meta.e_single_norm = *p++;
+    }
   }
 
   term_meta.doc_start += vread<uint64_t>(p);
@@ -5267,12 +5613,13 @@ size_t postings_reader_base::decode(
 template<typename FormatTraits, bool OneBasedPositionStorage>
 class postings_reader final: public postings_reader_base {
  public:
-  template<bool Freq, bool Pos, bool Offset, bool Payload>
+  template<bool Freq, bool Pos, bool Offset, bool Payload, bool Norm = false>
   struct iterator_traits : FormatTraits {
     static constexpr bool frequency() { return Freq; }
     static constexpr bool position() { return Freq && Pos; }
     static constexpr bool offset() { return position() && Offset; }
     static constexpr bool payload() { return position() && Payload; }
+    static constexpr bool norm() { return Freq && Norm; }
     static constexpr bool one_based_position_storage() { return OneBasedPositionStorage; }
   };
 
@@ -5285,12 +5632,21 @@ class postings_reader final: public postings_reader_base {
   template<typename IteratorTraits>
   irs::doc_iterator::ptr iterator(
       const attribute_provider& attrs,
-      const ::features& features) {
+      const ::features& features,
+      bool norms) {
     auto it = memory::make_managed<doc_iterator<IteratorTraits>>();
-    it->prepare(features, attrs, doc_in_.get(), pos_in_.get(), pay_in_.get());
+    it->prepare(features, attrs, doc_in_.get(), pos_in_.get(), pay_in_.get(),
+                block_max_, norms);
 
     return it;
   }
+
+  template<bool Norm>
+  irs::doc_iterator::ptr iterator(
+    const attribute_provider& attrs,
+    const ::features& features,
+    ::features enabled,
+    bool norms);
 }; // postings_reader
 
 #if defined(_MSC_VER)
@@ -5310,25 +5666,41 @@ irs::doc_iterator::ptr postings_reader<FormatTraits, OneBasedPositionStorage>::i
   // get enabled features:
   // find intersection between requested and available features
   const auto enabled = features & req;
+  // postings store normalization factors
+  const bool norms = inline_norms_ && features.freq() && field.check<norm>();
+
+  if (norms && enabled.freq() && req.check<norm>()) {
+    return iterator<true>(attrs, features, enabled, norms);
+  }
+
+  return iterator<false>(attrs, features, enabled, norms);
+}
 
+template<typename FormatTraits, bool OneBasedPositionStorage>
+template<bool Norm>
+irs::doc_iterator::ptr postings_reader<FormatTraits, OneBasedPositionStorage>::iterator(
+    const attribute_provider& attrs,
+    const ::features& features,
+    ::features enabled,
+    bool norms) {
   switch (enabled) {
     case features::FREQ | features::POS | features::OFFS | features::PAY: {
-      return iterator<iterator_traits<true, true, true, true>>(attrs, features);
+      return iterator<iterator_traits<true, true, true, true, Norm>>(attrs, features, norms);
     }
     case features::FREQ | features::POS | features::OFFS: {
-      return iterator<iterator_traits<true, true, true, false>>(attrs, features);
+      return iterator<iterator_traits<true, true, true, false, Norm>>(attrs, features, norms);
     }
     case features::FREQ | features::POS | features::PAY: {
-      return iterator<iterator_traits<true, true, false, true>>(attrs, features);
+      return iterator<iterator_traits<true, true, false, true, Norm>>(attrs, features, norms);
     }
     case features::FREQ | features::POS: {
-      return iterator<iterator_traits<true, true, false, false>>(attrs, features);
+      return iterator<iterator_traits<true, true, false, false, Norm>>(attrs, features, norms);
     }
     case features::FREQ: {
-      return iterator<iterator_traits<true, false, false, false>>(attrs, features);
+      return iterator<iterator_traits<true, false, false, false, Norm>>(attrs, features, norms);
     }
     default: {
-      return iterator<iterator_traits<false, false, false, false>>(attrs, features);
+      return iterator<iterator_traits<false, false, false, false>>(attrs, features, norms);
     }
   }
 
@@ -5647,7 +6019,7 @@ const ::format14 FORMAT14_INSTANCE;
 
 irs::field_writer::ptr format14::get_field_writer(bool volatile_state) const {
   return burst_trie::make_writer(
-    burst_trie::Version::MAX,
+    burst_trie::Version::IMMUTABLE_FST_MIN,
     get_postings_writer(volatile_state),
     volatile_state);
 }
@@ -5659,6 +6031,91 @@ irs::field_writer::ptr format14::get_field_writer(bool volatile_state) const {
 
 REGISTER_FORMAT_MODULE(::format14, MODULE_NAME);
 
+// ----------------------------------------------------------------------------
+// --SECTION--                                                         format15
+// ----------------------------------------------------------------------------
+
+class format15 : public format14 {
+ public:
+  static constexpr string_ref type_name() noexcept {
+    return "1_5";
+  }
+
+  DECLARE_FACTORY();
+
+  format15() noexcept : format14(irs::type<format15>::get()) { }
+
+  virtual irs::postings_writer::ptr get_postings_writer(bool volatile_state) const override;
+
+ protected:
+  explicit format15(const irs::type_info& type) noexcept
+    : format14(type) {
+  }
+};
+
+const ::format15 FORMAT15_INSTANCE;
+
+irs::postings_writer::ptr format15::get_postings_writer(bool volatile_state) const {
+  constexpr const auto VERSION = postings_writer_base::FORMAT_BLOCK_MAX;
+
+  if (volatile_state) {
+    return memory::make_unique<::postings_writer<format_traits, true>>(VERSION);
+  }
+
+  return memory::make_unique<::postings_writer<format_traits, false>>(VERSION);
+}
+
+/*static*/ irs::format::ptr format15::make() {
+  // aliasing constructor
+  return irs::format::ptr(irs::format::ptr(), &FORMAT15_INSTANCE);
+}
+
+REGISTER_FORMAT_MODULE(::format15, MODULE_NAME);
+
+// ----------------------------------------------------------------------------
+// --SECTION--                                                         format16
+// ----------------------------------------------------------------------------
+
+class format16 final : public format15 {
+ public:
+  static constexpr string_ref type_name() noexcept {
+    return "1_6";
+  }
+
+  DECLARE_FACTORY();
+
+  format16() noexcept : format15(irs::type<format16>::get()) { }
+
+  virtual irs::field_writer::ptr get_field_writer(bool volatile_state) const override;
+  virtual irs::postings_writer::ptr get_postings_writer(bool volatile_state) const override;
+}; // format16
+
+const ::format16 FORMAT16_INSTANCE;
+
+irs::field_writer::ptr format16::get_field_writer(bool volatile_state) const {
+  return burst_trie::make_writer(
+    burst_trie::Version::FST_SIZE_MIN,
+    get_postings_writer(volatile_state),
+    volatile_state);
+}
+
+irs::postings_writer::ptr format16::get_postings_writer(bool volatile_state) const {
+  constexpr const auto VERSION = postings_writer_base::FORMAT_INLINE_NORMS;
+
+  if (volatile_state) {
+    return memory::make_unique<::postings_writer<format_traits, true>>(VERSION);
+  }
+
+  return memory::make_unique<::postings_writer<format_traits, false>>(VERSION);
+}
+
+/*static*/ irs::format::ptr format16::make() {
+  // aliasing constructor
+  return irs::format::ptr(irs::format::ptr(), &FORMAT16_INSTANCE);
+}
+
+REGISTER_FORMAT_MODULE(::format16, MODULE_NAME);
+
 // ----------------------------------------------------------------------------
 // --SECTION--                                                      format12sse
 // ----------------------------------------------------------------------------
@@ -5793,7 +6250,7 @@ const ::format14 FORMAT14SIMD_INSTANCE;
 
 irs::field_writer::ptr format14simd::get_field_writer(bool volatile_state) const {
   return burst_trie::make_writer(
-    burst_trie::Version::MAX,
+    burst_trie::Version::IMMUTABLE_FST_MIN,
     get_postings_writer(volatile_state),
     volatile_state);
 }
@@ -5805,6 +6262,91 @@ irs::field_writer::ptr format14simd::get_field_writer(bool volatile_state) const
 
 REGISTER_FORMAT_MODULE(::format14simd, MODULE_NAME);
 
+// ----------------------------------------------------------------------------
+// --SECTION--                                                      format15sse
+// ----------------------------------------------------------------------------
+
+class format15simd : public format14simd {
+ public:
+  static constexpr string_ref type_name() noexcept {
+    return "1_5simd";
+  }
+
+  DECLARE_FACTORY();
+
+  format15simd() noexcept : format14simd(irs::type<format15simd>::get()) { }
+
+  virtual irs::postings_writer::ptr get_postings_writer(bool volatile_state) const override;
+
+ protected:
+  explicit format15simd(const irs::type_info& type) noexcept
+    : format14simd(type) {
+  }
+}; // format15simd
+
+const ::format15simd FORMAT15SIMD_INSTANCE;
+
+irs::postings_writer::ptr format15simd::get_postings_writer(bool volatile_state) const {
+  constexpr const auto VERSION = postings_writer_base::FORMAT_SSE_BLOCK_MAX;
+
+  if (volatile_state) {
+    return memory::make_unique<::postings_writer<format_traits_simd, true>>(VERSION);
+  }
+
+  return memory::make_unique<::postings_writer<format_traits_simd, false>>(VERSION);
+}
+
+/*static*/ irs::format::ptr format15simd::make() {
+  // aliasing constructor
+  return irs::format::ptr(irs::format::ptr(), &FORMAT15SIMD_INSTANCE);
+}
+
+REGISTER_FORMAT_MODULE(::format15simd, MODULE_NAME);
+
+// ----------------------------------------------------------------------------
+// --SECTION--                                                      format16sse
+// ----------------------------------------------------------------------------
+
+class format16simd final : public format15simd {
+ public:
+  static constexpr string_ref type_name() noexcept {
+    return "1_6simd";
+  }
+
+  DECLARE_FACTORY();
+
+  format16simd() noexcept : format15simd(irs::type<format16simd>::get()) { }
+
+  virtual irs::field_writer::ptr get_field_writer(bool volatile_state) const override;
+  virtual irs::postings_writer::ptr get_postings_writer(bool volatile_state) const override;
+}; // format16simd
+
+const ::format16simd FORMAT16SIMD_INSTANCE;
+
+irs::field_writer::ptr format16simd::get_field_writer(bool volatile_state) const {
+  return burst_trie::make_writer(
+    burst_trie::Version::FST_SIZE_MIN,
+    get_postings_writer(volatile_state),
+    volatile_state);
+}
+
+irs::postings_writer::ptr format16simd::get_postings_writer(bool volatile_state) const {
+  constexpr const auto VERSION = postings_writer_base::FORMAT_SSE_INLINE_NORMS;
+
+  if (volatile_state) {
+    return memory::make_unique<::postings_writer<format_traits_simd, true>>(VERSION);
+  }
+
+  return memory::make_unique<::postings_writer<format_traits_simd, false>>(VERSION);
+}
+
+/*static*/ irs::format::ptr format16simd::make() {
+  // aliasing constructor
+  return irs::format::ptr(irs::format::ptr(), &FORMAT16SIMD_INSTANCE);
+}
+
+REGISTER_FORMAT_MODULE(::format16simd, MODULE_NAME);
+
 #endif // IRESEARCH_SSE2
 
 }
@@ -5819,10 +6361,14 @@ void init() {
   REGISTER_FORMAT(::format12);
   REGISTER_FORMAT(::format13);
   REGISTER_FORMAT(::format14);
+  REGISTER_FORMAT(::format15);
+  REGISTER_FORMAT(::format16);
 #ifdef IRESEARCH_SSE2
   REGISTER_FORMAT(::format12simd);
   REGISTER_FORMAT(::format13simd);
   REGISTER_FORMAT(::format14simd);
+  REGISTER_FORMAT(::format15simd);
+  REGISTER_FORMAT(::format16simd);
 #endif // IRESEARCH_SSE2
 #endif // IRESEARCH_DLL
 }
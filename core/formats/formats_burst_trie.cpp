@@ -86,6 +86,8 @@
 #include "utils/timer_utils.hpp"
 #include "utils/bit_utils.hpp"
 #include "utils/bitset.hpp"
+#include "utils/bkd_tree.hpp"
+#include "utils/bloom_filter.hpp"
 #include "utils/frozen_attributes.hpp"
 #include "utils/string.hpp"
 #include "utils/log.hpp"
@@ -560,6 +562,48 @@ void merge_blocks(std::list<entry>& blocks) {
   );
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @class recording_doc_iterator
+/// @brief collects documents of the wrapped iterator as they are visited
+///////////////////////////////////////////////////////////////////////////////
+class recording_doc_iterator final : public doc_iterator {
+ public:
+  recording_doc_iterator(doc_iterator& it, std::vector<doc_id_t>& docs) noexcept
+    : it_(&it), docs_(&docs) {
+  }
+
+  virtual attribute* get_mutable(irs::type_info::type_id type) override {
+    return it_->get_mutable(type);
+  }
+
+  virtual doc_id_t value() const override {
+    return it_->value();
+  }
+
+  virtual bool next() override {
+    if (!it_->next()) {
+      return false;
+    }
+
+    docs_->emplace_back(it_->value());
+    return true;
+  }
+
+  virtual doc_id_t seek(doc_id_t target) override {
+    const auto doc = it_->seek(target);
+
+    if (!doc_limits::eof(doc) && (docs_->empty() || docs_->back() != doc)) {
+      docs_->emplace_back(doc);
+    }
+
+    return doc;
+  }
+
+ private:
+  doc_iterator* it_;
+  std::vector<doc_id_t>* docs_;
+}; // recording_doc_iterator
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @class fst_buffer
 /// @brief resetable FST buffer
@@ -613,6 +657,8 @@ class field_writer final : public irs::field_writer {
   static constexpr string_ref TERMS_EXT = "tm";
   static constexpr string_ref FORMAT_TERMS_INDEX = "block_tree_terms_index";
   static constexpr string_ref TERMS_INDEX_EXT = "ti";
+  static constexpr string_ref FORMAT_POINTS = "block_tree_points";
+  static constexpr string_ref POINTS_EXT = "pt";
 
   field_writer(
     irs::postings_writer::ptr&& pw,
@@ -642,6 +688,14 @@ class field_writer final : public irs::field_writer {
 
   void begin_field(const irs::flags& field);
 
+  // add a point of a field to a bkd tree, points stay terms of the field as
+  // well since a tree only answers range queries over whole points, while
+  // other filters, term statistics and segment merges rely on terms
+  void push_point(
+    const std::string& name,
+    const bytes_ref& term,
+    const std::vector<doc_id_t>& docs);
+
   void end_field(
     const std::string& name,
     irs::field_id norm,
@@ -678,11 +732,16 @@ class field_writer final : public irs::field_writer {
   index_output::ptr terms_out_; // output stream for terms
   encryption::stream::ptr index_out_cipher_;
   index_output::ptr index_out_; // output stream for indexes
+  encryption::stream::ptr points_out_cipher_;
+  index_output::ptr points_out_; // output stream for leaves of bkd trees (optional)
   postings_writer::ptr pw_; // postings writer
   std::vector<entry> stack_;
   fst_buffer* fst_buf_; // pimpl buffer used for building FST for fields
   volatile_byte_ref last_term_; // last pushed term
   std::vector<size_t> prefixes_;
+  std::vector<uint64_t> bloom_hashes_; // hashes of terms of a current field
+  bloom_filter bloom_; // bloom filter of a current field
+  bkd_tree::writer points_; // bkd trees of a current field
   std::pair<bool, volatile_byte_ref> min_term_; // current min term in a block
   volatile_byte_ref max_term_; // current max term in a block
   uint64_t term_count_; // count of terms
@@ -991,6 +1050,31 @@ void field_writer::prepare(const irs::flush_state& state) {
 
   write_segment_features(*index_out_, *state.features);
 
+  // prepare leaves of bkd trees
+  points_out_cipher_.reset();
+
+  if (version_ >= burst_trie::Version::POINTS_MIN
+      && state.features->check<bkd_tree>()) {
+    prepare_output(filename, points_out_, state,
+                   POINTS_EXT, FORMAT_POINTS,
+                   static_cast<int32_t>(version_));
+
+    // encrypt leaves of bkd trees
+    if (irs::encrypt(filename, *points_out_, enc, enc_header, points_out_cipher_)) {
+      assert(points_out_cipher_ && points_out_cipher_->block_size());
+
+      const auto blocks_in_buffer = math::div_ceil64(
+        buffered_index_output::DEFAULT_BUFFER_SIZE,
+        points_out_cipher_->block_size()
+      );
+
+      points_out_ = index_output::make<encrypted_output>(
+        std::move(points_out_),
+        *points_out_cipher_,
+        blocks_in_buffer);
+    }
+  }
+
   // prepare postings writer
   pw_->prepare(*terms_out_, state);
 
@@ -1012,12 +1096,27 @@ void field_writer::write(
   uint64_t sum_tfreq = 0;
 
   const bool freq_exists = features.check<frequency>();
+  const bool bloom_exists = version_ >= burst_trie::Version::BLOOM_FILTER_MIN
+                         && features.check<bloom_filter>();
+  const bool points_exist = version_ >= burst_trie::Version::POINTS_MIN
+                         && features.check<bkd_tree>();
   auto* docs = irs::get<version10::documents>(*pw_);
   assert(docs);
+  assert(!points_exist || points_out_);
+
+  std::vector<doc_id_t> term_docs;
 
   for (; terms.next();) {
     auto postings = terms.postings(features);
-    auto meta = pw_->write(*postings);
+    postings_writer::state meta;
+
+    if (points_exist) {
+      term_docs.clear();
+      recording_doc_iterator recorder(*postings, term_docs);
+      meta = pw_->write(recorder);
+    } else {
+      meta = pw_->write(*postings);
+    }
 
     if (freq_exists) {
       sum_tfreq += meta->freq;
@@ -1039,6 +1138,14 @@ void field_writer::write(
 
       max_term_.assign(term, volatile_state_);
 
+      if (bloom_exists) {
+        bloom_hashes_.emplace_back(bloom_filter::hash(term));
+      }
+
+      if (points_exist) {
+        push_point(name, term, term_docs);
+      }
+
       // increase processed term count
       ++term_count_;
     }
@@ -1059,11 +1166,36 @@ void field_writer::begin_field(const irs::flags& field) {
   // reset first field term
   min_term_.first = false;
   min_term_.second.clear();
+  bloom_hashes_.clear();
+  points_.clear();
   term_count_ = 0;
 
   pw_->begin_field(field);
 }
 
+void field_writer::push_point(
+    const std::string& name,
+    const bytes_ref& term,
+    const std::vector<doc_id_t>& docs) {
+  const size_t dims = term.size() / bkd_tree::BYTES_PER_DIM;
+
+  if (!dims || dims > bkd_tree::MAX_DIMS
+      || term.size() % bkd_tree::BYTES_PER_DIM
+      || (points_.dims() && points_.dims() != dims)) {
+    throw index_error(string_utils::to_string(
+      "while writing bkd tree of field '%s', error: invalid point of size '" IR_SIZE_T_SPECIFIER "'",
+      name.c_str(), term.size()));
+  }
+
+  if (!points_.dims()) {
+    assert(points_out_);
+    points_.prepare(*points_out_, dims);
+  }
+
+  // leaves are flushed to 'points_out_' once a chunk of points is full
+  points_.push(term.c_str(), docs.data(), docs.size());
+}
+
 void field_writer::write_segment_features(data_output& out, const flags& features) {
   out.write_vlong(features.size());
   feature_map_.clear();
@@ -1124,6 +1256,16 @@ void field_writer::end_field(
   if (features.check<frequency>()) {
     index_out_->write_vlong(total_term_freq);
   }
+  if (version_ >= burst_trie::Version::BLOOM_FILTER_MIN
+      && features.check<bloom_filter>()) {
+    bloom_.reset(bloom_hashes_.data(), bloom_hashes_.size());
+    bloom_.write(*index_out_);
+  }
+  if (version_ >= burst_trie::Version::POINTS_MIN
+      && features.check<bkd_tree>()) {
+    assert(points_.dims());
+    points_.finish(*index_out_);
+  }
 
   // build fst
   const entry& root = *stack_.begin();
@@ -1147,7 +1289,14 @@ void field_writer::end_field(
 #endif
 
   // write FST
-  if (version_ > burst_trie::Version::ENCRYPTION_MIN) {
+  if (version_ >= burst_trie::Version::FST_SIZE_MIN) {
+    // size allows to skip FST without decoding while opening a segment
+    const size_t fst_size = immutable_byte_fst::WriteSize(fst, fst_stats);
+    index_out_->write_vlong(fst_size);
+    [[maybe_unused]] const size_t fst_start = index_out_->file_pointer();
+    immutable_byte_fst::Write(fst, *index_out_, fst_stats);
+    assert(fst_start + fst_size == index_out_->file_pointer());
+  } else if (version_ > burst_trie::Version::ENCRYPTION_MIN) {
     immutable_byte_fst::Write(fst, *index_out_, fst_stats);
   } else {
     // wrap stream to be OpenFST compliant
@@ -1170,6 +1319,17 @@ void field_writer::end() {
   format_utils::write_footer(*terms_out_);
   terms_out_.reset(); // ensure stream is closed
 
+  if (points_out_) {
+    if (points_out_cipher_) {
+      auto& out = static_cast<encrypted_output&>(*points_out_);
+      out.flush();
+      points_out_ = out.release();
+    }
+
+    format_utils::write_footer(*points_out_);
+    points_out_.reset(); // ensure stream is closed
+  }
+
   if (index_out_cipher_) {
     auto& out = static_cast<encrypted_output&>(*index_out_);
     out.flush();
@@ -1198,7 +1358,21 @@ class term_reader_base : public irs::term_reader,
   virtual const bytes_ref& max() const noexcept override { return max_term_ref_; }
   virtual attribute* get_mutable(irs::type_info::type_id type) noexcept override;
 
-  virtual void prepare(index_input& in, const feature_map_t& features);
+  virtual void prepare(
+    index_input& in,
+    const feature_map_t& features,
+    burst_trie::Version version);
+
+ protected:
+  // @returns bloom filter of the field, nullptr if absent
+  const bloom_filter* bloom() const noexcept {
+    return bloom_.empty() ? nullptr : &bloom_;
+  }
+
+  // set input with leaves of the bkd tree of the field
+  void reset_points(const index_input* in) noexcept {
+    points_.reset(in);
+  }
 
  private:
   bstring min_term_;
@@ -1210,12 +1384,15 @@ class term_reader_base : public irs::term_reader,
   uint64_t doc_freq_;
   frequency freq_; // total term freq
   frequency* pfreq_{};
+  bloom_filter bloom_;
+  bkd_tree points_;
   field_meta field_;
 }; // term_reader_base
 
 void term_reader_base::prepare(
     index_input& in,
-    const feature_map_t& feature_map) {
+    const feature_map_t& feature_map,
+    burst_trie::Version version) {
   // read field metadata
   field_.name = read_string<std::string>(in);
 
@@ -1234,10 +1411,32 @@ void term_reader_base::prepare(
     freq_.value = in.read_vlong();
     pfreq_ = &freq_;
   }
+
+  if (version >= burst_trie::Version::BLOOM_FILTER_MIN
+      && field_.features.check<bloom_filter>()) {
+    bloom_.read(in);
+  }
+
+  if (version >= burst_trie::Version::POINTS_MIN
+      && field_.features.check<bkd_tree>()) {
+    points_.read(in);
+  }
 }
 
 attribute* term_reader_base::get_mutable(irs::type_info::type_id type) noexcept {
-  return irs::type<irs::frequency>::id() == type ? pfreq_ : nullptr;
+  if (irs::type<irs::frequency>::id() == type) {
+    return pfreq_;
+  }
+
+  if (irs::type<bloom_filter>::id() == type) {
+    return bloom_.empty() ? nullptr : &bloom_;
+  }
+
+  if (irs::type<bkd_tree>::id() == type) {
+    return points_.empty() ? nullptr : &points_;
+  }
+
+  return nullptr;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1827,15 +2026,22 @@ class term_iterator final : public term_iterator_base {
       postings_reader& postings,
       const index_input& terms_in,
       irs::encryption::stream* terms_cipher,
-      const FST& fst)
+      const FST& fst,
+      const bloom_filter* bloom = nullptr)
     : term_iterator_base(field, postings, terms_in, terms_cipher, nullptr),
       fst_(&fst),
+      bloom_(bloom),
       matcher_(&fst, fst::MATCH_INPUT) { // pass pointer to avoid copying FST
   }
 
   virtual bool next() override;
   virtual SeekResult seek_ge(const bytes_ref& term) override;
   virtual bool seek(const bytes_ref& term) override {
+    if (bloom_ && !bloom_->contains(term)) {
+      // term is definitely absent, don't touch the term dictionary
+      return false;
+    }
+
     return SeekResult::FOUND == seek_equal(term);
   }
   virtual bool seek(
@@ -1933,6 +2139,7 @@ class term_iterator final : public term_iterator_base {
   }
 
   const FST* fst_;
+  const bloom_filter* bloom_; // may be nullptr
   matcher_t matcher_;
   seek_state_t sstate_;
   block_stack_t block_stack_;
@@ -2589,39 +2796,111 @@ class field_reader final : public irs::field_reader {
     explicit term_reader(field_reader& owner) noexcept
       : owner_(&owner) {
     }
-    term_reader(term_reader&& rhs) = default;
+    term_reader(term_reader&& rhs) noexcept
+      : term_reader_base(std::move(rhs)),
+        owner_(rhs.owner_),
+        fst_(std::move(rhs.fst_)),
+        fst_ptr_(rhs.fst_ptr_.load()),
+        fst_offset_(rhs.fst_offset_) {
+    }
     term_reader& operator=(term_reader&& rhs) = delete;
 
-    virtual void prepare(index_input& in, const feature_map_t& features) override {
-      term_reader_base::prepare(in, features);
+    virtual void prepare(
+        index_input& in,
+        const feature_map_t& features,
+        burst_trie::Version version) override {
+      term_reader_base::prepare(in, features, version);
+      reset_points(owner_->points_in_.get());
+
+      if constexpr (std::is_same_v<FST, immutable_byte_fst>) {
+        // defer reading of FST until the first access
+        if (version >= burst_trie::Version::FST_SIZE_MIN) {
+          const uint64_t fst_size = in.read_vlong();
+          fst_offset_ = in.file_pointer();
+
+          if (fst_size > in.length() - fst_offset_) {
+            throw irs::index_error(string_utils::to_string(
+              "invalid size of term index for field '%s'",
+              meta().name.c_str()));
+          }
 
-      // read FST
-      input_buf isb(&in);
-      std::istream input(&isb); // wrap stream to be OpenFST compliant
-      fst_.reset(FST::Read(input, fst_read_options()));
+          in.seek(fst_offset_ + fst_size);
+          return;
+        }
 
-      if (!fst_) {
-        throw irs::index_error(string_utils::to_string(
-          "failed to read term index for field '%s'",
-          meta().name.c_str()));
+        // FST isn't prefixed with its size, thus has to be decoded to be
+        // skipped
+        fst_offset_ = in.file_pointer();
+
+        if (!FST::Skip(in)) {
+          throw irs::index_error(string_utils::to_string(
+            "failed to read term index for field '%s'",
+            meta().name.c_str()));
+        }
+      } else {
+        fst_ = read_fst(in);
+        fst_ptr_ = fst_.get();
       }
     }
 
     virtual seek_term_iterator::ptr iterator() const override {
       return memory::make_managed<term_iterator<FST>>(
         meta(), *owner_->pr_, *owner_->terms_in_,
-        owner_->terms_in_cipher_.get(), *fst_);
+        owner_->terms_in_cipher_.get(), fst(), bloom());
     }
 
     virtual seek_term_iterator::ptr iterator(automaton_table_matcher& matcher) const override {
       return memory::make_managed<automaton_term_iterator<FST>>(
         meta(), *owner_->pr_, *owner_->terms_in_,
-        owner_->terms_in_cipher_.get(), *fst_, matcher);
+        owner_->terms_in_cipher_.get(), fst(), matcher);
     }
 
    private:
+    std::unique_ptr<FST> read_fst(index_input& in) const {
+      input_buf isb(&in);
+      std::istream input(&isb); // wrap stream to be OpenFST compliant
+      std::unique_ptr<FST> fst(FST::Read(input, fst_read_options()));
+
+      if (!fst) {
+        throw irs::index_error(string_utils::to_string(
+          "failed to read term index for field '%s'",
+          meta().name.c_str()));
+      }
+
+      return fst;
+    }
+
+    const FST& fst() const {
+      const auto* fst = fst_ptr_.load(std::memory_order_acquire);
+
+      if (!fst) {
+        SCOPED_LOCK(owner_->fst_mutex_);
+
+        if (!fst_) {
+          assert(owner_->index_in_);
+          auto in = owner_->index_in_->reopen(); // thread-safe input
+
+          if (!in) {
+            throw io_error(string_utils::to_string(
+              "failed to reopen term index for field '%s'",
+              meta().name.c_str()));
+          }
+
+          in->seek(fst_offset_);
+          fst_ = read_fst(*in);
+          fst_ptr_.store(fst_.get(), std::memory_order_release);
+        }
+
+        fst = fst_.get();
+      }
+
+      return *fst;
+    }
+
     field_reader* owner_;
-    std::unique_ptr<FST> fst_;
+    mutable std::unique_ptr<FST> fst_; // guarded by 'owner_->fst_mutex_'
+    mutable std::atomic<const FST*> fst_ptr_{}; // set once 'fst_' is read
+    uint64_t fst_offset_{}; // offset of FST in term index
   }; // term_reader
 
   using vector_fst_reader = term_reader<vector_byte_fst>;
@@ -2635,6 +2914,11 @@ class field_reader final : public irs::field_reader {
   irs::postings_reader::ptr pr_;
   encryption::stream::ptr terms_in_cipher_;
   index_input::ptr terms_in_;
+  encryption::stream::ptr index_in_cipher_;
+  index_input::ptr index_in_; // term index input for lazily read FSTs
+  encryption::stream::ptr points_in_cipher_;
+  index_input::ptr points_in_; // leaves of bkd trees (optional)
+  std::mutex fst_mutex_; // guards lazy reading of FSTs
 }; // field_reader
 
 // -----------------------------------------------------------------------------
@@ -2717,6 +3001,45 @@ void field_reader::prepare(
 
   read_segment_features(*index_in, feature_map, features);
 
+  //-----------------------------------------------------------------
+  // prepare leaves of bkd trees
+  //-----------------------------------------------------------------
+
+  if (term_index_version >= burst_trie::Version::POINTS_MIN
+      && features.check<bkd_tree>()) {
+    const auto points_version = burst_trie::Version(prepare_input(
+      filename, points_in_, irs::IOAdvice::RANDOM, state,
+      field_writer::POINTS_EXT,
+      field_writer::FORMAT_POINTS,
+      static_cast<int32_t>(burst_trie::Version::MIN),
+      static_cast<int32_t>(burst_trie::Version::MAX)));
+
+    if (term_index_version != points_version) {
+      throw index_error(string_utils::to_string(
+        "term index version '%d' mismatches points version '%d' in segment '%s'",
+        term_index_version,
+        points_version,
+        meta.name.c_str()));
+    }
+
+    if (irs::decrypt(filename, *points_in_, enc, points_in_cipher_)) {
+      assert(points_in_cipher_ && points_in_cipher_->block_size());
+
+      const auto blocks_in_buffer = math::div_ceil64(
+        buffered_index_input::DEFAULT_BUFFER_SIZE,
+        points_in_cipher_->block_size());
+
+      points_in_ = memory::make_unique<encrypted_input>(
+        std::move(points_in_),
+        *points_in_cipher_,
+        blocks_in_buffer,
+        format_utils::FOOTER_LEN);
+    }
+
+    // cheap error detection, leaves are read on demand
+    format_utils::read_checksum(*points_in_);
+  }
+
   // read terms for each indexed field
   if (term_index_version <= burst_trie::Version::ENCRYPTION_MIN) {
     fields_ = vector_fst_readers{};
@@ -2728,7 +3051,7 @@ void field_reader::prepare(
 
     for (string_ref previous_field_name = string_ref::EMPTY; fields_count; --fields_count) {
       auto& field = fields.emplace_back(*this);
-      field.prepare(*index_in, feature_map);
+      field.prepare(*index_in, feature_map, term_index_version);
 
       const auto& name = field.meta().name;
 
@@ -2789,6 +3112,12 @@ void field_reader::prepare(
   // error detection which could recognize
   // some forms of corruption.
   format_utils::read_checksum(*terms_in_);
+
+  if (std::holds_alternative<immutable_fst_readers>(fields_)) {
+    // keep term index open to read FSTs on the first access
+    index_in_cipher_ = std::move(index_in_cipher);
+    index_in_ = std::move(index_in);
+  }
 }
 
 const irs::term_reader* field_reader::field(const string_ref& field) const {
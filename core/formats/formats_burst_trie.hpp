@@ -45,7 +45,33 @@ enum class Version : int32_t {
   /// * encryption support
   /// * term dictionary stored on disk as fst::fstext::ImmutableFst<...>
   ////////////////////////////////////////////////////////////////////////////
-  MAX = 2
+  IMMUTABLE_FST_MIN = 2,
+
+  ////////////////////////////////////////////////////////////////////////////
+  /// * encryption support
+  /// * term dictionary stored on disk as fst::fstext::ImmutableFst<...>
+  /// * optional per-field bloom filter of terms
+  ////////////////////////////////////////////////////////////////////////////
+  BLOOM_FILTER_MIN = 3,
+
+  ////////////////////////////////////////////////////////////////////////////
+  /// * encryption support
+  /// * term dictionary stored on disk as fst::fstext::ImmutableFst<...>
+  /// * optional per-field bloom filter of terms
+  /// * optional per-field block KD-tree of points
+  ////////////////////////////////////////////////////////////////////////////
+  POINTS_MIN = 4,
+
+  ////////////////////////////////////////////////////////////////////////////
+  /// * encryption support
+  /// * term dictionary stored on disk as fst::fstext::ImmutableFst<...>
+  ///   prefixed with its size to be skipped without decoding
+  /// * optional per-field bloom filter of terms
+  /// * optional per-field block KD-tree of points
+  ////////////////////////////////////////////////////////////////////////////
+  FST_SIZE_MIN = 5,
+
+  MAX = FST_SIZE_MIN
 };
 
 irs::field_writer::ptr make_writer(
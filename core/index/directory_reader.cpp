@@ -22,6 +22,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "composite_reader_impl.hpp"
+#include "utils/async_utils.hpp"
 #include "utils/directory_utils.hpp"
 #include "utils/singleton.hpp"
 #include "utils/string_utils.hpp"
@@ -169,10 +170,24 @@ class directory_reader_impl :
   // open a new directory reader
   // if codec == nullptr then use the latest file for all known codecs
   // if cached != nullptr then try to reuse its segments
+  // if pool != nullptr then open segments concurrently
   static index_reader::ptr open(
     const directory& dir,
     const format* codec = nullptr,
-    const index_reader::ptr& cached = nullptr
+    const index_reader::ptr& cached = nullptr,
+    async_utils::thread_pool* pool = nullptr
+  );
+
+  // open a new directory reader over the specified meta
+  // if meta_file_ref == nullptr then the meta isn't backed by a file
+  // if cached != nullptr then try to reuse its segments
+  // if pool != nullptr then open segments concurrently
+  static index_reader::ptr open(
+    const directory& dir,
+    index_meta&& meta,
+    const index_file_refs::ref_t& meta_file_ref,
+    const index_reader::ptr& cached = nullptr,
+    async_utils::thread_pool* pool = nullptr
   );
 
  private:
@@ -227,12 +242,23 @@ const directory_meta& directory_reader::meta() const {
 
 /*static*/ directory_reader directory_reader::open(
     const directory& dir,
-    format::ptr codec /*= nullptr*/) {
-  return directory_reader_impl::open(dir, codec.get());
+    format::ptr codec /*= nullptr*/,
+    async_utils::thread_pool* pool /*= nullptr*/) {
+  return directory_reader_impl::open(dir, codec.get(), nullptr, pool);
+}
+
+/*static*/ directory_reader directory_reader::open(
+    const directory& dir,
+    const index_meta& meta,
+    const directory_reader& cached /*= directory_reader()*/) {
+  return directory_reader_impl::open(
+    dir, index_meta(meta), nullptr,
+    atomic_utils::atomic_load(&cached.impl_));
 }
 
 directory_reader directory_reader::reopen(
-    format::ptr codec /*= nullptr*/) const {
+    format::ptr codec /*= nullptr*/,
+    async_utils::thread_pool* pool /*= nullptr*/) const {
   // make a copy
   impl_ptr impl = atomic_utils::atomic_load(&impl_);
 
@@ -243,7 +269,7 @@ directory_reader directory_reader::reopen(
 #endif
 
   return directory_reader_impl::open(
-    reader_impl.dir(), codec.get(), impl
+    reader_impl.dir(), codec.get(), impl, pool
   );
 }
 
@@ -267,7 +293,8 @@ directory_reader_impl::directory_reader_impl(
 /*static*/ index_reader::ptr directory_reader_impl::open(
     const directory& dir,
     const format* codec /*= nullptr*/,
-    const index_reader::ptr& cached /*= nullptr*/) {
+    const index_reader::ptr& cached /*= nullptr*/,
+    async_utils::thread_pool* pool /*= nullptr*/) {
   index_meta meta;
   index_file_refs::ref_t meta_file_ref = load_newest_index_meta(meta, dir, codec);
 
@@ -275,6 +302,15 @@ directory_reader_impl::directory_reader_impl(
     throw index_not_found();
   }
 
+  return open(dir, std::move(meta), meta_file_ref, cached, pool);
+}
+
+/*static*/ index_reader::ptr directory_reader_impl::open(
+    const directory& dir,
+    index_meta&& meta,
+    const index_file_refs::ref_t& meta_file_ref,
+    const index_reader::ptr& cached /*= nullptr*/,
+    async_utils::thread_pool* pool /*= nullptr*/) {
 #ifdef IRESEARCH_DEBUG
   auto* cached_impl = dynamic_cast<const directory_reader_impl*>(cached.get());
   assert(!cached || cached_impl);
@@ -310,17 +346,28 @@ directory_reader_impl::directory_reader_impl(
     return true;
   };
 
+  std::vector<size_t> reused(readers.size(), INVALID_CANDIDATE); // old segment id per segment
+
   for (size_t i = 0, size = meta.size(); i < size; ++i) {
-    auto& reader = readers[i];
     auto& segment = meta.segment(i).meta;
-    auto& segment_file_refs = file_refs[i];
     auto itr = reuse_candidates.find(segment.name);
 
     if (itr != reuse_candidates.end()
         && itr->second != INVALID_CANDIDATE
         && segment == cached_impl->meta_.meta.segment(itr->second).meta) {
-      reader = (*cached_impl)[itr->second].reopen(segment);
+      reused[i] = itr->second;
       reuse_candidates.erase(itr);
+    }
+  }
+
+  // opening a segment reads its meta, document mask, column and term
+  // indexes, i.e. it is dominated by I/O, so keep the disk queue busy
+  async_utils::parallel_for(pool, readers.size(), [&](size_t i) {
+    auto& reader = readers[i];
+    auto& segment = meta.segment(i).meta;
+
+    if (INVALID_CANDIDATE != reused[i]) {
+      reader = (*cached_impl)[reused[i]].reopen(segment);
     } else {
       reader = segment_reader::open(dir, segment);
     }
@@ -331,6 +378,12 @@ directory_reader_impl::directory_reader_impl(
         segment.name.c_str()
       ));
     }
+  });
+
+  for (size_t i = 0, size = meta.size(); i < size; ++i) {
+    auto& reader = readers[i];
+    auto& segment = meta.segment(i).meta;
+    auto& segment_file_refs = file_refs[i];
 
     docs_max += reader.docs_count();
     docs_count += reader.live_docs_count();
@@ -339,12 +392,18 @@ directory_reader_impl::directory_reader_impl(
   }
 
   directory_utils::reference(const_cast<directory&>(dir), meta, visitor, true);
-  tmp_file_refs.emplace(meta_file_ref);
+
+  if (meta_file_ref) {
+    tmp_file_refs.emplace(meta_file_ref);
+  }
+
   file_refs.back().swap(tmp_file_refs); // use last position for storing index_meta refs
 
   directory_meta dir_meta;
 
-  dir_meta.filename = *meta_file_ref;
+  if (meta_file_ref) {
+    dir_meta.filename = *meta_file_ref;
+  }
   dir_meta.meta = std::move(meta);
 
   PTR_NAMED(
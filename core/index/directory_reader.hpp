@@ -30,6 +30,10 @@
 
 namespace iresearch {
 
+namespace async_utils {
+class thread_pool;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief representation of the metadata of a directory_reader
 ////////////////////////////////////////////////////////////////////////////////
@@ -102,19 +106,36 @@ class IRESEARCH_API directory_reader final
   ////////////////////////////////////////////////////////////////////////////////
   /// @brief create an index reader over the specified directory
   ///        if codec == nullptr then use the latest file for all known codecs
+  ///        if pool != nullptr then segments are opened concurrently on
+  ///        at most 'pool->max_threads()' threads of the pool
+  ////////////////////////////////////////////////////////////////////////////////
+  static directory_reader open(
+    const directory& dir,
+    format::ptr codec = nullptr,
+    async_utils::thread_pool* pool = nullptr
+  );
+
+  ////////////////////////////////////////////////////////////////////////////////
+  /// @brief create an index reader over the segments of the specified meta,
+  ///        e.g. uncommitted segments flushed by an index_writer
+  ///        this call will atempt to reuse segments from 'cached' if specified
   ////////////////////////////////////////////////////////////////////////////////
   static directory_reader open(
     const directory& dir,
-    format::ptr codec = nullptr
+    const index_meta& meta,
+    const directory_reader& cached = directory_reader()
   );
 
   ////////////////////////////////////////////////////////////////////////////////
   /// @brief open a new instance based on the latest file for the specified codec
   ///        this call will atempt to reuse segments from the existing reader
   ///        if codec == nullptr then use the latest file for all known codecs
+  ///        if pool != nullptr then segments are opened concurrently on
+  ///        at most 'pool->max_threads()' threads of the pool
   ////////////////////////////////////////////////////////////////////////////////
   virtual directory_reader reopen(
-    format::ptr codec = nullptr
+    format::ptr codec = nullptr,
+    async_utils::thread_pool* pool = nullptr
   ) const;
 
   void reset() noexcept {
@@ -266,17 +266,19 @@ namespace detail {
 /// @class doc_iterator
 ////////////////////////////////////////////////////////////////////////////////
 class doc_iterator final
-  : public frozen_attributes<3, irs::doc_iterator> {
+  : public frozen_attributes<4, irs::doc_iterator> {
  public:
   doc_iterator() noexcept
    : attributes{{
        { type<document>::id(), &doc_ },
        { type<frequency>::id(), nullptr },
        { type<position>::id(), nullptr },
+       { type<quantized_norm>::id(), nullptr },
      }},
      freq_in_(EMPTY_POOL),
      pfreq_(attributes::ref(type<frequency>::id())),
-     ppos_(attributes::ref(type<position>::id())) {
+     ppos_(attributes::ref(type<position>::id())),
+     pnorm_(attributes::ref(type<quantized_norm>::id())) {
   }
 
   // reset field
@@ -284,12 +286,17 @@ class doc_iterator final
     field_ = &field;
     *pfreq_ = nullptr;
     *ppos_ = nullptr;
+    *pnorm_ = nullptr;
     has_cookie_ = false;
 
     auto& features = field.meta().features;
     if (features.check<frequency>()) {
       *pfreq_ = &freq_;
 
+      if (features.check<norm>()) {
+        *pnorm_ = &norm_;
+      }
+
       if (features.check<position>()) {
         pos_.reset(features, freq_);
         *ppos_ = &pos_;
@@ -371,6 +378,10 @@ class doc_iterator final
       assert(doc_.value != posting_->doc);
     }
 
+    if (*pnorm_) {
+      norm_.value = field_->stored_norm(doc_.value);
+    }
+
     pos_.clear();
 
     return true;
@@ -381,11 +392,13 @@ class doc_iterator final
   uint64_t cookie_{};
   document doc_;
   frequency freq_;
+  quantized_norm norm_;
   pos_iterator<byte_block_pool::sliced_reader> pos_;
   byte_block_pool::sliced_reader freq_in_;
   const posting* posting_{};
   attribute** pfreq_{};
   attribute** ppos_{};
+  attribute** pnorm_{};
   bool has_cookie_{false}; // FIXME remove
 };
 
@@ -393,16 +406,18 @@ class doc_iterator final
 /// @class sorting_doc_iterator
 ////////////////////////////////////////////////////////////////////////////////
 class sorting_doc_iterator final
-    : public frozen_attributes<3, irs::doc_iterator> {
+    : public frozen_attributes<4, irs::doc_iterator> {
  public:
   sorting_doc_iterator() noexcept
    : attributes{{
        { type<document>::id(), &doc_ },
        { type<frequency>::id(), nullptr },
        { type<position>::id(), nullptr },
+       { type<quantized_norm>::id(), nullptr },
      }},
      pfreq_(attributes::ref(type<frequency>::id())),
-     ppos_(attributes::ref(type<position>::id())) {
+     ppos_(attributes::ref(type<position>::id())),
+     pnorm_(attributes::ref(type<quantized_norm>::id())) {
   }
 
   // reset field
@@ -412,11 +427,16 @@ class sorting_doc_iterator final
 
     *pfreq_ = nullptr;
     *ppos_ = nullptr;
+    *pnorm_ = nullptr;
 
     auto& features = field.meta().features;
     if (features.check<frequency>()) {
       *pfreq_ = &freq_;
 
+      if (features.check<norm>()) {
+        *pnorm_ = &norm_;
+      }
+
       if (features.check<position>()) {
         pos_.reset(features, freq_);
         *ppos_ = &pos_;
@@ -435,15 +455,23 @@ class sorting_doc_iterator final
       freq = freq_attr;
     }
 
+    const quantized_norm no_norm;
+    const quantized_norm* norm = &no_norm;
+
+    const auto* norm_attr = irs::get<quantized_norm>(it);
+    if (norm_attr) {
+      norm = norm_attr;
+    }
+
     docs_.reserve(it.cost());
     docs_.clear();
 
     if (!docmap) {
-      reset_already_sorted(it, *freq);
+      reset_already_sorted(it, *freq, *norm);
     } else if (irs::use_dense_sort(it.cost(), docmap->size()-1)) { // -1 for first element
-      reset_dense(it, *freq, *docmap);
+      reset_dense(it, *freq, *norm, *docmap);
     } else {
-      reset_sparse(it, *freq, *docmap);
+      reset_sparse(it, *freq, *norm, *docmap);
     }
 
     doc_.value = irs::doc_limits::invalid();
@@ -471,6 +499,7 @@ class sorting_doc_iterator final
       auto& doc = *it_;
       doc_.value = doc.doc;
       freq_.value = doc.freq;
+      norm_.value = doc.norm;
 
       if (doc.cookie) {
         // (cookie != 0) -> we have proximity data
@@ -490,18 +519,20 @@ class sorting_doc_iterator final
  private:
   struct doc_entry {
     doc_entry() = default;
-    doc_entry(doc_id_t doc, uint32_t freq, uint64_t cookie) noexcept
-      : doc(doc), freq(freq), cookie(cookie) {
+    doc_entry(doc_id_t doc, uint32_t freq, byte_type norm, uint64_t cookie) noexcept
+      : doc(doc), freq(freq), norm(norm), cookie(cookie) {
     }
 
     doc_id_t doc{ doc_limits::eof() }; // doc_id
     uint32_t freq; // freq
+    byte_type norm; // quantized norm
     uint64_t cookie; // prox_cookie
   }; // doc_entry
 
   void reset_dense(
       detail::doc_iterator& it,
       const frequency& freq,
+      const quantized_norm& norm,
       const std::vector<doc_id_t>& docmap) {
     assert(!docmap.empty());
     assert(irs::use_dense_sort(it.cost(), docmap.size()-1)); // -1 for first element
@@ -520,6 +551,7 @@ class sorting_doc_iterator final
       auto& doc = docs_[new_doc - doc_limits::min()];
       doc.doc = new_doc;
       doc.freq = freq.value;
+      doc.norm = norm.value;
       doc.cookie = it.cookie();
     }
   }
@@ -527,6 +559,7 @@ class sorting_doc_iterator final
   void reset_sparse(
       detail::doc_iterator& it,
       const frequency& freq,
+      const quantized_norm& norm,
       const std::vector<doc_id_t>& docmap) {
     assert(!docmap.empty());
     assert(!irs::use_dense_sort(it.cost(), docmap.size()-1)); // -1 for first element
@@ -540,7 +573,7 @@ class sorting_doc_iterator final
         continue;
       }
 
-      docs_.emplace_back(new_doc, freq.value, it.cookie());
+      docs_.emplace_back(new_doc, freq.value, norm.value, it.cookie());
     }
 
     std::sort(
@@ -550,9 +583,12 @@ class sorting_doc_iterator final
     });
   }
 
-  void reset_already_sorted(detail::doc_iterator& it, const frequency& freq) {
+  void reset_already_sorted(
+      detail::doc_iterator& it,
+      const frequency& freq,
+      const quantized_norm& norm) {
     while (it.next()) {
-      docs_.emplace_back(it.value(), freq.value, it.cookie());
+      docs_.emplace_back(it.value(), freq.value, norm.value, it.cookie());
     }
   }
 
@@ -561,9 +597,11 @@ class sorting_doc_iterator final
   std::vector<doc_entry> docs_;
   document doc_;
   frequency freq_;
+  quantized_norm norm_;
   pos_iterator<byte_block_pool::sliced_greedy_reader> pos_;
   attribute** pfreq_{};
   attribute** ppos_{};
+  attribute** pnorm_{};
 }; // sorting_doc_iterator
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -795,6 +833,17 @@ data_output& field_data::norms(columnstore_writer& writer) {
   return norms_(doc());
 }
 
+void field_data::store_norm(byte_type value) {
+  assert(doc_limits::valid(doc()));
+  const size_t idx = doc() - doc_limits::min();
+
+  if (idx >= quantized_norms_.size()) {
+    quantized_norms_.resize(idx + 1, quantized_norm::encode(1U));
+  }
+
+  quantized_norms_[idx] = value;
+}
+
 void field_data::new_term(
     posting& p,
     doc_id_t did,
@@ -28,6 +28,8 @@
 #include "postings.hpp"
 #include "formats/formats.hpp"
 
+#include "analysis/token_attributes.hpp"
+
 #include "index/iterators.hpp"
 
 #include "utils/block_pool.hpp"
@@ -90,6 +92,18 @@ class IRESEARCH_API field_data : util::noncopyable {
 
   data_output& norms(columnstore_writer& writer);
 
+  // stores quantized normalization factor for the current document
+  void store_norm(byte_type value);
+
+  // returns quantized normalization factor for the specified document
+  byte_type stored_norm(doc_id_t doc) const noexcept {
+    assert(doc >= doc_limits::min());
+    const size_t idx = doc - doc_limits::min();
+    return idx < quantized_norms_.size()
+      ? quantized_norms_[idx]
+      : quantized_norm::encode(1U);
+  }
+
   // returns false if field contains indexed data
   bool empty() const noexcept {
     return !doc_limits::valid(last_doc_);
@@ -120,6 +134,7 @@ class IRESEARCH_API field_data : util::noncopyable {
   void add_term_random_access(posting& p, doc_id_t did, const payload* pay, const offset* offs);
 
   columnstore_writer::values_writer_f norms_;
+  std::vector<byte_type> quantized_norms_; // indexed by document id
   field_meta meta_;
   postings terms_;
   byte_block_pool::inserter* byte_writer_;
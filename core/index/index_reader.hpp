@@ -150,6 +150,12 @@ struct IRESEARCH_API sub_reader : index_reader {
   virtual const columnstore_reader::column_reader* column_reader(field_id field) const = 0;
 
   const columnstore_reader::column_reader* column_reader(const string_ref& field) const;
+
+  // returns quantized norms (see 'quantized_norm') indexed by document id
+  // if norms stored in the specified column are cached, nullptr otherwise
+  virtual const byte_type* norms(field_id /*column*/) const {
+    return nullptr;
+  }
 }; // sub_reader
 
 template<typename Visitor, typename FilterVisitor>
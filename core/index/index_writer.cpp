@@ -27,7 +27,9 @@
 #include "comparer.hpp"
 #include "formats/format_utils.hpp"
 #include "search/exclusion.hpp"
+#include "search/term_filter.hpp"
 #include "utils/bitvector.hpp"
+#include "utils/bloom_filter.hpp"
 #include "utils/compression.hpp"
 #include "utils/directory_utils.hpp"
 #include "utils/index_utils.hpp"
@@ -37,6 +39,8 @@
 #include "utils/range.hpp"
 #include "index_writer.hpp"
 
+#include <chrono>
+#include <condition_variable>
 #include <list>
 #include <sstream>
 
@@ -92,6 +96,166 @@ std::vector<irs::index_file_refs::ref_t> extract_refs(
   return refs;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// @class term_modifications
+/// @brief documents of a segment matched by 'irs::by_term' modifications,
+///        the terms are sorted and looked up in a single ordered pass over
+///        the term dictionary of each field instead of preparing and executing
+///        every filter separately (e.g. bulk replace by primary key)
+////////////////////////////////////////////////////////////////////////////////
+class term_modifications : irs::util::noncopyable {
+ public:
+  term_modifications(
+      const modification_contexts_ref& modifications,
+      const irs::sub_reader& reader) {
+    struct key_t {
+      irs::string_ref field;
+      irs::bytes_ref term;
+      size_t modification; // offset in 'modifications'
+    };
+
+    std::vector<key_t> keys;
+
+    for (size_t i = 0, count = modifications.size(); i < count; ++i) {
+      auto& filter = modifications[i].filter;
+
+      if (filter && filter->type() == irs::type<irs::by_term>::id()) {
+        auto& term_filter = static_cast<const irs::by_term&>(*filter);
+        keys.emplace_back(key_t{ term_filter.field(), term_filter.options().term, i });
+      }
+    }
+
+    if (keys.empty()) {
+      return; // nothing to resolve
+    }
+
+    std::sort(
+      keys.begin(), keys.end(),
+      [](const key_t& lhs, const key_t& rhs) noexcept {
+        const auto res = compare(lhs.field, rhs.field);
+        return res ? res < 0 : irs::memcmp_less(lhs.term, rhs.term);
+    });
+
+    docs_ranges_.resize(modifications.size(), NOT_TERM_MODIFICATION);
+
+    const key_t* prev = nullptr;
+    const irs::term_reader* field = nullptr;
+    const irs::bloom_filter* bloom = nullptr;
+    irs::seek_term_iterator::ptr terms;
+
+    for (auto& key : keys) {
+      auto& range = docs_ranges_[key.modification];
+
+      if (prev && prev->field == key.field && prev->term == key.term) {
+        range = docs_ranges_[prev->modification]; // same term, already resolved
+        continue;
+      }
+
+      if (!prev || prev->field != key.field) {
+        field = reader.field(key.field);
+        bloom = field ? irs::get<irs::bloom_filter>(*field) : nullptr;
+        terms = nullptr;
+      }
+
+      prev = &key;
+      range.first = docs_.size();
+
+      // skip terms which are definitely absent in the segment,
+      // the term dictionary isn't touched unless it's really needed
+      if (field && (!bloom || bloom->contains(key.term))) {
+        if (!terms) {
+          terms = field->iterator();
+        }
+
+        if (terms && terms->seek(key.term)) {
+          terms->read();
+
+          for (auto docs = terms->postings(irs::flags::empty_instance()); docs->next();) {
+            docs_.emplace_back(docs->value());
+          }
+        }
+      }
+
+      range.second = docs_.size();
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief invoke 'visitor' for every document matched by the modification
+  ///        at offset 'i'
+  /// @return false if the modification isn't a term modification
+  //////////////////////////////////////////////////////////////////////////////
+  template<typename Visitor>
+  bool visit(size_t i, const Visitor& visitor) const {
+    if (docs_ranges_.empty() || NOT_TERM_MODIFICATION == docs_ranges_[i]) {
+      return false;
+    }
+
+    const auto& range = docs_ranges_[i];
+
+    for (auto doc = range.first; doc < range.second; ++doc) {
+      visitor(docs_[doc]);
+    }
+
+    return true;
+  }
+
+ private:
+  typedef std::pair<size_t, size_t> docs_range_t; // [begin, end) in 'docs_'
+
+  static constexpr docs_range_t NOT_TERM_MODIFICATION{
+    irs::integer_traits<size_t>::const_max,
+    irs::integer_traits<size_t>::const_max
+  };
+
+  std::vector<docs_range_t> docs_ranges_; // by modification offset
+  std::vector<irs::doc_id_t> docs_; // matched documents
+}; // term_modifications
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief invoke 'visitor' for every document of the segment matched by every
+///        valid modification in order of modifications
+////////////////////////////////////////////////////////////////////////////////
+template<typename Visitor>
+void visit_modified_records(
+    modification_contexts_ref& modifications,
+    const irs::sub_reader& reader,
+    const Visitor& visitor) {
+  const term_modifications terms(modifications, reader);
+
+  for (size_t i = 0, count = modifications.size(); i < count; ++i) {
+    auto& modification = modifications[i];
+
+    if (!modification.filter) {
+      continue; // skip invalid or uncommitted modification queries
+    }
+
+    auto visit_doc = [&modification, &visitor](irs::doc_id_t doc_id) {
+      visitor(modification, doc_id);
+    };
+
+    if (terms.visit(i, visit_doc)) {
+      continue; // already resolved
+    }
+
+    auto prepared = modification.filter->prepare(reader);
+
+    if (!prepared) {
+      continue; // skip invalid prepared filters
+    }
+
+    auto itr = prepared->execute(reader);
+
+    if (!itr) {
+      continue; // skip invalid iterators
+    }
+
+    while (itr->next()) {
+      visit_doc(itr->value());
+    }
+  }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief apply any document removals based on filters in the segment
 /// @param modifications where to get document update_contexts from
@@ -123,39 +287,22 @@ bool add_document_mask_modified_records(
 
   bool modified = false;
 
-  for (auto& modification : modifications) {
-    if (!modification.filter) {
-      continue; // skip invalid or uncommitted modification queries
-    }
-
-    auto prepared = modification.filter->prepare(reader);
-
-    if (!prepared) {
-      continue; // skip invalid prepared filters
+  auto visitor = [&](irs::index_writer::modification_context& modification,
+                     irs::doc_id_t doc_id) {
+    // if the indexed doc_id was insert()ed after the request for modification
+    // or the indexed doc_id was already masked then it should be skipped
+    if (modification.generation < min_modification_generation
+        || !docs_mask.insert(doc_id).second) {
+      return; // the current modification query does not match any records
     }
 
-    auto itr = prepared->execute(reader);
-
-    if (!itr) {
-      continue; // skip invalid iterators
-    }
-
-    while (itr->next()) {
-      const auto doc_id = itr->value();
-
-      // if the indexed doc_id was insert()ed after the request for modification
-      // or the indexed doc_id was already masked then it should be skipped
-      if (modification.generation < min_modification_generation
-          || !docs_mask.insert(doc_id).second) {
-        continue; // the current modification query does not match any records
-      }
+    assert(meta.live_docs_count);
+    --meta.live_docs_count; // decrement count of live docs
+    modification.seen = true;
+    modified = true;
+  };
 
-      assert(meta.live_docs_count);
-      --meta.live_docs_count; // decrement count of live docs
-      modification.seen = true;
-      modified = true;
-    }
-  }
+  visit_modified_records(modifications, reader, visitor);
 
   return modified;
 }
@@ -191,54 +338,37 @@ bool add_document_mask_modified_records(
   assert(ctx.doc_id_end_ <= ctx.update_contexts_.size() + irs::doc_limits::min());
   bool modified = false;
 
-  for (auto& modification : modifications) {
-    if (!modification.filter) {
-      continue; // skip invalid or uncommitted modification queries
+  auto visitor = [&](irs::index_writer::modification_context& modification,
+                     irs::doc_id_t doc_id) {
+    if (doc_id < ctx.doc_id_begin_ || doc_id >= ctx.doc_id_end_) {
+      return; // doc_id is not part of the current flush_context
     }
 
-    auto prepared = modification.filter->prepare(reader);
+    auto& doc_ctx = ctx.update_contexts_[doc_id - irs::doc_limits::min()]; // valid because of asserts above
 
-    if (!prepared) {
-      continue; // skip invalid prepared filters
+    // if the indexed doc_id was insert()ed after the request for modification
+    // or the indexed doc_id was already masked then it should be skipped
+    if (modification.generation < doc_ctx.generation
+        || !ctx.docs_mask_.insert(doc_id).second) {
+      return; // the current modification query does not match any records
     }
 
-    auto itr = prepared->execute(reader);
-
-    if (!itr) {
-      continue; // skip invalid iterators
+    // if an update modification and update-value record whose query was not
+    // seen (i.e. replacement value whose filter did not match any documents)
+    // for every update request a replacement 'update-value' is optimistically inserted
+    if (modification.update
+        && doc_ctx.update_id != NON_UPDATE_RECORD
+        && !ctx.modification_contexts_[doc_ctx.update_id].seen) {
+      return; // the current modification matched a replacement document which in turn did not match any records
     }
 
-    while (itr->next()) {
-      const auto doc_id = itr->value();
-
-      if (doc_id < ctx.doc_id_begin_ || doc_id >= ctx.doc_id_end_) {
-        continue; // doc_id is not part of the current flush_context
-      }
-
-      auto& doc_ctx = ctx.update_contexts_[doc_id - irs::doc_limits::min()]; // valid because of asserts above
-
-      // if the indexed doc_id was insert()ed after the request for modification
-      // or the indexed doc_id was already masked then it should be skipped
-      if (modification.generation < doc_ctx.generation
-          || !ctx.docs_mask_.insert(doc_id).second) {
-        continue; // the current modification query does not match any records
-      }
-
-      // if an update modification and update-value record whose query was not
-      // seen (i.e. replacement value whose filter did not match any documents)
-      // for every update request a replacement 'update-value' is optimistically inserted
-      if (modification.update
-          && doc_ctx.update_id != NON_UPDATE_RECORD
-          && !ctx.modification_contexts_[doc_ctx.update_id].seen) {
-        continue; // the current modification matched a replacement document which in turn did not match any records
-      }
+    assert(ctx.segment_.meta.live_docs_count);
+    --ctx.segment_.meta.live_docs_count; // decrement count of live docs
+    modification.seen = true;
+    modified = true;
+  };
 
-      assert(ctx.segment_.meta.live_docs_count);
-      --ctx.segment_.meta.live_docs_count; // decrement count of live docs
-      modification.seen = true;
-      modified = true;
-    }
-  }
+  visit_modified_records(modifications, reader, visitor);
 
   return modified;
 }
@@ -833,18 +963,24 @@ index_writer::flush_context_ptr index_writer::documents_context::update_segment(
   if (writer.initialized()) {
     auto segment_docs_max = writer_.segment_limits_.segment_docs_max.load();
     auto segment_memory_max = writer_.segment_limits_.segment_memory_max.load();
+    auto memory_max = writer_.segment_limits_.memory_max.load();
+
+    if (memory_max) {
+      segment.update_memory();
+    }
 
     // if not reached the limit of the current segment then use it
     if ((!segment_docs_max || segment_docs_max > writer.docs_cached()) // too many docs
         && (!segment_memory_max || segment_memory_max > writer.memory_active()) // too much memory
+        && (!memory_max || !flush_largest(segment, memory_max)) // too much memory in all segments and this one is the largest
         && !doc_limits::eof(writer.docs_cached())) { // segment full
       return ctx;
     }
 
     // force a flush of a full segment
     IR_FRMT_TRACE(
-      "Flushing segment '%s', docs=" IR_SIZE_T_SPECIFIER ", memory=" IR_SIZE_T_SPECIFIER ", docs limit=" IR_SIZE_T_SPECIFIER ", memory limit=" IR_SIZE_T_SPECIFIER "",
-      writer.name().c_str(), writer.docs_cached(), writer.memory_active(), segment_docs_max, segment_memory_max
+      "Flushing segment '%s', docs=" IR_SIZE_T_SPECIFIER ", memory=" IR_SIZE_T_SPECIFIER ", total memory=" IR_SIZE_T_SPECIFIER ", docs limit=" IR_SIZE_T_SPECIFIER ", memory limit=" IR_SIZE_T_SPECIFIER ", total memory limit=" IR_SIZE_T_SPECIFIER "",
+      writer.name().c_str(), writer.docs_cached(), writer.memory_active(), writer_.memory_->memory.load(), segment_docs_max, segment_memory_max, memory_max
     );
 
     try {
@@ -1008,11 +1144,20 @@ void index_writer::flush_context::emplace(active_segment_context&& segment) {
 
     ++segments_active; // increment counter to hold reservation while segment_context is being released and added to the freelist
     segment = active_segment_context(); // reset before adding to freelist to garantee proper use_count() in get_segment_context(...)
+    ctx.idle_.store(true); // allow flushing by other threads until taken from free-list
     pending_segment_contexts_freelist_.push(*freelist_node); // add segment_context to free-list
   }
 }
 
 void index_writer::flush_context::reset() noexcept {
+  // clear() before pending_segment_contexts_, take segments from the free-list
+  // waiting for a concurrent flush due to 'memory_max' to finish
+  while (auto* freelist_node = static_cast<pending_segment_context*>(pending_segment_contexts_freelist_.pop())) { // only nodes of type 'pending_segment_context' are added to 'pending_segment_contexts_freelist_'
+    while (!freelist_node->segment_->idle_.exchange(false)) {
+      std::this_thread::yield();
+    }
+  }
+
   // reset before returning to pool
   for (auto& entry: pending_segment_contexts_) {
     if (entry.segment_.use_count() == 1) {
@@ -1020,8 +1165,6 @@ void index_writer::flush_context::reset() noexcept {
     }
   }
 
-  while(pending_segment_contexts_freelist_.pop()); // clear() before pending_segment_contexts_
-
   generation_.store(0);
   dir_->clear_refs();
   pending_segments_.clear();
@@ -1033,7 +1176,8 @@ index_writer::segment_context::segment_context(
     directory& dir,
     segment_meta_generator_t&& meta_generator,
     const column_info_provider_t& column_info,
-    const comparer* comparator)
+    const comparer* comparator,
+    memory_accounting& memory)
   : active_count_(0),
     buffered_docs_(0),
     dirty_(false),
@@ -1042,12 +1186,34 @@ index_writer::segment_context::segment_context(
     uncomitted_doc_id_begin_(doc_limits::min()),
     uncomitted_generation_offset_(0),
     uncomitted_modification_queries_(0),
-    writer_(segment_writer::make(dir_, column_info, comparator)) {
+    writer_(segment_writer::make(dir_, column_info, comparator)),
+    memory_(&memory) {
   assert(meta_generator_);
+  SCOPED_LOCK(memory_->mutex_);
+  memory_->contexts_.emplace_back(this);
 }
 
-uint64_t index_writer::segment_context::flush() {
-  SCOPED_LOCK(flush_mutex_); // prevent concurrent flush related modifications
+index_writer::segment_context::~segment_context() {
+  {
+    SCOPED_LOCK(memory_->mutex_);
+    auto& contexts = memory_->contexts_;
+    auto it = std::find(contexts.begin(), contexts.end(), this);
+    assert(it != contexts.end());
+    *it = contexts.back();
+    contexts.pop_back();
+  }
+
+  // release accounted memory, 'memory_' is shared with other segments
+  writer_.reset();
+  update_memory();
+}
+
+uint64_t index_writer::segment_context::flush(bool locked /*= false*/) {
+  DEFER_SCOPED_LOCK_NAMED(flush_mutex_, lock); // prevent concurrent flush related modifications
+
+  if (!locked) {
+    lock.lock();
+  }
 
   if (!writer_ || !writer_->initialized() || !writer_->docs_cached()) {
     return 0; // skip flushing an empty writer
@@ -1083,6 +1249,7 @@ uint64_t index_writer::segment_context::flush() {
 
   auto const tick = writer_->tick();
   writer_->reset(); // mark segment as already flushed
+  update_memory();
   return tick;
 }
 
@@ -1090,8 +1257,9 @@ index_writer::segment_context::ptr index_writer::segment_context::make(
     directory& dir,
     segment_meta_generator_t&& meta_generator,
     const column_info_provider_t& column_info,
-    const comparer* comparator) {
-  return memory::make_shared<segment_context>(dir, std::move(meta_generator), column_info, comparator);
+    const comparer* comparator,
+    memory_accounting& memory) {
+  return memory::make_shared<segment_context>(dir, std::move(meta_generator), column_info, comparator, memory);
 }
 
 segment_writer::update_context index_writer::segment_context::make_update_context() {
@@ -1194,9 +1362,58 @@ void index_writer::segment_context::reset() noexcept {
     writer_->reset(); // try to reduce number of files flushed below
   }
 
+  update_memory();
   dir_.clear_refs(); // release refs only after clearing writer state to ensure 'writer_' does not hold any files
 }
 
+size_t index_writer::segment_context::update_memory() noexcept {
+  assert(memory_);
+  const size_t memory = writer_ ? writer_->memory_active() : 0;
+  const size_t memory_accounted = memory_accounted_.load();
+
+  if (memory == memory_accounted) {
+    return memory;
+  }
+
+  if (!memory_accounted) {
+    ++memory_->segments;
+  } else if (!memory) {
+    --memory_->segments;
+  }
+
+  if (memory > memory_accounted) {
+    memory_->memory += memory - memory_accounted;
+  } else {
+    memory_->memory -= memory_accounted - memory;
+  }
+
+  memory_accounted_.store(memory);
+  return memory;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief state shared between the writer and its background consolidation
+///        tasks, owned by every scheduled task since a task may be picked up
+///        by a pool thread after the writer is destroyed
+////////////////////////////////////////////////////////////////////////////////
+struct index_writer::consolidation_scheduler : util::noncopyable {
+  consolidation_scheduler(
+      index_writer& writer,
+      const consolidation_options& options)
+    : writer(&writer), options(options) {
+  }
+
+  index_writer* writer; // accessed only while 'closed' is false
+  const consolidation_options options;
+  std::mutex mutex;
+  std::condition_variable cond;
+  std::chrono::steady_clock::time_point next_start; // earliest start of the next consolidation, guarded by 'mutex'
+  size_t tasks{0}; // number of scheduled tasks, guarded by 'mutex'
+  size_t active{0}; // number of running tasks, guarded by 'mutex'
+  bool pending{false}; // commit happened since the last selection, guarded by 'mutex'
+  std::atomic<bool> closed{false}; // no more tasks may start, modified under 'mutex'
+}; // consolidation_scheduler
+
 index_writer::index_writer(
     index_lock::ptr&& lock,
     index_file_refs::ref_t&& lock_file_ref,
@@ -1207,6 +1424,10 @@ index_writer::index_writer(
     const comparer* comparator,
     const column_info_provider_t& column_info,
     const payload_provider_t& meta_payload_provider,
+    async_utils::thread_pool* flush_pool,
+    async_utils::thread_pool* merge_pool,
+    std::shared_ptr<memory_accounting> memory,
+    const consolidation_options& consolidation,
     index_meta&& meta,
     committed_state_t&& committed_state)
   : column_info_(column_info),
@@ -1217,8 +1438,11 @@ index_writer::index_writer(
     committed_state_(std::move(committed_state)),
     dir_(dir),
     flush_context_pool_(2), // 2 because just swap them due to common commit lock
+    flush_pool_(flush_pool),
+    merge_pool_(merge_pool),
     meta_(std::move(meta)),
     segment_limits_(segment_limits),
+    memory_(std::move(memory)),
     segment_writer_pool_(segment_pool_size),
     segments_active_(0),
     writer_(codec->get_index_meta_writer()),
@@ -1226,6 +1450,7 @@ index_writer::index_writer(
     write_lock_file_ref_(std::move(lock_file_ref)) {
   assert(column_info); // ensured by 'make'
   assert(codec);
+  assert(memory_); // ensured by 'make'
   flush_context_.store(&flush_context_pool_[0]);
 
   // setup round-robin chain
@@ -1237,6 +1462,12 @@ index_writer::index_writer(
   // setup round-robin chain
   flush_context_pool_[flush_context_pool_.size() - 1].dir_ = memory::make_unique<ref_tracking_directory>(dir);
   flush_context_pool_[flush_context_pool_.size() - 1].next_context_ = &flush_context_pool_[0];
+
+  if (consolidation.pool && !consolidation.policies.empty()) {
+    consolidation_scheduler_ = memory::make_shared<consolidation_scheduler>(
+      *this, consolidation
+    );
+  }
 }
 
 void index_writer::clear(uint64_t tick) {
@@ -1368,6 +1599,10 @@ index_writer::ptr index_writer::make(
     opts.comparator,
     opts.column_info ? opts.column_info : DEFAULT_COLUMN_INFO,
     opts.meta_payload_provider,
+    opts.flush_pool,
+    opts.merge_pool,
+    opts.shared_memory ? opts.shared_memory : memory::make_shared<memory_accounting>(),
+    opts.consolidation,
     std::move(meta),
     std::move(comitted_state)
   );
@@ -1380,6 +1615,15 @@ index_writer::ptr index_writer::make(
 
 index_writer::~index_writer() noexcept {
   assert(!segments_active_.load()); // failure may indicate a dangling 'document' instance
+
+  if (consolidation_scheduler_) {
+    auto& scheduler = *consolidation_scheduler_;
+    std::unique_lock<std::mutex> lock(scheduler.mutex);
+    scheduler.closed = true; // tasks not started so far will never touch 'this'
+    scheduler.cond.notify_all(); // wake up throttled tasks
+    scheduler.cond.wait(lock, [&scheduler]() { return !scheduler.active; });
+  }
+
   cached_readers_.clear();
   write_lock_.reset(); // reset write lock if any
   pending_state_.reset(); // reset pending state (if any) before destroying flush contexts
@@ -1514,7 +1758,7 @@ bool index_writer::consolidate(
   consolidation_segment.meta.name = file_name(meta_.increment()); // increment active meta, not fn arg
 
   ref_tracking_directory dir(dir_); // track references for new segment
-  merge_writer merger(dir, column_info_, comparator_);
+  merge_writer merger(dir, column_info_, comparator_, merge_pool_);
   merger.reserve(candidates.size());
 
   // add consolidated segments to the merge_writer
@@ -1538,7 +1782,10 @@ bool index_writer::consolidate(
   // commit merge
   {
     SCOPED_LOCK_NAMED(commit_lock_, lock); // ensure committed_state_ segments are not modified by concurrent consolidate()/commit()
-    const auto current_committed_meta = committed_state_->first;
+    // segments flushed by reader(...) supersede the committed ones
+    const auto current_committed_meta = flushed_state_
+      ? flushed_state_->first
+      : committed_state_->first;
     assert(current_committed_meta);
 
     auto cleanup_cached_readers = [&current_committed_meta, &candidates, this]() {
@@ -1756,7 +2003,7 @@ bool index_writer::import(
   segment.meta.name = file_name(meta_.increment());
   segment.meta.codec = codec;
 
-  merge_writer merger(dir, column_info_, comparator_);
+  merge_writer merger(dir, column_info_, comparator_, merge_pool_);
   merger.reserve(reader.size());
 
   for (auto& segment : reader) {
@@ -1868,6 +2115,12 @@ index_writer::active_segment_context index_writer::get_segment_context(
   if (freelist_node) {
     assert(freelist_node->segment_.use_count() == 1); // +1 for the reference in 'pending_segment_contexts_'
     assert(!freelist_node->segment_->dirty_);
+
+    // wait for a concurrent flush due to 'memory_max' to finish
+    while (!freelist_node->segment_->idle_.exchange(false)) {
+      std::this_thread::yield();
+    }
+
     return active_segment_context(
       freelist_node->segment_, segments_active_, &ctx, freelist_node->value
     );
@@ -1882,7 +2135,7 @@ index_writer::active_segment_context index_writer::get_segment_context(
   };
   auto segment_ctx = segment_writer_pool_.emplace(
     dir_, std::move(meta_generator),
-    column_info_, comparator_
+    column_info_, comparator_, *memory_
   ).release();
   auto segment_memory_max = segment_limits_.segment_memory_max.load();
 
@@ -1890,12 +2143,77 @@ index_writer::active_segment_context index_writer::get_segment_context(
   if (segment_memory_max &&
       segment_memory_max < segment_ctx->writer_->memory_reserved()) {
     segment_ctx->writer_ = segment_writer::make(segment_ctx->dir_, column_info_, comparator_);
+    segment_ctx->update_memory();
   }
 
   return active_segment_context(segment_ctx, segments_active_);
 }
 
-index_writer::pending_context_t index_writer::flush_all() {
+/*static*/ bool index_writer::flush_largest(
+    segment_context& segment,
+    size_t memory_max) {
+  auto& accounting = *segment.memory_;
+
+  if (accounting.memory.load() < memory_max) {
+    return false;
+  }
+
+  segment_context* largest;
+
+  {
+    SCOPED_LOCK(accounting.mutex_); // prevent segments from being destroyed
+    auto& contexts = accounting.contexts_;
+    auto it = std::max_element(
+      contexts.begin(), contexts.end(),
+      [](const segment_context* lhs, const segment_context* rhs) noexcept {
+        return lhs->memory_accounted_.load() < rhs->memory_accounted_.load();
+    });
+    assert(it != contexts.end()); // at least 'segment' is registered
+    largest = *it;
+
+    if (largest == &segment
+        || segment.memory_accounted_.load() >= largest->memory_accounted_.load()) {
+      return true; // flush 'segment' in the caller
+    }
+
+    if (!largest->idle_.exchange(false)) {
+      return false; // segment is in use, will be flushed by its owner
+    }
+  }
+
+  // return segment to the free-list owner once done
+  auto release = irs::make_finally([largest]()noexcept->void {
+    largest->idle_.store(true);
+  });
+  std::unique_lock<std::recursive_mutex> lock(
+    largest->flush_mutex_, std::try_to_lock
+  );
+
+  if (!lock.owns_lock()) {
+    return false; // segment is being flushed by flush_all()
+  }
+
+  assert(largest->writer_);
+  IR_FRMT_TRACE(
+    "Flushing largest segment '%s', docs=" IR_SIZE_T_SPECIFIER ", memory=" IR_SIZE_T_SPECIFIER ", total memory=" IR_SIZE_T_SPECIFIER ", total memory limit=" IR_SIZE_T_SPECIFIER "",
+    largest->writer_meta_.meta.name.c_str(), largest->writer_->docs_cached(), largest->writer_->memory_active(), accounting.memory.load(), memory_max
+  );
+
+  try {
+    largest->flush(true);
+  } catch (...) {
+    // flush(...) restores segment state on failure, leave error reporting to
+    // the owner of the segment once it flushes the segment itself
+    IR_FRMT_ERROR(
+      "while flushing largest segment '%s', error: failed to flush segment",
+      largest->writer_meta_.meta.name.c_str()
+    );
+  }
+
+  return false;
+}
+
+index_writer::pending_context_t index_writer::flush_all(bool force /*= false*/) {
   REGISTER_TIMER_DETAILED();
   bool modified = !type_limits<type_t::index_gen_t>::valid(meta_.last_gen_);
   sync_context to_sync;
@@ -1952,10 +2270,24 @@ index_writer::pending_context_t index_writer::flush_all() {
 
     // FIXME TODO flush_all() blocks flush_context::emplace(...) and insert()/remove()/replace()
     segment_flush_locks.emplace_back(entry.segment_->flush_mutex_); // prevent concurrent modification of segment_context properties during flush_context::emplace(...)
+  }
 
-    // force a flush of the underlying segment_writer
-    max_tick = std::max(entry.segment_->flush(), max_tick);
+  // force a flush of the underlying segment_writers, segments are independent
+  // of each other and are flushed concurrently if 'flush_pool_' is set
+  {
+    auto& pending_segments = ctx->pending_segment_contexts_;
+    std::vector<uint64_t> ticks(pending_segments.size(), 0);
+
+    irs::async_utils::parallel_for(flush_pool_, pending_segments.size(), [&](size_t i) {
+      ticks[i] = pending_segments[i].segment_->flush(true); // locked above
+    });
+
+    for (auto tick : ticks) {
+      max_tick = std::max(tick, max_tick);
+    }
+  }
 
+  for (auto& entry : ctx->pending_segment_contexts_) {
     entry.doc_id_end_ = // may be integer_traits<size_t>::const_max if segment_meta only in this flush_context
       std::min(entry.segment_->uncomitted_doc_id_begin_, entry.doc_id_end_); // update so that can use valid value below
     entry.modification_offset_end_ = std::min(
@@ -2346,7 +2678,7 @@ index_writer::pending_context_t index_writer::flush_all() {
 
   pending_meta->update_generation(meta_); // clone index metadata generation
 
-  modified |= !to_sync.empty();
+  modified |= force || !to_sync.empty();
 
   // only flush a new index version upon a new index or a metadata change
   if (!modified) {
@@ -2383,7 +2715,8 @@ bool index_writer::start() {
     return false;
   }
 
-  auto to_commit = flush_all();
+  // segments flushed by reader(...) must be committed even without changes
+  auto to_commit = flush_all(bool(flushed_state_));
 
   if (!to_commit) {
     // nothing to commit, no transaction started
@@ -2417,6 +2750,17 @@ bool index_writer::start() {
     // sync all pending files
     to_commit.to_sync.visit(sync, pending_meta);
 
+    // sync files flushed by reader(...) which are still in use
+    if (!unsynced_files_.empty()) {
+      for (auto& segment : pending_meta) {
+        for (auto& file : segment.meta.files) {
+          if (unsynced_files_.count(file)) {
+            sync(file);
+          }
+        }
+      }
+    }
+
     // track all refs
     file_refs_t pending_refs;
     append_segments_refs(pending_refs, dir, pending_meta);
@@ -2449,6 +2793,56 @@ bool index_writer::start() {
   return true;
 }
 
+directory_reader index_writer::reader(
+    const directory_reader& cached /*= directory_reader()*/) {
+  SCOPED_LOCK(commit_lock_);
+
+  REGISTER_TIMER_DETAILED();
+
+  if (pending_state_) {
+    // transaction has been started, changes are flushed already
+    return directory_reader::open(dir_, *pending_state_.commit->first, cached);
+  }
+
+  auto to_flush = flush_all();
+
+  if (!to_flush) {
+    // nothing changed since the last flush
+    const auto& state = flushed_state_ ? flushed_state_ : committed_state_;
+    return directory_reader::open(dir_, *state->first, cached);
+  }
+
+  auto& dir = *to_flush.ctx->dir_;
+  auto& pending_meta = *to_flush.meta;
+
+  // files are synced with the next commit
+  to_flush.to_sync.visit([this](const std::string& file) {
+    unsynced_files_.emplace(file);
+    return true;
+  }, pending_meta);
+
+  // track all refs until the next commit
+  file_refs_t pending_refs;
+  append_segments_refs(pending_refs, dir, pending_meta);
+
+  auto flushed_state = memory::make_shared<committed_state_t::element_type>(
+    std::piecewise_construct,
+    std::forward_as_tuple(std::move(to_flush.meta)),
+    std::forward_as_tuple(std::move(pending_refs))
+  );
+
+  meta_.segments_ = flushed_state->first->segments_; // create copy
+
+  // ...........................................................................
+  // only noexcept operations below
+  // ...........................................................................
+
+  cached_readers_.purge(to_flush.ctx->segment_mask_); // release cached readers
+  flushed_state_ = std::move(flushed_state);
+
+  return directory_reader::open(dir_, *flushed_state_->first, cached);
+}
+
 void index_writer::finish() {
   assert(!commit_lock_.try_lock()); // already locked
 
@@ -2489,6 +2883,188 @@ void index_writer::finish() {
   // after here transaction successfull (only noexcept operations below)
   // ...........................................................................
   meta_.last_gen_ = committed_state_->first->gen_; // update 'last_gen_' to last commited/valid generation
+  flushed_state_.reset(); // flushed segments are committed now
+  unsynced_files_.clear();
+  schedule_consolidation();
+}
+
+bool index_writer::next_consolidation(
+    const std::vector<consolidation_policy_t>& policies,
+    std::set<std::string>& candidates,
+    size_t& size) {
+  // use atomic_load(...) since finish() may modify the pointer
+  auto committed_state = committed_state_helper::atomic_load(&committed_state_);
+  assert(committed_state);
+  const auto& committed_meta = *committed_state->first;
+
+  std::set<const segment_meta*> selected;
+  size = integer_traits<size_t>::max();
+  candidates.clear();
+
+  SCOPED_LOCK(consolidation_lock_);
+
+  for (auto& policy : policies) {
+    selected.clear();
+    policy(selected, committed_meta, consolidating_segments_);
+
+    if (selected.empty()) {
+      continue; // nothing to consolidate
+    }
+
+    size_t selected_size = 0;
+
+    for (const auto* segment : selected) {
+      if (!segment
+          || consolidating_segments_.end() != consolidating_segments_.find(segment)) {
+        selected_size = integer_traits<size_t>::max(); // invalid candidate
+        break;
+      }
+
+      selected_size += segment->size;
+    }
+
+    if (1 == selected.size()
+        && selected_size != integer_traits<size_t>::max()) {
+      const auto* segment = *selected.begin();
+
+      if (segment->live_docs_count == segment->docs_count) {
+        continue; // no deletes, nothing to consolidate
+      }
+    }
+
+    if (selected_size < size) {
+      // give priority to small consolidations
+      size = selected_size;
+      candidates.clear();
+
+      for (const auto* segment : selected) {
+        candidates.emplace(segment->name);
+      }
+    }
+  }
+
+  return !candidates.empty();
+}
+
+void index_writer::schedule_consolidation() noexcept {
+  if (!consolidation_scheduler_) {
+    return;
+  }
+
+  auto& scheduler = *consolidation_scheduler_;
+  auto& pool = *scheduler.options.pool;
+
+  try {
+    std::lock_guard<std::mutex> lock(scheduler.mutex);
+
+    if (scheduler.closed) {
+      return;
+    }
+
+    scheduler.pending = true;
+
+    const size_t max_tasks = scheduler.options.max_concurrent
+      ? scheduler.options.max_concurrent
+      : pool.max_threads();
+
+    for (auto ptr = consolidation_scheduler_; scheduler.tasks < max_tasks; ) {
+      if (!pool.run([ptr]() { run_consolidation(*ptr); })) {
+        break; // pool is stopped
+      }
+
+      ++scheduler.tasks;
+    }
+  } catch (...) {
+    IR_FRMT_ERROR("Failed to schedule background consolidation");
+  }
+}
+
+/*static*/ void index_writer::run_consolidation(
+    consolidation_scheduler& scheduler) {
+  {
+    std::lock_guard<std::mutex> lock(scheduler.mutex);
+
+    if (scheduler.closed) {
+      // writer is closed, it may be already gone
+      --scheduler.tasks;
+      return;
+    }
+
+    ++scheduler.active;
+  }
+
+  auto finish = make_finally([&scheduler]()noexcept{
+    std::lock_guard<std::mutex> lock(scheduler.mutex);
+    --scheduler.tasks;
+    --scheduler.active;
+    scheduler.cond.notify_all();
+  });
+
+  auto& writer = *scheduler.writer;
+  const auto& options = scheduler.options;
+  const auto progress = [&scheduler]()noexcept {
+    return !scheduler.closed; // abort consolidation of a closed writer
+  };
+
+  std::set<std::string> candidates;
+  const auto policy = [&candidates](
+      std::set<const segment_meta*>& selected,
+      const index_meta& meta,
+      const consolidating_segments_t&) {
+    for (auto& segment : meta) {
+      if (candidates.end() != candidates.find(segment.meta.name)) {
+        selected.emplace(&segment.meta);
+      }
+    }
+  };
+
+  try {
+    for (size_t size;;) {
+      {
+        std::lock_guard<std::mutex> lock(scheduler.mutex);
+
+        if (scheduler.closed) {
+          return;
+        }
+
+        scheduler.pending = false;
+      }
+
+      if (!writer.next_consolidation(options.policies, candidates, size)) {
+        std::lock_guard<std::mutex> lock(scheduler.mutex);
+
+        if (scheduler.pending) {
+          continue; // there was a commit since candidates were selected
+        }
+
+        return; // nothing to consolidate
+      }
+
+      if (options.max_bytes_per_second) {
+        // delay consolidation to keep the average throughput within the limit
+        typedef std::chrono::steady_clock clock_t;
+
+        std::unique_lock<std::mutex> lock(scheduler.mutex);
+        const auto start = std::max(clock_t::now(), scheduler.next_start);
+
+        scheduler.next_start = start
+          + std::chrono::duration_cast<clock_t::duration>(
+              std::chrono::duration<double>(
+                double(size) / double(options.max_bytes_per_second)));
+
+        if (scheduler.cond.wait_until(lock, start,
+                                      [&scheduler]() { return scheduler.closed.load(); })) {
+          return;
+        }
+      }
+
+      if (!writer.consolidate(policy, nullptr, progress)) {
+        return; // candidates are taken by a concurrent consolidation or failure
+      }
+    }
+  } catch (...) {
+    IR_FRMT_ERROR("Caught exception while running background consolidation");
+  }
 }
 
 void index_writer::abort() {
@@ -2508,8 +3084,9 @@ void index_writer::abort() {
   pending_state_.reset();
 
   // reset actual meta, note that here we don't change
-  // segment counters since it can be changed from insert function
-  meta_.reset(*(committed_state_->first));
+  // segment counters since it can be changed from insert function,
+  // segments flushed by reader(...) are kept for the next commit
+  meta_.reset(*(flushed_state_ ? flushed_state_ : committed_state_)->first);
 }
 
 }
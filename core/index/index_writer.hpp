@@ -26,6 +26,7 @@
 
 #include "field_meta.hpp"
 #include "column_info.hpp"
+#include "directory_reader.hpp"
 #include "index_meta.hpp"
 #include "merge_writer.hpp"
 #include "segment_reader.hpp"
@@ -404,6 +405,91 @@ class IRESEARCH_API index_writer
 
   static_assert(std::is_nothrow_move_constructible_v<modification_context>);
 
+  struct segment_hash {
+    size_t operator()(const segment_meta* segment) const noexcept {
+      return hash_utils::hash(segment->name);
+    }
+  }; // segment_hash
+
+  struct segment_equal {
+    size_t operator()(const segment_meta* lhs,
+                      const segment_meta* rhs) const noexcept {
+      return lhs->name == rhs->name;
+    }
+  }; // segment_equal
+
+  // works faster than std::unordered_set<string_ref>
+  typedef std::unordered_set<
+    const segment_meta*,
+    segment_hash,
+    segment_equal
+  > consolidating_segments_t; // segments that are under consolidation
+
+  ////////////////////////////////////////////////////////////////////////////
+  /// @brief mark consolidation candidate segments matching the current policy
+  /// @param candidates the segments that should be consolidated
+  ///        in: segment candidates that may be considered by this policy
+  ///        out: actual segments selected by the current policy
+  /// @param dir the segment directory
+  /// @param meta the index meta containing segments to be considered
+  /// @param consolidating_segments segments that are currently in progress
+  ///        of consolidation
+  /// @note final candidates are all segments selected by at least some policy
+  ////////////////////////////////////////////////////////////////////////////
+  typedef std::function<void(
+    std::set<const segment_meta*>& candidates,
+    const index_meta& meta,
+    const consolidating_segments_t& consolidating_segments
+  )> consolidation_policy_t;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief options of the consolidation run in background after commits
+  //////////////////////////////////////////////////////////////////////////////
+  struct consolidation_options {
+    ////////////////////////////////////////////////////////////////////////////
+    /// @brief policies selecting segments for consolidation, among all
+    ///        selections the one with the smallest total size runs first
+    ///        empty == no background consolidation
+    ////////////////////////////////////////////////////////////////////////////
+    std::vector<consolidation_policy_t> policies;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// @brief threads running background consolidation, the pool must outlive
+    ///        the writer
+    ///        nullptr == no background consolidation
+    ////////////////////////////////////////////////////////////////////////////
+    async_utils::thread_pool* pool{nullptr};
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// @brief max number of consolidations running at the same time
+    ///        0 == limited by the number of threads in the pool only
+    ////////////////////////////////////////////////////////////////////////////
+    size_t max_concurrent{1};
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// @brief max number of bytes of segments consolidated per second,
+    ///        consolidation start is delayed to stay within the limit
+    ///        0 == unlimited
+    ////////////////////////////////////////////////////////////////////////////
+    size_t max_bytes_per_second{0};
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief in-memory size of segments accounted against
+  ///        'segment_options::memory_max', may be shared by several writers in
+  ///        order to limit their total memory
+  //////////////////////////////////////////////////////////////////////////////
+  struct memory_accounting {
+    std::atomic<size_t> memory{0}; // total in-memory size of segments in bytes
+    std::atomic<size_t> segments{0}; // number of segments holding memory
+
+   private:
+    friend class index_writer;
+
+    std::mutex mutex_; // guard for 'contexts_'
+    std::vector<segment_context*> contexts_; // all segments accounted here, used for finding the largest one
+  };
+
   //////////////////////////////////////////////////////////////////////////////
   /// @brief options the the writer should use for segments
   //////////////////////////////////////////////////////////////////////////////
@@ -430,6 +516,16 @@ class IRESEARCH_API index_writer
     ///        0 == unlimited
     ////////////////////////////////////////////////////////////////////////////
     size_t segment_memory_max{0};
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// @brief flush the largest in-memory segments to the repository after the
+    ///        in-memory size of all segments of the writer (or of all writers
+    ///        sharing 'init_options::shared_memory') grows beyond this byte
+    ///        limit, in-flight documents will still be written to a segment
+    ///        before flush
+    ///        0 == unlimited
+    ////////////////////////////////////////////////////////////////////////////
+    size_t memory_max{0};
   };
 
   ////////////////////////////////////////////////////////////////////////////
@@ -471,6 +567,36 @@ class IRESEARCH_API index_writer
     ////////////////////////////////////////////////////////////////////////////
     size_t segment_pool_size{128}; // arbitrary size
 
+    ////////////////////////////////////////////////////////////////////////////
+    /// @brief threads used along with the committing thread for flushing
+    ///        pending segments concurrently during commit, the pool must
+    ///        outlive the writer
+    ///        nullptr == flush segments one after another
+    ////////////////////////////////////////////////////////////////////////////
+    async_utils::thread_pool* flush_pool{nullptr};
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// @brief threads used along with the merging thread for writing columns
+    ///        and fields of a consolidated or imported segment concurrently,
+    ///        the pool must outlive the writer, progress callbacks passed to
+    ///        consolidate(...)/import(...) must be thread-safe in this case
+    ///        nullptr == write columns and fields one after another
+    ////////////////////////////////////////////////////////////////////////////
+    async_utils::thread_pool* merge_pool{nullptr};
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// @brief in-memory size of segments of all writers sharing the instance,
+    ///        limited by 'segment_options::memory_max' of each writer
+    ///        nullptr == account segments of the writer separately
+    ////////////////////////////////////////////////////////////////////////////
+    std::shared_ptr<memory_accounting> shared_memory;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// @brief consolidation run in background after every successful commit,
+    ///        its results become visible to readers with the next commit
+    ////////////////////////////////////////////////////////////////////////////
+    consolidation_options consolidation;
+
     ////////////////////////////////////////////////////////////////////////////
     /// @brief aquire an exclusive lock on the repository to guard against index
     ///        corruption from multiple index_writers
@@ -480,45 +606,8 @@ class IRESEARCH_API index_writer
     init_options() {} // GCC5 requires non-default definition
   };
 
-  struct segment_hash {
-    size_t operator()(const segment_meta* segment) const noexcept {
-      return hash_utils::hash(segment->name);
-    }
-  }; // segment_hash
-
-  struct segment_equal {
-    size_t operator()(const segment_meta* lhs,
-                      const segment_meta* rhs) const noexcept {
-      return lhs->name == rhs->name;
-    }
-  }; // segment_equal
-
-  // works faster than std::unordered_set<string_ref>
-  typedef std::unordered_set<
-    const segment_meta*,
-    segment_hash,
-    segment_equal
-  > consolidating_segments_t; // segments that are under consolidation
-
   using ptr = std::shared_ptr<index_writer>;
 
-  ////////////////////////////////////////////////////////////////////////////
-  /// @brief mark consolidation candidate segments matching the current policy
-  /// @param candidates the segments that should be consolidated
-  ///        in: segment candidates that may be considered by this policy
-  ///        out: actual segments selected by the current policy
-  /// @param dir the segment directory
-  /// @param meta the index meta containing segments to be considered
-  /// @param consolidating_segments segments that are currently in progress
-  ///        of consolidation
-  /// @note final candidates are all segments selected by at least some policy
-  ////////////////////////////////////////////////////////////////////////////
-  typedef std::function<void(
-    std::set<const segment_meta*>& candidates,
-    const index_meta& meta,
-    const consolidating_segments_t& consolidating_segments
-  )> consolidation_policy_t;
-
   ////////////////////////////////////////////////////////////////////////////
   /// @brief name of the lock for index repository 
   ////////////////////////////////////////////////////////////////////////////
@@ -650,6 +739,20 @@ class IRESEARCH_API index_writer
     finish();
   }
 
+  ////////////////////////////////////////////////////////////////////////////
+  /// @brief make all buffered changes visible for the returned reader without
+  ///        committing them, i.e. buffered documents are flushed into
+  ///        segments but neither synced nor referenced by an index meta file
+  ///        (near-real-time reader)
+  /// @param cached reader to reuse unchanged segments from, e.g. returned by
+  ///        a previous call
+  /// @note flushed changes become durable with the next commit(), same as
+  ///       buffered ones they survive rollback() of a started transaction
+  /// @note if begin() has been already called the returned reader reflects
+  ///       the state of the started transaction
+  ////////////////////////////////////////////////////////////////////////////
+  directory_reader reader(const directory_reader& cached = directory_reader());
+
   ////////////////////////////////////////////////////////////////////////////
   /// @brief clears index writer's reader cache
   ////////////////////////////////////////////////////////////////////////////
@@ -815,15 +918,21 @@ class IRESEARCH_API index_writer
     size_t uncomitted_modification_queries_; // staring offset in 'modification_queries_' that is not part of the current flush_context
     segment_writer::ptr writer_;
     index_meta::index_segment_t writer_meta_; // the segment_meta this writer was initialized with
+    memory_accounting* memory_; // where in-memory size of 'writer_' is accounted
+    std::atomic<size_t> memory_accounted_{}; // in-memory size of 'writer_' accounted in 'memory_' (read by threads looking for the largest segment)
+    std::atomic<bool> idle_{false}; // true while the segment is in a flush_context free-list, cleared by the thread taking the segment for insertion or for a flush due to 'memory_max'
 
-    DECLARE_FACTORY(directory& dir, segment_meta_generator_t&& meta_generator, const column_info_provider_t& column_info, const comparer* comparator);
-    segment_context(directory& dir, segment_meta_generator_t&& meta_generator, const column_info_provider_t& column_info, const comparer* comparator);
+    DECLARE_FACTORY(directory& dir, segment_meta_generator_t&& meta_generator, const column_info_provider_t& column_info, const comparer* comparator, memory_accounting& memory);
+    segment_context(directory& dir, segment_meta_generator_t&& meta_generator, const column_info_provider_t& column_info, const comparer* comparator, memory_accounting& memory);
+    ~segment_context();
 
     ////////////////////////////////////////////////////////////////////////////
     /// @brief flush current writer state into a materialized segment
+    /// @param locked 'flush_mutex_' is already held on behalf of the caller,
+    ///        e.g. by the thread dispatching flush to a thread pool
     /// @return tick of last committed transaction
     ////////////////////////////////////////////////////////////////////////////
-    uint64_t flush();
+    uint64_t flush(bool locked = false);
 
     // returns context for "insert" operation
     segment_writer::update_context make_update_context();
@@ -847,21 +956,30 @@ class IRESEARCH_API index_writer
     /// @brief reset segment state to the initial state
     ////////////////////////////////////////////////////////////////////////////
     void reset() noexcept;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// @brief account current in-memory size of 'writer_' in 'memory_'
+    /// @return accounted in-memory size of 'writer_'
+    ////////////////////////////////////////////////////////////////////////////
+    size_t update_memory() noexcept;
   };
 
   struct segment_limits {
     std::atomic<size_t> segment_count_max; // @see segment_options::max_segment_count
     std::atomic<size_t> segment_docs_max; // @see segment_options::max_segment_docs
     std::atomic<size_t> segment_memory_max; // @see segment_options::max_segment_memory
+    std::atomic<size_t> memory_max; // @see segment_options::memory_max
     segment_limits(const segment_options& opts) noexcept
       : segment_count_max(opts.segment_count_max),
         segment_docs_max(opts.segment_docs_max),
-        segment_memory_max(opts.segment_memory_max) {
+        segment_memory_max(opts.segment_memory_max),
+        memory_max(opts.memory_max) {
     }
     segment_limits& operator=(const segment_options& opts) noexcept {
       segment_count_max.store(opts.segment_count_max);
       segment_docs_max.store(opts.segment_docs_max);
       segment_memory_max.store(opts.segment_memory_max);
+      memory_max.store(opts.memory_max);
       return *this;
     }
   };
@@ -1032,19 +1150,43 @@ class IRESEARCH_API index_writer
     const comparer* comparator,
     const column_info_provider_t& column_info,
     const payload_provider_t& meta_payload_provider,
+    async_utils::thread_pool* flush_pool,
+    async_utils::thread_pool* merge_pool,
+    std::shared_ptr<memory_accounting> memory,
+    const consolidation_options& consolidation,
     index_meta&& meta,
     committed_state_t&& committed_state
   );
 
-  pending_context_t flush_all();
+  pending_context_t flush_all(bool force = false); // force == produce pending context even without changes
 
   flush_context_ptr get_flush_context(bool shared = true);
   active_segment_context get_segment_context(flush_context& ctx); // return a usable segment or a nullptr segment if retry is required (e.g. no free segments available)
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief flush the largest of the segments sharing memory accounting with
+  ///        'segment' if the total in-memory size reached 'memory_max'
+  /// @return true if 'segment' itself is the largest one and should be flushed
+  ///         by the caller
+  /// @note the largest segment is flushed in place only if it is idle, a
+  ///       segment in use is left to its owner to flush on its next insertion
+  //////////////////////////////////////////////////////////////////////////////
+  static bool flush_largest(segment_context& segment, size_t memory_max);
+
   bool start(); // starts transaction
   void finish(); // finishes transaction
   void abort(); // aborts transaction
 
+  struct consolidation_scheduler; // state of background consolidation
+
+  // selects the smallest consolidation among the ones offered by 'policies'
+  bool next_consolidation(
+    const std::vector<consolidation_policy_t>& policies,
+    std::set<std::string>& candidates,
+    size_t& size);
+  void schedule_consolidation() noexcept; // starts background consolidation
+  static void run_consolidation(consolidation_scheduler& scheduler);
+
   IRESEARCH_API_PRIVATE_VARIABLES_BEGIN
   column_info_provider_t column_info_;
   payload_provider_t meta_payload_provider_; // provides payload for new segments
@@ -1055,12 +1197,18 @@ class IRESEARCH_API index_writer
   committed_state_t committed_state_; // last successfully committed state
   std::recursive_mutex consolidation_lock_;
   consolidating_segments_t consolidating_segments_; // segments that are under consolidation
+  std::shared_ptr<consolidation_scheduler> consolidation_scheduler_; // background consolidation (optional)
   directory& dir_; // directory used for initialization of readers
   std::vector<flush_context> flush_context_pool_; // collection of contexts that collect data to be flushed, 2 because just swap them
   std::atomic<flush_context*> flush_context_; // currently active context accumulating data to be processed during the next flush
+  async_utils::thread_pool* flush_pool_; // threads for concurrent flush of segments during commit (optional)
+  async_utils::thread_pool* merge_pool_; // threads for concurrent writing of merged segments (optional)
   index_meta meta_; // latest/active state of index metadata
   pending_state_t pending_state_; // current state awaiting commit completion
+  committed_state_t flushed_state_; // state flushed by reader(...) since the last commit (optional)
+  std::set<std::string> unsynced_files_; // files flushed by reader(...) since the last commit
   segment_limits segment_limits_; // limits for use with respect to segments
+  std::shared_ptr<memory_accounting> memory_; // in-memory size of segments (declared before 'segment_writer_pool_' to outlive segments)
   segment_pool_t segment_writer_pool_; // a cache of segments available for reuse
   std::atomic<size_t> segments_active_; // number of segments currently in use by the writer
   index_meta_writer::ptr writer_;
@@ -21,7 +21,9 @@
 /// @author Vasiliy Nabatchikov
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <condition_variable>
 #include <deque>
+#include <mutex>
 #include <unordered_map>
 
 #include "merge_writer.hpp"
@@ -31,6 +33,7 @@
 #include "index/segment_reader.hpp"
 #include "index/heap_iterator.hpp"
 #include "index/comparer.hpp"
+#include "utils/async_utils.hpp"
 #include "utils/directory_utils.hpp"
 #include "utils/log.hpp"
 #include "utils/lz4compression.hpp"
@@ -265,6 +268,64 @@ bool compound_doc_iterator::next() {
   return false;
 }
 
+//////////////////////////////////////////////////////////////////////////////
+/// @class quantized_norm_doc_iterator
+/// @brief exposes 'quantized_norm' for postings of a segment which doesn't
+///        store normalization factors inline, values are read from the
+///        'norm' column only if requested by a postings writer
+//////////////////////////////////////////////////////////////////////////////
+class quantized_norm_doc_iterator final : public irs::doc_iterator {
+ public:
+  quantized_norm_doc_iterator(
+      irs::doc_iterator::ptr&& it,
+      const irs::sub_reader& segment,
+      irs::field_id norm)
+    : it_(std::move(it)) {
+    assert(it_);
+    auto* doc = irs::get<irs::document>(*it_);
+
+    if (doc && !norm_.reset(segment, norm, *doc)) {
+      norm_.clear();
+    }
+  }
+
+  virtual irs::attribute* get_mutable(irs::type_info::type_id type) noexcept override {
+    if (irs::type<irs::quantized_norm>::id() == type) {
+      requested_ = !norm_.empty();
+      return requested_ ? &quantized_norm_ : nullptr;
+    }
+
+    return it_->get_mutable(type);
+  }
+
+  virtual bool next() override {
+    if (!it_->next()) {
+      return false;
+    }
+
+    if (requested_) {
+      quantized_norm_.value = norm_.read_quantized();
+    }
+
+    return true;
+  }
+
+  virtual irs::doc_id_t seek(irs::doc_id_t target) override {
+    irs::seek(*this, target);
+    return value();
+  }
+
+  virtual irs::doc_id_t value() const noexcept override {
+    return it_->value();
+  }
+
+ private:
+  irs::doc_iterator::ptr it_;
+  irs::norm norm_;
+  irs::quantized_norm quantized_norm_;
+  bool requested_{};
+}; // quantized_norm_doc_iterator
+
 //////////////////////////////////////////////////////////////////////////////
 /// @struct sorting_compound_doc_iterator
 /// @brief iterator over sorted doc_ids for a term over all readers
@@ -514,7 +575,9 @@ class compound_term_iterator : public irs::term_iterator {
   }
 
   const irs::field_meta& meta() const noexcept { return *meta_; }
-  void add(const irs::term_reader& reader, const doc_map_f& doc_map);
+  void add(const irs::sub_reader& segment,
+           const irs::term_reader& reader,
+           const doc_map_f& doc_map);
   virtual irs::attribute* get_mutable(irs::type_info::type_id) noexcept override {
     // no way to merge attributes for the same term spread over multiple iterators
     // would require API change for attributes
@@ -537,11 +600,16 @@ class compound_term_iterator : public irs::term_iterator {
   struct term_iterator_t {
     irs::seek_term_iterator::ptr first;
     const doc_map_f* second;
+    const irs::sub_reader* segment;
+    const irs::field_meta* meta;
 
     term_iterator_t(
         irs::seek_term_iterator::ptr&& term_itr,
-        const doc_map_f* doc_map)
-      : first(std::move(term_itr)), second(doc_map) {
+        const doc_map_f* doc_map,
+        const irs::sub_reader* segment,
+        const irs::field_meta* meta)
+      : first(std::move(term_itr)), second(doc_map),
+        segment(segment), meta(meta) {
     }
 
     // GCC 8.1.0/8.2.0 optimized code requires an *explicit* noexcept non-inlined
@@ -549,7 +617,8 @@ class compound_term_iterator : public irs::term_iterator {
     // optimized out (https://gcc.gnu.org/bugzilla/show_bug.cgi?id=87665)
     GCC8_12_OPTIMIZED_WORKAROUND(__attribute__((noinline)))
     term_iterator_t(term_iterator_t&& other) noexcept
-      : first(std::move(other.first)), second(std::move(other.second)) {
+      : first(std::move(other.first)), second(std::move(other.second)),
+        segment(other.segment), meta(other.meta) {
     }
   };
 
@@ -567,10 +636,11 @@ class compound_term_iterator : public irs::term_iterator {
 }; // compound_term_iterator
 
 void compound_term_iterator::add(
+    const irs::sub_reader& segment,
     const irs::term_reader& reader,
     const doc_map_f& doc_id_map) {
   term_iterator_mask_.emplace_back(term_iterators_.size()); // mark as used to trigger next()
-  term_iterators_.emplace_back(reader.iterator(), &doc_id_map);
+  term_iterators_.emplace_back(reader.iterator(), &doc_id_map, &segment, &reader.meta());
 }
 
 bool compound_term_iterator::next() {
@@ -619,14 +689,25 @@ bool compound_term_iterator::next() {
 }
 
 irs::doc_iterator::ptr compound_term_iterator::postings(const irs::flags& /*features*/) const {
-  auto add_iterators = [this](compound_doc_iterator::iterators_t& itrs) {
+  // postings writer may store normalization factors along with frequencies
+  const bool norms = meta().features.check<irs::frequency>()
+                  && meta().features.check<irs::norm>();
+
+  auto add_iterators = [this, norms](compound_doc_iterator::iterators_t& itrs) {
     itrs.clear();
     itrs.reserve(term_iterator_mask_.size());
 
     for (auto& itr_id : term_iterator_mask_) {
       auto& term_itr = term_iterators_[itr_id];
+      auto it = term_itr.first->postings(meta().features);
+
+      if (norms && !irs::get<irs::quantized_norm>(*it)) {
+        // segment doesn't store normalization factors within postings
+        it = irs::memory::make_managed<quantized_norm_doc_iterator>(
+          std::move(it), *term_itr.segment, term_itr.meta->norm);
+      }
 
-      itrs.emplace_back(term_itr.first->postings(meta().features), term_itr.second);
+      itrs.emplace_back(std::move(it), term_itr.second);
     }
 
     return true;
@@ -822,7 +903,8 @@ irs::term_iterator::ptr compound_field_iterator::iterator() const {
   term_itr_.reset(meta());
 
   for (auto& segment : field_iterator_mask_) {
-    term_itr_.add(*(segment.reader), *(field_iterators_[segment.itr_id].doc_map));
+    auto& field_itr = field_iterators_[segment.itr_id];
+    term_itr_.add(*(field_itr.reader), *(segment.reader), *(field_itr.doc_map));
   }
 
   return irs::memory::to_managed<irs::term_iterator, false>(&term_itr_);
@@ -853,6 +935,31 @@ bool compute_field_meta(
   return true;
 }
 
+//////////////////////////////////////////////////////////////////////////////
+/// @struct column_chunk
+/// @brief live values of a column of merging segments remapped to documents
+///        of a merged segment, a column is passed from a thread reading it
+///        to a thread writing it a chunk at a time
+//////////////////////////////////////////////////////////////////////////////
+struct column_chunk {
+  // preferred memory used by a chunk
+  static constexpr size_t MAX_SIZE = size_t(1) << 16;
+
+  // memory used by a chunk
+  size_t size() const noexcept {
+    return data.size() + docs.size() * sizeof(decltype(docs)::value_type);
+  }
+
+  void clear() noexcept {
+    docs.clear();
+    data.clear();
+  }
+
+  std::vector<std::pair<irs::doc_id_t, size_t>> docs; // document and the end
+                                                       // of its value in 'data'
+  irs::bstring data;
+}; // column_chunk
+
 //////////////////////////////////////////////////////////////////////////////
 /// @struct columnstore
 /// @brief Helper class responsible for writing a data from different sources
@@ -917,6 +1024,26 @@ class columnstore {
     });
   }
 
+  // inserts values of the specified 'chunk' into column
+  bool insert(const column_chunk& chunk) {
+    size_t begin = 0;
+
+    for (auto& doc : chunk.docs) {
+      if (!progress_()) {
+        // stop was requsted
+        return false;
+      }
+
+      empty_ = false;
+
+      auto& out = column_.second(doc.first);
+      out.write_bytes(chunk.data.c_str() + begin, doc.second - begin);
+      begin = doc.second;
+    }
+
+    return true;
+  }
+
   // inserts live values from the specified 'iterator' into column
   bool insert(irs::doc_iterator& it) {
     const irs::payload* payload = nullptr;
@@ -977,6 +1104,220 @@ class columnstore {
   bool empty_{ false };
 }; // columnstore
 
+//////////////////////////////////////////////////////////////////////////////
+/// @class column_pipeline
+/// @brief reads live values of columns of merging segments concurrently and
+///        hands them over a chunk at a time to the columnstore, which is
+///        written by a single thread at a time in order of columns
+/// @note the column being written is streamed through a chunk, columns
+///       following it are read ahead until 'MAX_BUFFERED_BYTES' of their
+///       chunks are kept in memory, thus memory used doesn't depend on
+///       the size of merged columns
+//////////////////////////////////////////////////////////////////////////////
+class column_pipeline : irs::util::noncopyable {
+ public:
+  // max number of bytes of chunks read ahead
+  static constexpr size_t MAX_BUFFERED_BYTES = size_t(1) << 24;
+
+  struct source {
+    const irs::sub_reader* segment;
+    const doc_map_f* doc_map;
+    irs::field_id id;
+  };
+
+  explicit column_pipeline(columnstore& cs) noexcept
+    : cs_(&cs) {
+  }
+
+  // adds a column made of the specified sources
+  void add(std::vector<source>&& sources) {
+    columns_.emplace_back();
+    columns_.back().sources = std::move(sources);
+  }
+
+  size_t size() const noexcept { return columns_.size(); }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief reads columns by the calling thread and the threads of 'pool',
+  ///        'reset(i)' is called before values of the i-th column are
+  ///        inserted into the columnstore, 'flush(i)' once all of them are
+  //////////////////////////////////////////////////////////////////////////////
+  template<typename ResetFunc, typename FlushFunc>
+  bool run(
+      irs::async_utils::thread_pool& pool,
+      const ResetFunc& reset,
+      const FlushFunc& flush) {
+    const auto write = [this, &reset, &flush]() {
+      return this->write(reset, flush);
+    };
+
+    irs::async_utils::parallel_for(&pool, columns_.size(), [&](size_t i) {
+      try {
+        if (!read(i, write)) {
+          fail();
+        }
+      } catch (...) {
+        fail(); // wake up threads waiting for the failed one
+        throw;
+      }
+    });
+
+    assert(failed_ || head_ == columns_.size());
+    return !failed_;
+  }
+
+ private:
+  struct column {
+    std::vector<source> sources;
+    std::deque<column_chunk> chunks; // read ahead, guarded by 'mutex_'
+    bool read{false}; // all values are read, guarded by 'mutex_'
+  };
+
+  void fail() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    failed_ = true;
+    cond_.notify_all();
+  }
+
+  // reads values of the i-th column
+  template<typename WriteFunc>
+  bool read(size_t i, const WriteFunc& write) {
+    column_chunk chunk;
+
+    for (auto& src : columns_[i].sources) {
+      const auto* column_reader = src.segment->column_reader(src.id);
+
+      if (!column_reader) {
+        continue;
+      }
+
+      const auto& doc_map = *src.doc_map;
+
+      const auto visitor = [&](irs::doc_id_t doc, const irs::bytes_ref& in) {
+        const auto mapped_doc = doc_map(doc);
+
+        if (irs::doc_limits::eof(mapped_doc)) {
+          // skip deleted document
+          return true;
+        }
+
+        chunk.data.append(in.c_str(), in.size());
+        chunk.docs.emplace_back(mapped_doc, chunk.data.size());
+
+        return chunk.size() < column_chunk::MAX_SIZE
+          || push(i, chunk, false, write);
+      };
+
+      if (!column_reader->visit(visitor)) {
+        return false;
+      }
+    }
+
+    return push(i, chunk, true, write);
+  }
+
+  // passes a chunk of the i-th column over to the writing thread
+  template<typename WriteFunc>
+  bool push(size_t i, column_chunk& chunk, bool last, const WriteFunc& write) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+
+      // don't read too far ahead of the column being written
+      cond_.wait(lock, [this, i, &chunk]() {
+        return failed_
+          || head_ == i
+          || buffered_ + chunk.size() <= MAX_BUFFERED_BYTES;
+      });
+
+      if (failed_) {
+        return false;
+      }
+
+      auto& column = columns_[i];
+
+      if (!chunk.docs.empty()) {
+        buffered_ += chunk.size();
+        column.chunks.emplace_back(std::move(chunk));
+        chunk.clear();
+      }
+
+      column.read = last;
+
+      if (head_ != i) {
+        // chunks are written once the column becomes the one being written
+        return true;
+      }
+    }
+
+    return write();
+  }
+
+  // writes chunks of the columns in order until a column which isn't
+  // read yet is met
+  template<typename ResetFunc, typename FlushFunc>
+  bool write(const ResetFunc& reset, const FlushFunc& flush) {
+    std::lock_guard<std::mutex> write_lock(write_mutex_);
+
+    for (;;) {
+      size_t i;
+      column_chunk chunk;
+      bool last = false;
+
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (failed_) {
+          return false;
+        }
+
+        if (head_ == columns_.size()) {
+          return true;
+        }
+
+        i = head_;
+        auto& column = columns_[i];
+
+        if (!column.chunks.empty()) {
+          chunk = std::move(column.chunks.front());
+          column.chunks.pop_front();
+          buffered_ -= chunk.size();
+          cond_.notify_all();
+        } else if (column.read) {
+          last = true;
+        } else {
+          return true; // the column is still being read
+        }
+      }
+
+      if (!started_) {
+        reset(i);
+        started_ = true;
+      }
+
+      if (last) {
+        flush(i);
+        started_ = false;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++head_;
+        cond_.notify_all();
+      } else if (!cs_->insert(chunk)) {
+        return false; // failed to insert all values
+      }
+    }
+  }
+
+  std::vector<column> columns_;
+  std::mutex mutex_;
+  std::condition_variable cond_;
+  std::mutex write_mutex_; // held by the thread writing the columnstore
+  columnstore* cs_;
+  size_t head_{}; // column being written, guarded by 'mutex_'
+  size_t buffered_{}; // bytes of chunks read ahead, guarded by 'mutex_'
+  bool started_{false}; // head column is reset, guarded by 'write_mutex_'
+  bool failed_{false}; // guarded by 'mutex_'
+}; // column_pipeline
+
 //////////////////////////////////////////////////////////////////////////////
 /// @struct sorting_compound_column_iterator
 //////////////////////////////////////////////////////////////////////////////
@@ -1066,9 +1407,8 @@ template<typename CompoundIterator>
 bool write_columns(
     columnstore& cs,
     CompoundIterator& columns,
-    irs::directory& dir,
+    irs::column_meta_writer& column_meta_writer,
     const irs::column_info_provider_t& column_info,
-    const irs::segment_meta& meta,
     compound_column_meta_iterator_t& column_meta_itr,
     const irs::merge_writer::flush_progress_t& progress) {
   REGISTER_TIMER_DETAILED();
@@ -1094,9 +1434,6 @@ bool write_columns(
     return column_meta_itr.visit(add_iterators);
   };
 
-  auto column_meta_writer = meta.codec->get_column_meta_writer();
-  column_meta_writer->prepare(dir, meta);
-
   while (column_meta_itr.next()) {
     const auto& column_name = (*column_meta_itr).name;
     cs.reset(column_info(column_name));
@@ -1112,11 +1449,11 @@ bool write_columns(
     }
 
     if (!cs.empty()) {
-      column_meta_writer->write(column_name, cs.id());
+      column_meta_writer.write(column_name, cs.id());
     }
   }
 
-  column_meta_writer->flush();
+  column_meta_writer.flush();
 
   return true;
 }
@@ -1126,9 +1463,8 @@ bool write_columns(
 //////////////////////////////////////////////////////////////////////////////
 bool write_columns(
     columnstore& cs,
-    irs::directory& dir,
+    irs::column_meta_writer& cmw,
     const irs::column_info_provider_t& column_info,
-    const irs::segment_meta& meta,
     compound_column_meta_iterator_t& column_itr,
     const irs::merge_writer::flush_progress_t& progress) {
   REGISTER_TIMER_DETAILED();
@@ -1142,10 +1478,6 @@ bool write_columns(
     return cs.insert(segment, column.id, doc_map);
   };
 
-  auto cmw = meta.codec->get_column_meta_writer();
-
-  cmw->prepare(dir, meta);
-
   while (column_itr.next()) {
     const auto& column_name = (*column_itr).name;
     cs.reset(column_info(column_name));
@@ -1157,29 +1489,78 @@ bool write_columns(
     }
 
     if (!cs.empty()) {
-      cmw->write(column_name, cs.id());
+      cmw.write(column_name, cs.id());
     } 
   }
 
-  cmw->flush();
+  cmw.flush();
 
   return true;
 }
 
 //////////////////////////////////////////////////////////////////////////////
-/// @brief write field term data
+/// @brief write columnstore, columns are read and decompressed concurrently
+///        and appended sequentially via 'column_pipeline'
 //////////////////////////////////////////////////////////////////////////////
-bool write_fields(
+bool write_columns(
+    irs::async_utils::thread_pool& pool,
     columnstore& cs,
-    irs::directory& dir,
-    const irs::segment_meta& meta,
-    compound_field_iterator& field_itr,
-    const irs::flags& fields_features,
-    const irs::merge_writer::flush_progress_t& progress
-) {
+    irs::column_meta_writer& cmw,
+    const irs::column_info_provider_t& column_info,
+    compound_column_meta_iterator_t& column_itr,
+    const irs::merge_writer::flush_progress_t& progress) {
   REGISTER_TIMER_DETAILED();
   assert(cs);
+  assert(progress);
+
+  column_pipeline columns(cs);
+  std::vector<std::string> names;
 
+  while (column_itr.next()) {
+    std::vector<column_pipeline::source> sources;
+
+    auto visitor = [&sources](
+        const irs::sub_reader& segment,
+        const doc_map_f& doc_map,
+        const irs::column_meta& meta) {
+      sources.push_back({ &segment, &doc_map, meta.id });
+      return true;
+    };
+
+    if (!progress() || !column_itr.visit(visitor)) {
+      return false;
+    }
+
+    names.emplace_back((*column_itr).name);
+    columns.add(std::move(sources));
+  }
+
+  const auto reset = [&cs, &column_info, &names](size_t i) {
+    cs.reset(column_info(names[i]));
+  };
+
+  const auto flush = [&cs, &cmw, &names](size_t i) {
+    if (!cs.empty()) {
+      cmw.write(names[i], cs.id());
+    }
+  };
+
+  if (!columns.run(pool, reset, flush)) {
+    return false; // failed to insert all values
+  }
+
+  cmw.flush();
+
+  return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+/// @brief prepare writer of field term data
+//////////////////////////////////////////////////////////////////////////////
+irs::field_writer::ptr prepare_field_writer(
+    irs::directory& dir,
+    const irs::segment_meta& meta,
+    const irs::flags& fields_features) {
   irs::flush_state flush_state;
   flush_state.dir = &dir;
   flush_state.doc_count = meta.docs_count;
@@ -1189,18 +1570,79 @@ bool write_fields(
   auto field_writer = meta.codec->get_field_writer(true);
   field_writer->prepare(flush_state);
 
-  auto merge_norms = [&cs] (
-      const irs::sub_reader& segment,
-      const doc_map_f& doc_map,
-      const irs::field_meta& field) {
-    // merge field norms if present
-    if (irs::field_limits::valid(field.norm)
-        && !cs.insert(segment, field.norm, doc_map)) {
-      return false;
-    }
+  return field_writer;
+}
 
-    return true;
+//////////////////////////////////////////////////////////////////////////////
+/// @returns functor merging norms of the current field into 'cs'
+//////////////////////////////////////////////////////////////////////////////
+auto norms_writer(columnstore& cs) {
+  return [&cs](const compound_field_iterator& field_itr) {
+    auto merge_norms = [&cs] (
+        const irs::sub_reader& segment,
+        const doc_map_f& doc_map,
+        const irs::field_meta& field) {
+      // merge field norms if present
+      if (irs::field_limits::valid(field.norm)
+          && !cs.insert(segment, field.norm, doc_map)) {
+        return false;
+      }
+
+      return true;
+    };
+
+    return field_itr.visit(merge_norms);
+  };
+}
+
+//////////////////////////////////////////////////////////////////////////////
+/// @returns functor merging norms of the current field into 'cs'
+///          via the specified compound iterator
+//////////////////////////////////////////////////////////////////////////////
+template<typename CompoundIterator>
+auto norms_writer(columnstore& cs, CompoundIterator& norms) {
+  return [&cs, &norms](const compound_field_iterator& field_itr) {
+    auto add_iterators = [&field_itr](compound_doc_iterator::iterators_t& itrs) {
+      auto add_iterators = [&itrs](
+          const irs::sub_reader& segment,
+          const doc_map_f& doc_map,
+          const irs::field_meta& field) {
+        if (!irs::field_limits::valid(field.norm)) {
+          // field has no norms
+          return true;
+        }
+
+        auto* reader = segment.column_reader(field.norm);
+
+        if (!reader) {
+          return false;
+        }
+
+        itrs.emplace_back(reader->iterator(), &doc_map);
+        return true;
+      };
+
+      itrs.clear();
+      return field_itr.visit(add_iterators);
+    };
+
+    return norms.reset(add_iterators)
+      && cs.insert(norms); // failed to insert all values otherwise
   };
+}
+
+//////////////////////////////////////////////////////////////////////////////
+/// @brief write field norms and field term data
+//////////////////////////////////////////////////////////////////////////////
+template<typename NormsWriter>
+bool write_fields(
+    columnstore& cs,
+    irs::field_writer& field_writer,
+    compound_field_iterator& field_itr,
+    const NormsWriter& merge_norms,
+    const irs::merge_writer::flush_progress_t& progress) {
+  REGISTER_TIMER_DETAILED();
+  assert(cs);
 
   while (field_itr.next()) {
     cs.reset(NORM_COLUMN); // FIXME encoder for norms???
@@ -1209,14 +1651,14 @@ bool write_fields(
     auto& field_features = field_meta.features;
 
     // remap merge norms
-    if (!progress() || !field_itr.visit(merge_norms)) {
+    if (!progress() || !merge_norms(field_itr)) {
       return false;
     }
 
     // write field terms
     auto terms = field_itr.iterator();
 
-    field_writer->write(
+    field_writer.write(
       field_meta.name,
       cs.empty() ? irs::field_limits::invalid() : cs.id(),
       field_features,
@@ -1224,93 +1666,161 @@ bool write_fields(
     );
   }
 
-  field_writer->end();
-  field_writer.reset();
+  field_writer.end();
 
   return !field_itr.aborted();
 }
 
 //////////////////////////////////////////////////////////////////////////////
-/// @brief write field term data
+/// @brief write field norms only, 'norms' receives a norm column identifier
+///        for every field in order of iteration
 //////////////////////////////////////////////////////////////////////////////
-template<typename CompoundIterator>
-bool write_fields(
+template<typename NormsWriter>
+bool write_norms(
     columnstore& cs,
-    CompoundIterator& norms,
-    irs::directory& dir,
-    const irs::segment_meta& meta,
     compound_field_iterator& field_itr,
-    const irs::flags& fields_features,
-    const irs::merge_writer::flush_progress_t& progress
-) {
+    const NormsWriter& merge_norms,
+    std::vector<irs::field_id>& norms,
+    const irs::merge_writer::flush_progress_t& progress) {
   REGISTER_TIMER_DETAILED();
   assert(cs);
 
-  irs::flush_state flush_state;
-  flush_state.dir = &dir;
-  flush_state.doc_count = meta.docs_count;
-  flush_state.features = &fields_features;
-  flush_state.name = meta.name;
+  norms.clear();
+  norms.reserve(field_itr.size());
 
-  auto field_writer = meta.codec->get_field_writer(true);
-  field_writer->prepare(flush_state);
+  while (field_itr.next()) {
+    cs.reset(NORM_COLUMN); // FIXME encoder for norms???
 
-  auto add_iterators = [&field_itr](compound_doc_iterator::iterators_t& itrs) {
-    auto add_iterators = [&itrs](
-        const irs::sub_reader& segment,
-        const doc_map_f& doc_map,
-        const irs::field_meta& field) {
-      if (!irs::field_limits::valid(field.norm)) {
-        // field has no norms
-        return true;
-      }
+    // remap merge norms
+    if (!progress() || !merge_norms(field_itr)) {
+      return false;
+    }
 
-      auto* reader = segment.column_reader(field.norm);
+    norms.emplace_back(cs.empty() ? irs::field_limits::invalid() : cs.id());
+  }
 
-      if (!reader) {
-        return false;
+  return !field_itr.aborted();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+/// @brief write field norms only, 'norms' receives a norm column identifier
+///        for every field in order of iteration, norms are read concurrently
+///        and appended sequentially via 'column_pipeline'
+//////////////////////////////////////////////////////////////////////////////
+bool write_norms(
+    irs::async_utils::thread_pool& pool,
+    columnstore& cs,
+    compound_field_iterator& field_itr,
+    std::vector<irs::field_id>& norms,
+    const irs::merge_writer::flush_progress_t& progress) {
+  REGISTER_TIMER_DETAILED();
+  assert(cs);
+
+  column_pipeline fields(cs);
+
+  while (field_itr.next()) {
+    std::vector<column_pipeline::source> sources;
+
+    auto visitor = [&sources](
+        const irs::sub_reader& segment,
+        const doc_map_f& doc_map,
+        const irs::field_meta& meta) {
+      if (irs::field_limits::valid(meta.norm)) {
+        sources.push_back({ &segment, &doc_map, meta.norm });
       }
 
-      itrs.emplace_back(reader->iterator(), &doc_map);
       return true;
     };
 
-    itrs.clear();
-    return field_itr.visit(add_iterators);
-  };
+    if (!progress() || !field_itr.visit(visitor)) {
+      return false;
+    }
 
-  while (field_itr.next()) {
+    fields.add(std::move(sources));
+  }
+
+  if (field_itr.aborted()) {
+    return false;
+  }
+
+  norms.assign(fields.size(), irs::field_limits::invalid());
+
+  const auto reset = [&cs](size_t) {
     cs.reset(NORM_COLUMN); // FIXME encoder for norms???
+  };
 
-    auto& field_meta = field_itr.meta();
-    auto& field_features = field_meta.features;
+  const auto flush = [&cs, &norms](size_t i) {
+    norms[i] = cs.empty() ? irs::field_limits::invalid() : cs.id();
+  };
 
-    // remap merge norms
-    if (!progress() || !norms.reset(add_iterators)) {
+  return fields.run(pool, reset, flush);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+/// @brief write field term data only, field norms are expected to be
+///        written by 'write_norms(...)' beforehand
+//////////////////////////////////////////////////////////////////////////////
+bool write_terms(
+    irs::field_writer& field_writer,
+    compound_field_iterator& field_itr,
+    const std::vector<irs::field_id>& norms,
+    const irs::merge_writer::flush_progress_t& progress) {
+  REGISTER_TIMER_DETAILED();
+
+  for (auto norm = norms.begin(); field_itr.next(); ++norm) {
+    if (!progress()) {
       return false;
     }
 
-    if (!cs.insert(norms)) {
-      return false; // failed to insert all values
+    if (norm == norms.end()) {
+      assert(false); // fields mismatch norms written before
+      return false;
     }
 
+    auto& field_meta = field_itr.meta();
+
     // write field terms
     auto terms = field_itr.iterator();
 
-    field_writer->write(
-      field_meta.name,
-      cs.empty() ? irs::field_limits::invalid() : cs.id(),
-      field_features,
-      *terms
-    );
+    field_writer.write(field_meta.name, *norm, field_meta.features, *terms);
   }
 
-  field_writer->end();
-  field_writer.reset();
+  field_writer.end();
 
   return !field_itr.aborted();
 }
 
+//////////////////////////////////////////////////////////////////////////////
+/// @brief write columns and field term data concurrently into their separate
+///        outputs, field norms share the columnstore with columns and
+///        therefore are written beforehand by 'norms_writer' into 'norms'
+//////////////////////////////////////////////////////////////////////////////
+template<typename NormsWriter, typename ColumnsWriter>
+bool write_concurrently(
+    irs::async_utils::thread_pool& pool,
+    irs::field_writer& field_writer,
+    compound_field_iterator& terms_itr,
+    std::vector<irs::field_id>& norms,
+    const NormsWriter& norms_writer,
+    const ColumnsWriter& columns_writer,
+    const irs::merge_writer::flush_progress_t& progress) {
+  REGISTER_TIMER_DETAILED();
+
+  if (!norms_writer()) {
+    return false; // flush failure
+  }
+
+  bool written[2]{};
+
+  irs::async_utils::parallel_for(&pool, IRESEARCH_COUNTOF(written), [&](size_t i) {
+    written[i] = i
+      ? write_terms(field_writer, terms_itr, norms, progress)
+      : columns_writer();
+  });
+
+  return written[0] && written[1];
+}
+
 //////////////////////////////////////////////////////////////////////////////
 /// @brief computes doc_id_map and docs_count
 //////////////////////////////////////////////////////////////////////////////
@@ -1362,7 +1872,8 @@ merge_writer::reader_ctx::reader_ctx(irs::sub_reader::ptr reader) noexcept
 merge_writer::merge_writer() noexcept
   : dir_(noop_directory::instance()),
     column_info_(nullptr),
-    comparator_(nullptr) {
+    comparator_(nullptr),
+    pool_(nullptr) {
 }
 
 merge_writer::operator bool() const noexcept {
@@ -1379,6 +1890,7 @@ bool merge_writer::flush(
 
   field_meta_map_t field_meta_map;
   compound_field_iterator fields_itr(progress);
+  compound_field_iterator terms_itr(progress); // used with 'pool_' only
   compound_column_meta_iterator_t columns_meta_itr;
   irs::flags fields_features;
 
@@ -1417,6 +1929,11 @@ bool merge_writer::flush(
     }
 
     fields_itr.add(reader, reader_ctx.doc_map);
+
+    if (pool_) {
+      terms_itr.add(reader, reader_ctx.doc_map);
+    }
+
     columns_meta_itr.add(reader, reader_ctx.doc_map);
   }
 
@@ -1441,18 +1958,42 @@ bool merge_writer::flush(
     return false; // progress callback requested termination
   }
 
-  // write columns
-  if (!write_columns(cs, dir, *column_info_, segment.meta, columns_meta_itr, progress)) {
-    return false; // flush failure
-  }
+  // all outputs are created by the flushing thread
+  // since 'tracking_directory' isn't thread-safe
+  auto column_meta_writer = segment.meta.codec->get_column_meta_writer();
+  column_meta_writer->prepare(dir, segment.meta);
+  auto field_writer = prepare_field_writer(dir, segment.meta, fields_features);
 
-  if (!progress()) {
-    return false; // progress callback requested termination
-  }
+  if (pool_) {
+    std::vector<field_id> norms;
 
-  // write field meta and field term data
-  if (!write_fields(cs, dir, segment.meta, fields_itr, fields_features, progress)) {
-    return false; // flush failure
+    auto field_norms_writer = [&]() {
+      return write_norms(*pool_, cs, fields_itr, norms, progress);
+    };
+
+    auto columns_writer = [&]() {
+      return write_columns(*pool_, cs, *column_meta_writer, *column_info_, columns_meta_itr, progress);
+    };
+
+    // write columns and field meta and field term data
+    if (!write_concurrently(*pool_, *field_writer, terms_itr, norms,
+                            field_norms_writer, columns_writer, progress)) {
+      return false; // flush failure
+    }
+  } else {
+    // write columns
+    if (!write_columns(cs, *column_meta_writer, *column_info_, columns_meta_itr, progress)) {
+      return false; // flush failure
+    }
+
+    if (!progress()) {
+      return false; // progress callback requested termination
+    }
+
+    // write field meta and field term data
+    if (!write_fields(cs, *field_writer, fields_itr, norms_writer(cs), progress)) {
+      return false; // flush failure
+    }
   }
 
   if (!progress()) {
@@ -1476,6 +2017,7 @@ bool merge_writer::flush_sorted(
   field_meta_map_t field_meta_map;
   compound_column_meta_iterator_t columns_meta_itr;
   compound_field_iterator fields_itr(progress, comparator_);
+  compound_field_iterator terms_itr(progress, comparator_); // used with 'pool_' only
   irs::flags fields_features;
 
   sorting_compound_column_iterator::iterators_t itrs;
@@ -1506,6 +2048,11 @@ bool merge_writer::flush_sorted(
     }
 
     fields_itr.add(reader, reader_ctx.doc_map);
+
+    if (pool_) {
+      terms_itr.add(reader, reader_ctx.doc_map);
+    }
+
     columns_meta_itr.add(reader, reader_ctx.doc_map);
 
     // count total number of documents in consolidated segment
@@ -1617,18 +2164,42 @@ bool merge_writer::flush_sorted(
     return false; // progress callback requested termination
   }
 
-  // write columns
-  if (!write_columns(cs, sorting_doc_it, dir, *column_info_, segment.meta, columns_meta_itr, progress)) {
-    return false; // flush failure
-  }
+  // all outputs are created by the flushing thread
+  // since 'tracking_directory' isn't thread-safe
+  auto column_meta_writer = segment.meta.codec->get_column_meta_writer();
+  column_meta_writer->prepare(dir, segment.meta);
+  auto field_writer = prepare_field_writer(dir, segment.meta, fields_features);
 
-  if (!progress()) {
-    return false; // progress callback requested termination
-  }
+  if (pool_) {
+    std::vector<field_id> norms;
 
-  // write field meta and field term data
-  if (!write_fields(cs, sorting_doc_it, dir, segment.meta, fields_itr, fields_features, progress)) {
-    return false; // flush failure
+    auto field_norms_writer = [&]() {
+      return write_norms(cs, fields_itr, norms_writer(cs, sorting_doc_it), norms, progress);
+    };
+
+    auto columns_writer = [&]() {
+      return write_columns(cs, sorting_doc_it, *column_meta_writer, *column_info_, columns_meta_itr, progress);
+    };
+
+    // write columns and field meta and field term data
+    if (!write_concurrently(*pool_, *field_writer, terms_itr, norms,
+                            field_norms_writer, columns_writer, progress)) {
+      return false; // flush failure
+    }
+  } else {
+    // write columns
+    if (!write_columns(cs, sorting_doc_it, *column_meta_writer, *column_info_, columns_meta_itr, progress)) {
+      return false; // flush failure
+    }
+
+    if (!progress()) {
+      return false; // progress callback requested termination
+    }
+
+    // write field meta and field term data
+    if (!write_fields(cs, *field_writer, fields_itr, norms_writer(cs, sorting_doc_it), progress)) {
+      return false; // flush failure
+    }
   }
 
   if (!progress()) {
@@ -34,6 +34,10 @@
 
 namespace iresearch {
 
+namespace async_utils {
+class thread_pool;
+}
+
 struct directory;
 struct tracking_directory;
 struct sub_reader;
@@ -54,13 +58,21 @@ class IRESEARCH_API merge_writer: public util::noncopyable {
 
   merge_writer() noexcept;
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// @param pool threads used along with the flushing thread for writing
+  ///        columns and fields concurrently into their separate outputs,
+  ///        'progress' passed to flush(...) must be thread-safe in this case
+  ///        nullptr == write columns and fields one after another
+  //////////////////////////////////////////////////////////////////////////////
   explicit merge_writer(
       directory& dir,
       const column_info_provider_t& column_info,
-      const comparer* comparator = nullptr) noexcept
+      const comparer* comparator = nullptr,
+      async_utils::thread_pool* pool = nullptr) noexcept
     : dir_(dir),
       column_info_(&column_info),
-      comparator_(comparator) {
+      comparator_(comparator),
+      pool_(pool) {
     assert(column_info);
   }
 
@@ -120,6 +132,7 @@ class IRESEARCH_API merge_writer: public util::noncopyable {
   std::vector<reader_ctx> readers_;
   const column_info_provider_t* column_info_;
   const comparer* comparator_;
+  async_utils::thread_pool* pool_; // threads for concurrent writing (optional)
   IRESEARCH_API_PRIVATE_VARIABLES_END
 }; // merge_writer
 
@@ -21,7 +21,7 @@
 /// @author Vasiliy Nabatchikov
 ////////////////////////////////////////////////////////////////////////////////
 
-#include "utils/map_utils.hpp"
+#include "utils/math_utils.hpp"
 #include "utils/timer_utils.hpp"
 #include "utils/type_limits.hpp"
 #include "postings.hpp"
@@ -32,10 +32,39 @@ namespace iresearch {
 // --SECTION--                                           postings implementation
 // -----------------------------------------------------------------------------
 
+// initial number of slots in a hash table
+constexpr const size_t MIN_SLOTS = 64;
+
 postings::postings(writer_t& writer):
   writer_(writer) {
 }
 
+void postings::clear() noexcept {
+  // retain allocated memory for reuse
+  std::fill(slots_.begin(), slots_.end(), slot{ 0, 0 });
+  values_.clear();
+}
+
+void postings::rehash(size_t size) {
+  assert(math::is_power2(size));
+  assert(size > values_.size());
+
+  std::vector<slot> slots(size, slot{ 0, 0 });
+  const size_t mask = size - 1;
+
+  // positions in 'values_' are preserved, only slots are relocated
+  uint32_t value = 0;
+  for (auto& entry : values_) {
+    auto i = entry.first.hash() & mask;
+
+    for (; slots[i].value; i = (i + 1) & mask) { }
+
+    slots[i] = slot{ uint32_t(entry.first.hash()), ++value };
+  }
+
+  slots_ = std::move(slots);
+}
+
 postings::emplace_result postings::emplace(const bytes_ref& term) {
   REGISTER_TIMER_DETAILED();
   auto& parent = writer_.parent();
@@ -46,7 +75,28 @@ postings::emplace_result postings::emplace(const bytes_ref& term) {
   if (writer_t::container::block_type::SIZE < max_term_len) {
     // TODO: maybe move big terms it to a separate storage
     // reject terms that do not fit in a block
-    return std::make_pair(map_.end(), false);
+    return std::make_pair(values_.end(), false);
+  }
+
+  // keep load factor below 0.5
+  if (2*(values_.size() + 1) > slots_.size()) {
+    rehash(std::max(MIN_SLOTS, 2*slots_.size()));
+  }
+
+  const auto hash = std::hash<bytes_ref>()(term);
+  const size_t mask = slots_.size() - 1;
+  auto i = hash & mask;
+
+  for (; slots_[i].value; i = (i + 1) & mask) {
+    const auto& slot = slots_[i];
+
+    if (slot.hash == uint32_t(hash)) {
+      const auto it = values_.begin() + (slot.value - 1);
+
+      if (it->first == term) {
+        return std::make_pair(it, false);
+      }
+    }
   }
 
   const auto slice_end = writer_.pool_offset() + max_term_len;
@@ -61,24 +111,19 @@ postings::emplace_result postings::emplace(const bytes_ref& term) {
 
   assert(size() < doc_limits::eof()); // not larger then the static flag
 
-  auto generator = [&term, this](const hashed_bytes_ref& key, const posting&) {
-    // for new terms also write out their value
-    writer_.write(term.c_str(), term.size());
-
-    // reuse hash but point ref at data in pool
-    return hashed_bytes_ref(
-      key.hash(),
-      (writer_.position() - term.size()).buffer(), term.size()
-    );
-  };
-
-  // replace original reference to 'term' provided by the caller
-  // with a reference to the cached copy in 'writer_'
-  return map_utils::try_emplace_update_key(
-    map_,                  // container
-    generator,             // key generator
-    make_hashed_ref(term)  // key
+  // for new terms also write out their value
+  writer_.write(term.c_str(), term.size());
+
+  // point ref at data in pool instead of 'term' provided by the caller
+  values_.emplace_back(
+    std::piecewise_construct,
+    std::forward_as_tuple(hash, (writer_.position() - term.size()).buffer(), term.size()),
+    std::forward_as_tuple()
   );
+
+  slots_[i] = slot{ uint32_t(hash), uint32_t(values_.size()) };
+
+  return std::make_pair(--values_.end(), true);
 }
 
 }
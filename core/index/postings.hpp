@@ -24,7 +24,7 @@
 #ifndef IRESEARCH_POSTINGS_H
 #define IRESEARCH_POSTINGS_H
 
-#include <unordered_map>
+#include <vector>
 
 #include "shared.hpp"
 #include "utils/block_pool.hpp"
@@ -53,30 +53,50 @@ struct posting {
   doc_id_t size{ 1 }; // length of postings
 };
 
+//////////////////////////////////////////////////////////////////////////////
+/// @class postings
+/// @brief open-addressing hash table of terms (linear probing), term data is
+///        kept in the 'writer' pool, postings are stored contiguously in order
+///        of insertion, the table itself holds a hash fragment and a position
+///        of a posting only
+//////////////////////////////////////////////////////////////////////////////
 class IRESEARCH_API postings: util::noncopyable {
  public:
-  typedef std::unordered_map<hashed_bytes_ref, posting> map_t;
-  typedef std::pair<map_t::iterator, bool> emplace_result;
+  typedef std::pair<hashed_bytes_ref, posting> value_type;
+  typedef std::vector<value_type> values_t;
+  typedef values_t::iterator iterator;
+  typedef values_t::const_iterator const_iterator;
+  typedef std::pair<iterator, bool> emplace_result;
   typedef byte_block_pool::inserter writer_t;
 
   postings(writer_t& writer);
 
-  inline map_t::const_iterator begin() const { return map_.begin(); }
+  inline const_iterator begin() const noexcept { return values_.begin(); }
 
-  inline void clear() { map_.clear(); }
+  void clear() noexcept;
 
   // on error returns std::ptr(end(), false)
   emplace_result emplace(const bytes_ref& term);
 
-  inline bool empty() const { return map_.empty(); }
+  inline bool empty() const noexcept { return values_.empty(); }
 
-  inline map_t::const_iterator end() const { return map_.end(); }
+  inline const_iterator end() const noexcept { return values_.end(); }
 
-  inline size_t size() const { return map_.size(); }
+  inline size_t size() const noexcept { return values_.size(); }
 
  private:
+  struct slot {
+    uint32_t hash; // lower bits of a term hash
+    uint32_t value; // position of a posting in 'values_' + 1, 0 == empty
+  };
+
+  static_assert(sizeof(slot) == sizeof(uint64_t));
+
+  void rehash(size_t size);
+
   IRESEARCH_API_PRIVATE_VARIABLES_BEGIN
-  map_t map_;
+  std::vector<slot> slots_; // size is a power of 2
+  values_t values_;
   writer_t& writer_;
   IRESEARCH_API_PRIVATE_VARIABLES_END
 };
@@ -29,10 +29,13 @@
 #include "index/index_meta.hpp"
 
 #include "formats/format_utils.hpp"
+#include "store/directory_attributes.hpp"
+#include "store/store_utils.hpp"
 #include "utils/index_utils.hpp"
 #include "utils/singleton.hpp"
 #include "utils/type_limits.hpp"
 
+#include <mutex>
 #include <unordered_map>
 
 namespace {
@@ -240,6 +243,8 @@ class segment_reader_impl : public sub_reader {
     const segment_meta& meta
   );
 
+  virtual ~segment_reader_impl();
+
   const directory& dir() const noexcept { 
     return dir_;
   }
@@ -300,6 +305,8 @@ class segment_reader_impl : public sub_reader {
     field_id field
   ) const override;
 
+  virtual const byte_type* norms(field_id column) const override;
+
  private:
   DECLARE_SHARED_PTR(segment_reader_impl); // required for NAMED_PTR(...)
   std::vector<column_meta> columns_;
@@ -312,6 +319,9 @@ class segment_reader_impl : public sub_reader {
   std::vector<column_meta*> id_to_column_;
   uint64_t meta_version_;
   std::unordered_map<hashed_string_ref, column_meta*> name_to_column_;
+  std::shared_ptr<norm_cache> norm_cache_; // set if norms caching is enabled
+  mutable std::mutex norms_lock_;
+  mutable std::unordered_map<field_id, std::vector<byte_type>> norms_; // guarded by 'norms_lock_'
 
   segment_reader_impl(
     const directory& dir,
@@ -385,7 +395,16 @@ segment_reader_impl::segment_reader_impl(
     uint64_t docs_count)
   : dir_(dir),
     docs_count_(docs_count),
-    meta_version_(meta_version) {
+    meta_version_(meta_version),
+    norm_cache_(dir.attributes().get<norm_cache>()) {
+}
+
+segment_reader_impl::~segment_reader_impl() {
+  if (norm_cache_) {
+    for (auto& entry : norms_) {
+      norm_cache_->release(entry.second.size());
+    }
+  }
 }
 
 const column_meta* segment_reader_impl::column(
@@ -481,4 +500,49 @@ const columnstore_reader::column_reader* segment_reader_impl::column_reader(
     : nullptr;
 }
 
+const byte_type* segment_reader_impl::norms(field_id column) const {
+  if (!norm_cache_) {
+    return nullptr;
+  }
+
+  std::lock_guard<std::mutex> lock(norms_lock_);
+
+  auto it = norms_.find(column);
+
+  if (it != norms_.end()) {
+    return it->second.data();
+  }
+
+  const auto* reader = column_reader(column);
+
+  if (!reader) {
+    return nullptr;
+  }
+
+  const size_t size = doc_limits::min() + docs_count_;
+
+  if (!norm_cache_->acquire(size)) {
+    return nullptr; // memory limit reached, fallback to the column
+  }
+
+  try {
+    // documents without norm aren't normalized, i.e. 'norm::DEFAULT()'
+    std::vector<byte_type> norms(size, 0);
+
+    reader->visit([&norms](doc_id_t doc, const bytes_ref& value) {
+      assert(doc < norms.size());
+      bytes_ref_input in(value);
+      norms[doc] = quantized_norm::encode(read_zvfloat(in));
+      return true;
+    });
+
+    it = norms_.emplace(column, std::move(norms)).first;
+  } catch (...) {
+    norm_cache_->release(size);
+    throw;
+  }
+
+  return it->second.data();
+}
+
 }
@@ -124,6 +124,10 @@ class IRESEARCH_API segment_reader final
     return impl_->column_reader(field);
   }
 
+  virtual const byte_type* norms(field_id column) const override {
+    return impl_->norms(column);
+  }
+
   ////////////////////////////////////////////////////////////////////////////////
   /// @brief converts current 'segment_reader' to 'sub_reader::ptr'
   ////////////////////////////////////////////////////////////////////////////////
@@ -205,6 +205,12 @@ void segment_writer::finish() {
   float_t value;
   for (auto* field : norm_fields_) {
     assert(field->size() > 0);
+
+    if (field->meta().features.check<frequency>()) {
+      // quantized value is exposed to postings writers
+      field->store_norm(quantized_norm::encode(uint32_t(field->size())));
+    }
+
     value = 1.f / float_t(std::sqrt(double_t(field->size())));
     if (value != norm::DEFAULT()) {
       auto& stream = field->norms(*col_writer_);
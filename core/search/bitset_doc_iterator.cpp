@@ -101,4 +101,34 @@ doc_id_t bitset_doc_iterator::seek(doc_id_t target) noexcept {
   return doc_.value;
 }
 
+size_t materialize(doc_iterator& it, bitset& set) {
+  if (!it.next()) {
+    return 0;
+  }
+
+  assert(it.value() < set.size());
+  set.set(it.value());
+  size_t count = 1;
+
+  auto* block = postings_block::get(it);
+
+  if (!block) {
+    for (; it.next(); ++count) {
+      assert(it.value() < set.size());
+      set.set(it.value());
+    }
+
+    return count;
+  }
+
+  for (size_t size; (size = block->fetch()); count += size) {
+    for (const auto* doc = block->docs, *end = doc + size; doc != end; ++doc) {
+      assert(*doc < set.size());
+      set.set(*doc);
+    }
+  }
+
+  return count;
+}
+
 } // ROOT
@@ -40,6 +40,12 @@ class bitset_doc_iterator final
     : bitset_doc_iterator(set, order::prepared::unordered()) {
   }
 
+  // iterator owns the specified bitset
+  explicit bitset_doc_iterator(bitset&& set)
+    : bitset_doc_iterator(set, order::prepared::unordered()) {
+    set_ = std::move(set); // words remain at the same address
+  }
+
   bitset_doc_iterator(
     const sub_reader& reader,
     const byte_type* stats,
@@ -47,6 +53,17 @@ class bitset_doc_iterator final
     const order::prepared& order,
     boost_t boost);
 
+  // iterator owns the specified bitset
+  bitset_doc_iterator(
+      const sub_reader& reader,
+      const byte_type* stats,
+      bitset&& set,
+      const order::prepared& order,
+      boost_t boost)
+    : bitset_doc_iterator(reader, stats, set, order, boost) {
+    set_ = std::move(set); // words remain at the same address
+  }
+
   virtual bool next() noexcept override;
   virtual doc_id_t seek(doc_id_t target) noexcept override;
   virtual doc_id_t value() const noexcept override { return doc_.value; }
@@ -56,6 +73,7 @@ class bitset_doc_iterator final
 
   bitset_doc_iterator(const bitset& set, const order::prepared& ord);
 
+  bitset set_; // set if iterator owns the bitset
   cost cost_;
   document doc_;
   score score_;
@@ -66,6 +84,14 @@ class bitset_doc_iterator final
   doc_id_t base_{doc_limits::invalid() - bits_required<word_t>()}; // before the first word
 }; // bitset_doc_iterator
 
+//////////////////////////////////////////////////////////////////////////////
+/// @brief sets bits corresponding to the documents remaining in the specified
+///        iterator, whole blocks of postings are decoded at a time if the
+///        iterator exposes 'postings_block'
+/// @returns number of documents
+//////////////////////////////////////////////////////////////////////////////
+IRESEARCH_API size_t materialize(doc_iterator& it, bitset& set);
+
 } // ROOT
 
 #endif // IRESEARCH_BITSET_DOC_ITERATOR_H
@@ -346,6 +346,73 @@ struct norm_score_ctx final : public score_ctx {
   float_t norm_length_{ 0.f }; // precomputed 'k*b/avgD' if norms present, '0' otherwise
 }; // norm_score_ctx
 
+struct quantized_norm_score_ctx final : public score_ctx {
+  quantized_norm_score_ctx(
+      byte_type* score_buf,
+      float_t k,
+      irs::boost_t boost,
+      const bm25::stats& stats,
+      const frequency* freq,
+      const quantized_norm* norm,
+      const filter_boost* fb = nullptr) noexcept
+    : score_ctx(score_buf, k, boost, stats, freq, fb),
+      norm_(norm),
+      norm_length_(stats.norm_length) {
+    assert(norm_);
+    norm_const_ = stats.norm_const;
+  }
+
+  const quantized_norm* norm_; // norm stored inline with postings
+  float_t norm_length_; // precomputed 'k*b/avgD'
+}; // quantized_norm_score_ctx
+
+// number of documents scored in one pass by batch scorers
+constexpr size_t BATCH_SIZE = 64;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief evaluates scores of a batch of documents, tf and norm lookups are
+///        separated from the arithmetic so that the latter runs over plain
+///        arrays of floats and gets vectorized by the compiler
+////////////////////////////////////////////////////////////////////////////////
+template<typename Ctx>
+void score_batch(
+    irs::score_ctx* ctx,
+    const uint32_t* freqs,
+    const byte_type* norms,
+    size_t count,
+    byte_type* scores) noexcept {
+  constexpr bool HAS_NORMS = std::is_same_v<Ctx, quantized_norm_score_ctx>;
+
+  auto& state = *static_cast<Ctx*>(ctx);
+  auto* out = reinterpret_cast<score_t*>(scores);
+  assert(freqs && (!HAS_NORMS || norms));
+
+  float_t tf[BATCH_SIZE];
+  float_t norm_length[BATCH_SIZE];
+
+  for (size_t offset = 0; offset < count; offset += BATCH_SIZE) {
+    const size_t size = std::min(count - offset, BATCH_SIZE);
+
+    for (size_t i = 0; i < size; ++i) {
+      tf[i] = ::SQRT(freqs[offset + i]);
+    }
+
+    if constexpr (HAS_NORMS) {
+      for (size_t i = 0; i < size; ++i) {
+        norm_length[i] = quantized_norm::decode(norms[offset + i]);
+      }
+
+      for (size_t i = 0; i < size; ++i) {
+        out[offset + i] = state.num_ * tf[i] / (state.norm_const_ + state.norm_length_ * norm_length[i] + tf[i]);
+      }
+    } else {
+      for (size_t i = 0; i < size; ++i) {
+        out[offset + i] = state.num_ * tf[i] / (state.norm_const_ + tf[i]);
+      }
+    }
+  }
+}
+
 class sort final : public irs::prepared_sort_basic<bm25::score_t, bm25::stats> {
  public:
   sort(float_t k, float_t b, bool boost_as_score) noexcept
@@ -442,6 +509,41 @@ class sort final : public irs::prepared_sort_basic<bm25::score_t, bm25::stats> {
     auto* filter_boost = irs::get<irs::filter_boost>(doc_attrs);
 
     if (b_ != 0.f) {
+      // prefer normalization factors stored along with postings
+      // over random access to the norm column
+      auto* quantized_norm = irs::get<irs::quantized_norm>(doc_attrs);
+
+      if (quantized_norm) {
+        if (filter_boost) {
+          return {
+            memory::make_unique<bm25::quantized_norm_score_ctx>(score_buf, k_, boost, stats, freq, quantized_norm, filter_boost),
+            [](irs::score_ctx* ctx) noexcept -> const byte_type* {
+              auto& state = *static_cast<bm25::quantized_norm_score_ctx*>(ctx);
+              assert(state.filter_boost_);
+              const float_t tf = ::SQRT(state.freq_->value);
+              irs::sort::score_cast<score_t>(state.score_buf) = state.filter_boost_->value *
+                                                                state.num_ *
+                                                                tf /
+                                                                (state.norm_const_ + state.norm_length_ * state.norm_->read() + tf);
+              return state.score_buf;
+            }
+          };
+        } else {
+          return {
+            memory::make_unique<bm25::quantized_norm_score_ctx>(score_buf, k_, boost, stats, freq, quantized_norm),
+            [](irs::score_ctx* ctx) noexcept -> const byte_type* {
+              auto& state = *static_cast<bm25::quantized_norm_score_ctx*>(ctx);
+
+              const float_t tf = ::SQRT(state.freq_->value);
+              irs::sort::score_cast<score_t>(state.score_buf) = state.num_ * tf / (state.norm_const_ + state.norm_length_ * state.norm_->read() + tf);
+
+              return state.score_buf;
+            },
+            &bm25::score_batch<bm25::quantized_norm_score_ctx>
+          };
+        }
+      }
+
       irs::norm norm;
 
       auto* doc = irs::get<document>(doc_attrs);
@@ -505,7 +607,8 @@ class sort final : public irs::prepared_sort_basic<bm25::score_t, bm25::stats> {
           irs::sort::score_cast<score_t>(state.score_buf) = state.num_ * tf / (state.norm_const_ + tf);
 
           return state.score_buf;
-        }
+        },
+        &bm25::score_batch<bm25::score_ctx>
       };
     }
   }
@@ -514,6 +617,21 @@ class sort final : public irs::prepared_sort_basic<bm25::score_t, bm25::stats> {
     return irs::memory::make_unique<term_collector>();
   }
 
+  virtual bool max_score(
+      byte_type* score_buf,
+      const byte_type* stats_buf,
+      uint32_t freq,
+      boost_t boost) const override {
+    auto& stats = stats_cast(stats_buf);
+
+    // the score grows with term frequency and decreases with document
+    // length, assume the shortest possible document for the upper bound
+    const float_t tf = ::SQRT(freq);
+    const float_t norm_const = std::min(k_, stats.norm_const);
+    irs::sort::score_cast<score_t>(score_buf) = boost * (k_ + 1) * stats.idf * tf / (norm_const + tf);
+    return true;
+  }
+
  private:
   float_t k_;
   float_t b_;
@@ -24,6 +24,7 @@
 
 #include <boost/functional/hash.hpp>
 
+#include "bitset_doc_iterator.hpp"
 #include "conjunction.hpp"
 #include "disjunction.hpp"
 #include "min_match_disjunction.hpp"
@@ -86,10 +87,68 @@ irs::doc_iterator::ptr make_disjunction(
       std::move(itrs), ord, std::forward<Args>(args)...);
   }
 
+  if constexpr (0 == sizeof...(Args)) {
+    using maxscore_disjunction_t = irs::maxscore_disjunction<irs::doc_iterator::ptr>;
+
+    // sub-iterators provide score upper bounds, skip non-competitive documents
+    if (maxscore_disjunction_t::applicable(itrs, ord)) {
+      return irs::memory::make_managed<maxscore_disjunction_t>(std::move(itrs), ord);
+    }
+  }
+
   return irs::make_disjunction<scored_disjunction_t>(
     std::move(itrs), ord, std::forward<Args>(args)...);
 }
 
+// iterators matching at least 1/DENSE_RATIO of segment documents are dense
+constexpr irs::cost::cost_t DENSE_RATIO = 16;
+
+//////////////////////////////////////////////////////////////////////////////
+/// @brief replaces unscored sub-iterators of a conjunction with a single
+///        iterator over the intersection of their documents evaluated via
+///        bitsets a word at a time
+/// @note applied only if requested via 'And::dense_intersection(...)' and
+///       all sub-iterators are dense, otherwise leapfrogging driven by a
+///       sparse iterator is cheaper than decoding whole postings
+//////////////////////////////////////////////////////////////////////////////
+template<typename DocIterators>
+void intersect_dense(const irs::sub_reader& segment, DocIterators& itrs) {
+  const auto dense_cost = segment.docs_count() / DENSE_RATIO;
+  size_t unscored = 0;
+
+  for (auto& it : itrs) {
+    if (irs::cost::extract(it, 0) < dense_cost) {
+      return;
+    }
+
+    unscored += size_t(it.score->is_default());
+  }
+
+  if (unscored < 2) {
+    return;
+  }
+
+  auto begin = std::partition(
+    itrs.begin(), itrs.end(),
+    [](const auto& it) noexcept { return !it.score->is_default(); });
+  assert(std::distance(begin, itrs.end()) > 1);
+
+  const size_t size = irs::doc_limits::min() + segment.docs_count();
+  irs::bitset docs(size);
+  materialize(*begin->it, docs);
+
+  irs::bitset buf(size);
+  for (auto it = begin + 1, end = itrs.end(); it != end; ++it) {
+    buf.clear();
+    materialize(*it->it, buf);
+    docs &= buf;
+  }
+
+  itrs.erase(begin, itrs.end());
+  itrs.emplace_back(
+    irs::memory::make_managed<irs::bitset_doc_iterator>(std::move(docs)));
+}
+
 //////////////////////////////////////////////////////////////////////////////
 /// @returns conjunction iterator created from the specified queries
 //////////////////////////////////////////////////////////////////////////////
@@ -98,6 +157,7 @@ irs::doc_iterator::ptr make_conjunction(
     const irs::sub_reader& rdr,
     const irs::order::prepared& ord,
     const irs::attribute_provider* ctx,
+    bool dense_intersection,
     QueryIterator begin,
     QueryIterator end,
     Args&&... args) {
@@ -128,6 +188,20 @@ irs::doc_iterator::ptr make_conjunction(
     itrs.emplace_back(std::move(docs));
   }
 
+  if (dense_intersection) {
+    // intersect dense postings a word of a bitset at a time
+    intersect_dense(rdr, itrs);
+  }
+
+  if constexpr (0 == sizeof...(Args)) {
+    using block_max_conjunction_t = irs::block_max_conjunction<irs::doc_iterator::ptr>;
+
+    // sub-iterators provide score upper bounds, skip non-competitive documents
+    if (block_max_conjunction_t::applicable(itrs, ord)) {
+      return irs::memory::make_managed<block_max_conjunction_t>(std::move(itrs), ord);
+    }
+  }
+
   return irs::make_conjunction<conjunction_t>(
      std::move(itrs), ord, std::forward<Args>(args)...
   );
@@ -231,14 +305,21 @@ class boolean_query : public filter::prepared {
 //////////////////////////////////////////////////////////////////////////////
 class and_query final : public boolean_query {
  public:
+  explicit and_query(bool dense_intersection = false) noexcept
+    : dense_intersection_(dense_intersection) {
+  }
+
   virtual doc_iterator::ptr execute(
       const sub_reader& rdr,
       const order::prepared& ord,
       const attribute_provider* ctx,
       iterator begin,
       iterator end) const override {
-    return ::make_conjunction(rdr, ord, ctx, begin, end);
+    return ::make_conjunction(rdr, ord, ctx, dense_intersection_, begin, end);
   }
+
+ private:
+  bool dense_intersection_;
 };
 
 //////////////////////////////////////////////////////////////////////////////
@@ -291,7 +372,7 @@ class min_match_query final : public boolean_query {
       return doc_iterator::empty();
     } else if (min_match_count == size) {
       // pure conjunction
-      return ::make_conjunction(rdr, ord, ctx, begin, end);
+      return ::make_conjunction(rdr, ord, ctx, false, begin, end);
     }
 
     // min_match_count <= size
@@ -521,7 +602,7 @@ filter::prepared::ptr And::prepare(
     // single node case
     return incl.front()->prepare(rdr, ord, boost, ctx);
   }
-  auto q = memory::make_managed<and_query>();
+  auto q = memory::make_managed<and_query>(dense_intersection_);
   q->prepare(rdr, ord, boost, ctx, incl, excl);
   return q;
 }
@@ -103,6 +103,23 @@ class IRESEARCH_API And: public boolean_filter {
 
   using filter::prepare;
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// @return whether dense unscored subqueries are intersected via bitsets
+  //////////////////////////////////////////////////////////////////////////////
+  bool dense_intersection() const noexcept { return dense_intersection_; }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief sets whether unscored subqueries are decoded into bitsets and
+  ///        intersected a word at a time once every subquery matches at
+  ///        least 1/16 of segment documents, disabled by default
+  /// @note doesn't affect matched documents, thus isn't the part of filter
+  ///       identity
+  //////////////////////////////////////////////////////////////////////////////
+  And& dense_intersection(bool value) noexcept {
+    dense_intersection_ = value;
+    return *this;
+  }
+
  protected:
   virtual filter::prepared::ptr prepare(
     std::vector<const filter*>& incl,
@@ -111,6 +128,9 @@ class IRESEARCH_API And: public boolean_filter {
     const order::prepared& ord,
     boost_t boost,
     const attribute_provider* ctx) const override;
+
+ private:
+  bool dense_intersection_{false};
 }; // And
 
 //////////////////////////////////////////////////////////////////////////////
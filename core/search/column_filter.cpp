@@ -0,0 +1,322 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "column_filter.hpp"
+
+#include "analysis/token_attributes.hpp"
+#include "formats/empty_term_reader.hpp"
+#include "index/index_reader.hpp"
+#include "search/cost.hpp"
+#include "search/score.hpp"
+#include "utils/frozen_attributes.hpp"
+
+namespace {
+
+using namespace irs;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class column_verifying_iterator
+/// @brief iterator over the documents of a column with a value accepted by
+///        the specified predicate. Being a non-leading leg of a conjunction
+///        (see 'two_phase') it doesn't look for the next accepted document
+///        on 'seek' but reports the next document of the column instead,
+///        i.e. only the candidates of the lead are checked
+////////////////////////////////////////////////////////////////////////////////
+template<typename Predicate>
+class column_verifying_iterator final
+    : public frozen_attributes<4, doc_iterator>,
+      private util::noncopyable {
+ public:
+  column_verifying_iterator(
+      doc_iterator::ptr&& it,
+      const payload& value,
+      const Predicate& accept,
+      const order::prepared& ord)
+    : attributes{{
+        { type<document>::id(),  irs::get_mutable<document>(it.get()) },
+        { type<cost>::id(),      &cost_                               },
+        { type<score>::id(),     &score_                              },
+        { type<two_phase>::id(), &two_phase_                          },
+      }},
+      cost_(cost::extract(*it)), // at most every value of a column is checked
+      score_(ord),
+      it_(std::move(it)),
+      doc_(irs::get<document>(*it_)),
+      value_(&value),
+      accept_(accept) {
+    assert(doc_);
+  }
+
+  score& attribute_score() noexcept { return score_; }
+
+  virtual doc_id_t value() const noexcept override {
+    return doc_->value;
+  }
+
+  virtual bool next() override {
+    verified_ = true;
+
+    while (it_->next()) {
+      if (accept_(value_->value)) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  virtual doc_id_t seek(doc_id_t target) override {
+    if (target <= doc_->value) {
+      if (verified_ || target < doc_->value) {
+        return doc_->value;
+      }
+    } else if (doc_limits::eof(it_->seek(target))) {
+      verified_ = true;
+      return doc_->value;
+    }
+
+    if (two_phase_.enabled && target < doc_->value) {
+      // not a candidate of the lead, report a lower bound of the next match
+      verified_ = false;
+      return doc_->value;
+    }
+
+    if (accept_(value_->value)) {
+      verified_ = true;
+      return doc_->value;
+    }
+
+    if (two_phase_.enabled) {
+      // rejected candidate, the next document is checked once the lead
+      // gets there
+      verified_ = !it_->next();
+      return doc_->value;
+    }
+
+    next();
+
+    return doc_->value;
+  }
+
+ private:
+  cost cost_;
+  score score_;
+  two_phase two_phase_;
+  doc_iterator::ptr it_;
+  const document* doc_;
+  const payload* value_;
+  Predicate accept_;
+  bool verified_{true}; // value of the current document is accepted
+}; // column_verifying_iterator
+
+//////////////////////////////////////////////////////////////////////////////
+/// @brief accepts values within a range
+//////////////////////////////////////////////////////////////////////////////
+class range_predicate {
+ public:
+  explicit range_predicate(const by_column_range_options::range_type& range) noexcept
+    : min_(range.min),
+      max_(range.max),
+      min_type_(range.min_type),
+      max_type_(range.max_type) {
+  }
+
+  bool operator()(const bytes_ref& value) const noexcept {
+    switch (min_type_) {
+      case BoundType::INCLUSIVE:
+        if (value < min_) return false;
+        break;
+      case BoundType::EXCLUSIVE:
+        if (value <= min_) return false;
+        break;
+      case BoundType::UNBOUNDED:
+        break;
+    }
+
+    switch (max_type_) {
+      case BoundType::INCLUSIVE:
+        return value <= max_;
+      case BoundType::EXCLUSIVE:
+        return value < max_;
+      case BoundType::UNBOUNDED:
+        break;
+    }
+
+    return true;
+  }
+
+ private:
+  bytes_ref min_;
+  bytes_ref max_;
+  BoundType min_type_;
+  BoundType max_type_;
+}; // range_predicate
+
+//////////////////////////////////////////////////////////////////////////////
+/// @brief accepts values from a sorted set of terms
+//////////////////////////////////////////////////////////////////////////////
+class terms_predicate {
+ public:
+  explicit terms_predicate(const std::vector<bstring>& terms) noexcept
+    : terms_(&terms) {
+  }
+
+  bool operator()(const bytes_ref& value) const noexcept {
+    const auto it = std::lower_bound(
+      terms_->begin(), terms_->end(), value,
+      [](const bstring& lhs, const bytes_ref& rhs) {
+        return bytes_ref(lhs) < rhs;
+    });
+
+    return it != terms_->end() && bytes_ref(*it) == value;
+  }
+
+ private:
+  const std::vector<bstring>* terms_;
+}; // terms_predicate
+
+//////////////////////////////////////////////////////////////////////////////
+/// @class column_query
+/// @brief query evaluating a predicate against the values of a column
+//////////////////////////////////////////////////////////////////////////////
+template<typename Predicate, typename Options>
+class column_query final : public filter::prepared {
+ public:
+  column_query(
+      const std::string& field,
+      Options&& options,
+      bstring&& stats,
+      boost_t boost)
+    : filter::prepared(boost),
+      field_(field),
+      options_(std::move(options)),
+      stats_(std::move(stats)) {
+  }
+
+  virtual doc_iterator::ptr execute(
+      const sub_reader& segment,
+      const order::prepared& ord,
+      const attribute_provider* /*ctx*/) const override {
+    using iterator_t = column_verifying_iterator<Predicate>;
+
+    const auto* column = segment.column_reader(field_);
+
+    if (!column) {
+      return doc_iterator::empty();
+    }
+
+    auto it = column->iterator();
+
+    if (IRS_UNLIKELY(!it)) {
+      return doc_iterator::empty();
+    }
+
+    const auto* value = irs::get<payload>(*it);
+
+    if (IRS_UNLIKELY(!value)) {
+      return doc_iterator::empty();
+    }
+
+    auto verifier = memory::make_managed<iterator_t>(
+      std::move(it), *value, Predicate(options_), ord);
+
+    if (!ord.empty()) {
+      auto& score = verifier->attribute_score();
+
+      order::prepared::scorers scorers(
+        ord, segment, empty_term_reader(column->size()),
+        stats_.c_str(), score.data(),
+        *verifier, // doc_iterator attributes
+        boost());
+
+      irs::reset(score, std::move(scorers));
+    }
+
+    return verifier;
+  }
+
+ private:
+  std::string field_;
+  Options options_;
+  bstring stats_;
+}; // column_query
+
+bstring prepare_stats(const index_reader& reader, const order::prepared& order) {
+  // skip field-level/term-level statistics because there are no explicit
+  // terms, but still collect index-level statistics
+  bstring stats(order.stats_size(), 0);
+  auto* stats_buf = const_cast<byte_type*>(stats.data());
+
+  order.prepare_collectors(stats_buf, reader);
+
+  return stats;
+}
+
+}
+
+namespace iresearch {
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                    by_column_range implementation
+// -----------------------------------------------------------------------------
+
+DEFINE_FACTORY_DEFAULT(by_column_range)
+
+filter::prepared::ptr by_column_range::prepare(
+    const index_reader& reader,
+    const order::prepared& order,
+    boost_t filter_boost,
+    const attribute_provider* /*ctx*/) const {
+  using query_t = column_query<range_predicate, by_column_range_options::range_type>;
+
+  filter_boost *= boost();
+
+  return memory::make_managed<query_t>(
+    field(), by_column_range_options::range_type(options().range),
+    prepare_stats(reader, order), filter_boost);
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                    by_column_terms implementation
+// -----------------------------------------------------------------------------
+
+DEFINE_FACTORY_DEFAULT(by_column_terms)
+
+filter::prepared::ptr by_column_terms::prepare(
+    const index_reader& reader,
+    const order::prepared& order,
+    boost_t filter_boost,
+    const attribute_provider* /*ctx*/) const {
+  using query_t = column_query<terms_predicate, std::vector<bstring>>;
+
+  const auto& terms = options().terms;
+
+  if (terms.empty()) {
+    return prepared::empty();
+  }
+
+  filter_boost *= boost();
+
+  return memory::make_managed<query_t>(
+    field(), std::vector<bstring>(terms.begin(), terms.end()), // sorted
+    prepare_stats(reader, order), filter_boost);
+}
+
+} // ROOT
@@ -0,0 +1,131 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IRESEARCH_COLUMN_FILTER_H
+#define IRESEARCH_COLUMN_FILTER_H
+
+#include <set>
+
+#include "filter.hpp"
+#include "search/search_range.hpp"
+#include "utils/string.hpp"
+
+namespace iresearch {
+
+class by_column_range;
+class by_column_terms;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @struct by_column_range_options
+/// @brief options for column range filter, bounds are compared bytewise with
+///        the values stored in a column, i.e. values must be written in an
+///        order-preserving encoding (e.g. bkd_tree::encode(...))
+////////////////////////////////////////////////////////////////////////////////
+struct IRESEARCH_API by_column_range_options {
+  using filter_type = by_column_range;
+  using range_type = search_range<bstring>;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief search range
+  //////////////////////////////////////////////////////////////////////////////
+  range_type range;
+
+  bool operator==(const by_column_range_options& rhs) const noexcept {
+    return range == rhs.range;
+  }
+
+  size_t hash() const noexcept {
+    return std::hash<range_type>()(range);
+  }
+}; // by_column_range_options
+
+//////////////////////////////////////////////////////////////////////////////
+/// @class by_column_range
+/// @brief user-side filter matching documents with a value of a column
+///        within the specified range
+/// @note the predicate is evaluated per document against the column instead
+///       of enumerating the matching terms of a field, the estimated cost of
+///       the iterator is the number of values in the column, so that a
+///       conjunction with a cheaper leg uses it to verify the candidates
+///       of that leg only and falls back to a column scan otherwise
+//////////////////////////////////////////////////////////////////////////////
+class IRESEARCH_API by_column_range final
+    : public filter_base<by_column_range_options> {
+ public:
+  DECLARE_FACTORY();
+
+  using filter::prepare;
+
+  virtual filter::prepared::ptr prepare(
+    const index_reader& rdr,
+    const order::prepared& ord,
+    boost_t boost,
+    const attribute_provider* ctx) const override;
+}; // by_column_range
+
+////////////////////////////////////////////////////////////////////////////////
+/// @struct by_column_terms_options
+/// @brief options for column terms filter
+////////////////////////////////////////////////////////////////////////////////
+struct IRESEARCH_API by_column_terms_options {
+  using filter_type = by_column_terms;
+  using search_terms = std::set<bstring>;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief values to match
+  //////////////////////////////////////////////////////////////////////////////
+  search_terms terms;
+
+  bool operator==(const by_column_terms_options& rhs) const noexcept {
+    return terms == rhs.terms;
+  }
+
+  size_t hash() const noexcept {
+    size_t hash = 0;
+    for (auto& term : terms) {
+      hash = hash_combine(hash, term);
+    }
+    return hash;
+  }
+}; // by_column_terms_options
+
+//////////////////////////////////////////////////////////////////////////////
+/// @class by_column_terms
+/// @brief user-side filter matching documents with a value of a column
+///        equal to any of the specified terms
+/// @note evaluated the same way as 'by_column_range'
+//////////////////////////////////////////////////////////////////////////////
+class IRESEARCH_API by_column_terms final
+    : public filter_base<by_column_terms_options> {
+ public:
+  DECLARE_FACTORY();
+
+  using filter::prepare;
+
+  virtual filter::prepared::ptr prepare(
+    const index_reader& rdr,
+    const order::prepared& ord,
+    boost_t boost,
+    const attribute_provider* ctx) const override;
+}; // by_column_terms
+
+} // ROOT
+
+#endif // IRESEARCH_COLUMN_FILTER_H
@@ -114,6 +114,14 @@ class conjunction
       assert(front);
       front_doc = irs::get_mutable<document>(front);
       assert(front_doc);
+
+      // only candidates of the lead have to be verified by the rest
+      for (auto it = this->itrs.begin() + 1, end = this->itrs.end(); it != end; ++it) {
+        auto* phase = irs::get_mutable<two_phase>(it->it.get());
+        if (phase) {
+          phase->enabled = true;
+        }
+      }
     }
 
     doc_iterator* front;
@@ -273,6 +281,132 @@ class conjunction
   order::prepared::merger merger_;
 }; // conjunction
 
+////////////////////////////////////////////////////////////////////////////////
+/// @class block_max_conjunction
+/// @brief scored conjunction skipping documents which can't get into the top-k
+///        using score upper bounds exposed by sub-iterators via 'impact'.
+///        Every candidate is checked against the sum of per-block bounds of
+///        all sub-iterators, the whole window the block bounds are valid for
+///        is skipped if the candidate can't compete.
+/// @note pruning is enabled once 'score_threshold' is set by the consumer,
+///       iterator behaves as a regular scored conjunction otherwise
+////////////////////////////////////////////////////////////////////////////////
+template<typename DocIterator>
+class block_max_conjunction final
+  : public frozen_attributes<4, doc_iterator> {
+ public:
+  using conjunction_t = conjunction<DocIterator>;
+  using doc_iterators_t = typename conjunction_t::doc_iterators_t;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns true if score upper bounds are available for all of the
+  ///          specified iterators
+  //////////////////////////////////////////////////////////////////////////////
+  static bool applicable(
+      doc_iterators_t& itrs,
+      const order::prepared& ord) noexcept {
+    return 1 == ord.size()
+      && ord.front().reverse
+      && itrs.size() > 1
+      && std::all_of(itrs.begin(), itrs.end(), [](auto& it) noexcept {
+           const auto* impact = irs::get_mutable<irs::impact>(&it);
+           return impact && impact->prepared();
+         });
+  }
+
+  block_max_conjunction(
+      doc_iterators_t&& itrs,
+      const order::prepared& ord)
+    : attributes{{
+        { type<document>::id(),        nullptr     },
+        { type<cost>::id(),            nullptr     },
+        { type<score>::id(),           nullptr     },
+        { type<score_threshold>::id(), &threshold_ },
+      }},
+      conj_(std::move(itrs), ord),
+      ord_(&ord),
+      merger_(ord.prepare_merger(sort::MergeType::AGGREGATE)),
+      score_size_(ord.score_size()) {
+    // expose attributes of the underlying conjunction
+    *ref(type<document>::id()) = irs::get_mutable<document>(&conj_);
+    *ref(type<cost>::id()) = irs::get_mutable<cost>(&conj_);
+    *ref(type<score>::id()) = irs::get_mutable<score>(&conj_);
+
+    impacts_.reserve(conj_.size());
+    for (auto& it : conj_) {
+      auto* impact = irs::get_mutable<irs::impact>(it.it.get());
+      assert(impact && impact->prepared());
+      impacts_.emplace_back(impact);
+    }
+
+    block_ends_.resize(impacts_.size(), doc_limits::invalid());
+    buf_.resize(score_size_, 0);
+  }
+
+  virtual doc_id_t value() const override {
+    return conj_.value();
+  }
+
+  virtual bool next() override {
+    if (!conj_.next()) {
+      return false;
+    }
+
+    return !doc_limits::eof(skip(conj_.value()));
+  }
+
+  virtual doc_id_t seek(doc_id_t target) override {
+    const auto doc = value();
+
+    if (target <= doc) {
+      return doc; // current document was already checked against threshold
+    }
+
+    return skip(conj_.seek(target));
+  }
+
+ private:
+  // returns the first document starting from 'doc' which may compete
+  doc_id_t skip(doc_id_t doc) {
+    while (!threshold_.empty() && !doc_limits::eof(doc)) {
+      // sum up block bounds of all iterators
+      auto* block_bound = buf_.data();
+      std::memset(block_bound, 0, score_size_);
+      doc_id_t window_end = doc_limits::eof();
+
+      for (size_t i = 0, size = impacts_.size(); i < size; ++i) {
+        if (doc > block_ends_[i]) {
+          block_ends_[i] = impacts_[i]->shallow_seek(doc);
+        }
+
+        window_end = std::min(window_end, block_ends_[i]);
+        merger_(block_bound, impacts_[i]->block_max());
+      }
+
+      assert(threshold_.value.size() == score_size_);
+      if (ord_->less(block_bound, threshold_.value.c_str())) {
+        break;
+      }
+
+      // the whole window can't compete
+      doc = conj_.seek(doc_limits::eof(window_end)
+                         ? doc_limits::eof()
+                         : window_end + 1);
+    }
+
+    return doc;
+  }
+
+  conjunction_t conj_;
+  std::vector<impact*> impacts_;
+  std::vector<doc_id_t> block_ends_; // last documents the block bounds are valid for
+  bstring buf_; // temporary score buffer
+  const order::prepared* ord_;
+  score_threshold threshold_;
+  order::prepared::merger merger_;
+  size_t score_size_;
+}; // block_max_conjunction
+
 //////////////////////////////////////////////////////////////////////////////
 /// @returns conjunction iterator created from the specified sub iterators 
 //////////////////////////////////////////////////////////////////////////////
@@ -25,4 +25,6 @@
 
 namespace iresearch {
 
+REGISTER_ATTRIBUTE(two_phase);
+
 } // ROOT
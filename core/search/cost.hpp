@@ -109,6 +109,22 @@ class IRESEARCH_API cost final : public attribute {
   IRESEARCH_API_PRIVATE_VARIABLES_END
 }; // cost
 
+//////////////////////////////////////////////////////////////////////////////
+/// @class two_phase
+/// @brief allows an iterator to defer an expensive per-document check, set by
+///        a conjunction for its non-leading iterators. Once enabled, 'seek'
+///        may return a document greater than the target without verifying
+///        it, i.e. a lower bound for the next match the lead has to be
+///        advanced to, a document equal to the target is always verified
+//////////////////////////////////////////////////////////////////////////////
+struct IRESEARCH_API two_phase final : attribute {
+  static constexpr string_ref type_name() noexcept {
+    return "iresearch::two_phase";
+  }
+
+  bool enabled{false};
+}; // two_phase
+
 } // ROOT
 
 #endif // IRESEARCH_COST_H
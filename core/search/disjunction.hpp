@@ -1426,6 +1426,255 @@ using min_match_iterator = block_disjunction<
   block_disjunction_traits<false, MatchType::MIN_MATCH, false>,
   Adapter>;
 
+////////////////////////////////////////////////////////////////////////////////
+/// @class maxscore_disjunction
+/// @brief scored disjunction skipping documents which can't get into the top-k
+///        using score upper bounds exposed by sub-iterators via 'impact'.
+///-----------------------------------------------------------------------------
+///   [0]          <-- non-essential iterators, i.e. the longest prefix of
+///   ...           |  iterators (sorted by max score) which can't beat the
+///   [e-1]         |  threshold on their own, never produce candidates
+///   [e]          <-- essential iterators, produce candidates
+///   ...           |
+///   [n-1]         |
+///-----------------------------------------------------------------------------
+///        Every candidate is checked against the sum of per-block bounds
+///        first, the whole window the block bounds are valid for is skipped
+///        if the candidate can't compete (block-max), otherwise non-essential
+///        iterators are advanced as long as the partial score may still beat
+///        the threshold (MaxScore).
+/// @note pruning is enabled once 'score_threshold' is set by the consumer,
+///       iterator behaves as a regular scored disjunction otherwise
+////////////////////////////////////////////////////////////////////////////////
+template<typename DocIterator, typename Adapter = score_iterator_adapter<DocIterator>>
+class maxscore_disjunction final
+    : public frozen_attributes<4, doc_iterator>,
+      private score_ctx {
+ public:
+  using adapter = Adapter;
+  using doc_iterators_t = std::vector<adapter>;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns true if score upper bounds are available for all of the
+  ///          specified iterators
+  //////////////////////////////////////////////////////////////////////////////
+  static bool applicable(
+      doc_iterators_t& itrs,
+      const order::prepared& ord) noexcept {
+    return 1 == ord.size()
+      && ord.front().reverse
+      && itrs.size() > 1
+      && std::all_of(itrs.begin(), itrs.end(), [](adapter& it) noexcept {
+           const auto* impact = irs::get_mutable<irs::impact>(&it);
+           return impact && impact->prepared();
+         });
+  }
+
+  maxscore_disjunction(
+      doc_iterators_t&& itrs,
+      const order::prepared& ord)
+    : attributes{{
+        { type<document>::id(),        &doc_       },
+        { type<cost>::id(),            &cost_      },
+        { type<score>::id(),           &score_     },
+        { type<score_threshold>::id(), &threshold_ },
+      }},
+      itrs_(std::move(itrs)),
+      ord_(&ord),
+      score_(ord),
+      merger_(ord.prepare_merger(sort::MergeType::AGGREGATE)),
+      score_size_(ord.score_size()) {
+    assert(applicable(itrs_, ord));
+
+    cost_.value(std::accumulate(
+      itrs_.begin(), itrs_.end(), cost::cost_t(0),
+      [](cost::cost_t lhs, const adapter& rhs) {
+        return lhs + cost::extract(rhs, 0);
+    }));
+
+    // sort iterators by max score in ascending order
+    std::sort(itrs_.begin(), itrs_.end(), [&ord](adapter& lhs, adapter& rhs) {
+      return ord.less(irs::get_mutable<impact>(&rhs)->max(),
+                      irs::get_mutable<impact>(&lhs)->max());
+    });
+
+    impacts_.reserve(itrs_.size());
+    block_ends_.resize(itrs_.size(), doc_limits::invalid());
+    bounds_.resize((itrs_.size() + 1) * score_size_, 0);
+    buf_.resize(score_size_, 0);
+
+    // evaluate prefix sums of max scores
+    for (size_t i = 0, size = itrs_.size(); i < size; ++i) {
+      auto* impact = irs::get_mutable<irs::impact>(&itrs_[i]);
+      assert(impact);
+      impacts_.emplace_back(impact);
+
+      std::memcpy(bound(i + 1), bound(i), score_size_);
+      merger_(bound(i + 1), impact->max());
+    }
+
+    score_.reset(this, [](score_ctx* ctx) -> const byte_type* {
+      return static_cast<maxscore_disjunction*>(ctx)->score_.data();
+    });
+  }
+
+  virtual doc_id_t value() const noexcept override {
+    return doc_.value;
+  }
+
+  virtual bool next() override {
+    if (doc_limits::eof(doc_.value)) {
+      return false;
+    }
+
+    return !doc_limits::eof(advance(doc_.value + 1));
+  }
+
+  virtual doc_id_t seek(doc_id_t target) override {
+    if (target <= doc_.value) {
+      return doc_.value;
+    }
+
+    return advance(target);
+  }
+
+ private:
+  byte_type* bound(size_t i) noexcept {
+    assert(i <= itrs_.size());
+    return &bounds_[0] + i * score_size_;
+  }
+
+  // returns true if the specified score may beat the threshold
+  bool competitive(const byte_type* score) const {
+    assert(threshold_.value.size() == score_size_);
+    return ord_->less(score, threshold_.value.c_str());
+  }
+
+  // threshold never decreases, so does the number of non-essential iterators
+  void update_essential() {
+    while (essential_ < itrs_.size() && !competitive(bound(essential_ + 1))) {
+      ++essential_;
+    }
+  }
+
+  doc_id_t advance(doc_id_t target) {
+    const size_t size = itrs_.size();
+
+    for (;;) {
+      const bool prune = !threshold_.empty();
+
+      if (prune) {
+        update_essential();
+      }
+
+      // find the next candidate among essential iterators
+      doc_id_t candidate = doc_limits::eof();
+
+      for (size_t i = essential_; i < size; ++i) {
+        auto& it = itrs_[i];
+        const auto doc = it.value() < target ? it->seek(target) : it.value();
+        candidate = std::min(candidate, doc);
+      }
+
+      if (doc_limits::eof(candidate)) {
+        return doc_.value = doc_limits::eof();
+      }
+
+      if (prune) {
+        // sum up block bounds of iterators which may contain candidate
+        auto* block_bound = buf_.data();
+        std::memset(block_bound, 0, score_size_);
+        doc_id_t window_end = doc_limits::eof();
+
+        for (size_t i = 0; i < size; ++i) {
+          const auto doc = itrs_[i].value();
+
+          if (doc > candidate) {
+            window_end = std::min(window_end, doc - 1);
+            continue;
+          }
+
+          if (candidate > block_ends_[i]) {
+            block_ends_[i] = impacts_[i]->shallow_seek(candidate);
+          }
+
+          window_end = std::min(window_end, block_ends_[i]);
+          merger_(block_bound, impacts_[i]->block_max());
+        }
+
+        if (!competitive(block_bound)) {
+          // the whole window can't compete
+          if (doc_limits::eof(window_end)) {
+            return doc_.value = doc_limits::eof();
+          }
+
+          target = window_end + 1;
+          continue;
+        }
+      }
+
+      if (evaluate(candidate, prune)) {
+        return doc_.value = candidate;
+      }
+
+      target = candidate + 1;
+    }
+  }
+
+  // evaluates score of the specified candidate,
+  // returns false if candidate can't compete
+  bool evaluate(doc_id_t candidate, bool prune) {
+    auto* score = score_.data();
+    std::memset(score, 0, score_size_);
+
+    for (size_t i = essential_, size = itrs_.size(); i < size; ++i) {
+      auto& it = itrs_[i];
+
+      if (it.value() == candidate) {
+        merger_(score, it.score->evaluate());
+      }
+    }
+
+    for (size_t i = essential_; i; --i) {
+      auto& it = itrs_[i - 1];
+
+      if (prune) {
+        // check whether remaining non-essential iterators may
+        // bring the candidate into the top-k
+        auto* partial = buf_.data();
+        std::memcpy(partial, score, score_size_);
+        merger_(partial, bound(i));
+
+        if (!competitive(partial)) {
+          return false;
+        }
+      }
+
+      const auto doc = it.value() < candidate ? it->seek(candidate) : it.value();
+
+      if (doc == candidate) {
+        merger_(score, it.score->evaluate());
+      }
+    }
+
+    return true;
+  }
+
+  doc_iterators_t itrs_;
+  std::vector<impact*> impacts_;
+  std::vector<doc_id_t> block_ends_; // last documents the block bounds are valid for
+  bstring bounds_; // prefix sums of max scores
+  bstring buf_; // temporary score buffer
+  const order::prepared* ord_;
+  size_t essential_{}; // index of the first essential iterator
+  document doc_;
+  score score_;
+  cost cost_;
+  score_threshold threshold_;
+  order::prepared::merger merger_;
+  size_t score_size_;
+}; // maxscore_disjunction
+
 //////////////////////////////////////////////////////////////////////////////
 /// @returns disjunction iterator created from the specified sub iterators
 //////////////////////////////////////////////////////////////////////////////
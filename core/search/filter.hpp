@@ -117,8 +117,13 @@ class IRESEARCH_API filter {
   explicit filter(const type_info& type) noexcept;
   virtual ~filter() = default;
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// @note boost is a part of filter identity, i.e. equal filters produce
+  ///       equally scored queries, e.g. may share a prepared query
+  //////////////////////////////////////////////////////////////////////////////
   virtual size_t hash() const noexcept {
-    return std::hash<type_info::type_id>()(type_);
+    return hash_combine(std::hash<type_info::type_id>()(type_),
+                        std::hash<boost_t>()(boost_));
   }
 
   bool operator==(const filter& rhs) const noexcept {
@@ -171,7 +176,7 @@ class IRESEARCH_API filter {
 
  protected:
   virtual bool equals(const filter& rhs) const noexcept {
-    return type_ == rhs.type_;
+    return type_ == rhs.type_ && boost_ == rhs.boost_;
   }
 
  private:
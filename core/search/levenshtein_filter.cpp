@@ -30,6 +30,7 @@
 #include "search/filter_visitor.hpp"
 #include "search/multiterm_query.hpp"
 #include "index/index_reader.hpp"
+#include "utils/automaton_cache.hpp"
 #include "utils/automaton_utils.hpp"
 #include "utils/levenshtein_utils.hpp"
 #include "utils/levenshtein_default_pdp.hpp"
@@ -188,14 +189,15 @@ bool collect_terms(
     const string_ref& field,
     const bytes_ref& term,
     const parametric_description& d,
+    const automaton_cache& cache,
     Collector& collector) {
-  const auto acceptor = make_levenshtein_automaton(d, term);
+  const auto acceptor = cache.levenshtein(d, term);
 
-  if (!validate(acceptor)) {
+  if (!acceptor->valid) {
     return false;
   }
 
-  auto matcher = make_automaton_matcher(acceptor);
+  auto matcher = acceptor->matcher; // matchers are stateful
   const uint32_t utf8_term_size = std::max(1U, uint32_t(utf8_utils::utf8_length(term)));
   const byte_type max_distance = d.max_distance() + 1;
 
@@ -219,7 +221,8 @@ filter::prepared::ptr prepare_levenshtein_filter(
     const string_ref& field,
     const bytes_ref& term,
     size_t terms_limit,
-    const parametric_description& d) {
+    const parametric_description& d,
+    const automaton_cache& cache) {
   field_collectors field_stats(order);
   term_collectors term_stats(order, 1);
   multiterm_query::states_t states(index.size());
@@ -228,13 +231,13 @@ filter::prepared::ptr prepare_levenshtein_filter(
     all_terms_collector<decltype(states)> term_collector(states, field_stats, term_stats);
     term_collector.stat_index(0); // aggregate stats from different terms
 
-    if (!collect_terms(index, field, term, d, term_collector)) {
+    if (!collect_terms(index, field, term, d, cache, term_collector)) {
       return filter::prepared::empty();
     }
   } else {
     top_terms_collector term_collector(terms_limit, field_stats);
 
-    if (!collect_terms(index, field, term, d, term_collector)) {
+    if (!collect_terms(index, field, term, d, cache, term_collector)) {
       return filter::prepared::empty();
     }
 
@@ -282,22 +285,24 @@ DEFINE_FACTORY_DEFAULT(by_edit_distance)
     },
     [&opts](const parametric_description& d) -> field_visitor {
       struct automaton_context : util::noncopyable {
-        automaton_context(const parametric_description& d, const bytes_ref& term)
-          : acceptor(make_levenshtein_automaton(d, term)),
-            matcher(make_automaton_matcher(acceptor)) {
+        explicit automaton_context(automaton_cache::value_type&& acceptor)
+          : acceptor(std::move(acceptor)),
+            matcher(this->acceptor->matcher) {
         }
 
-        automaton acceptor;
-        automaton_table_matcher matcher;
+        automaton_cache::value_type acceptor;
+        automaton_table_matcher matcher; // matchers are stateful
       };
 
-      // FIXME
-      auto ctx = memory::make_shared<automaton_context>(d, opts.term);
+      auto acceptor = automaton_cache::global().levenshtein(d, opts.term);
 
-      if (!validate(ctx->acceptor)) {
+      if (!acceptor->valid) {
         return [](const sub_reader&, const term_reader&, filter_visitor&){};
       }
 
+      // FIXME
+      auto ctx = memory::make_shared<automaton_context>(std::move(acceptor));
+
       const uint32_t utf8_term_size = std::max(1U, uint32_t(utf8_utils::utf8_length(opts.term)));
       const byte_type max_distance = d.max_distance() + 1;
 
@@ -321,7 +326,8 @@ DEFINE_FACTORY_DEFAULT(by_edit_distance)
     size_t scored_terms_limit,
     byte_type max_distance,
     options_type::pdp_f provider,
-    bool with_transpositions) {
+    bool with_transpositions,
+    const automaton_cache* cache /*= nullptr*/) {
   return executeLevenshtein(
     max_distance, provider, with_transpositions,
     []() -> filter::prepared::ptr {
@@ -330,11 +336,24 @@ DEFINE_FACTORY_DEFAULT(by_edit_distance)
     [&index, &order, boost, &field, &term]() -> filter::prepared::ptr {
       return by_term::prepare(index, order, boost, field, term);
     },
-    [&field, &term, scored_terms_limit, &index, &order, boost](
+    [&field, &term, scored_terms_limit, &index, &order, boost, cache](
         const parametric_description& d) -> filter::prepared::ptr {
-      return prepare_levenshtein_filter(index, order, boost, field, term, scored_terms_limit, d);
+      return prepare_levenshtein_filter(index, order, boost, field, term, scored_terms_limit, d,
+                                        cache ? *cache : automaton_cache::global());
     }
   );
 }
 
+filter::prepared::ptr by_edit_distance::prepare(
+    const index_reader& index,
+    const order::prepared& order,
+    boost_t boost,
+    const attribute_provider* ctx) const {
+  return prepare(index, order, this->boost()*boost,
+                 field(), options().term, options().max_terms,
+                 options().max_distance, options().provider,
+                 options().with_transpositions,
+                 &automaton_cache::from(ctx));
+}
+
 }
@@ -28,6 +28,7 @@
 
 namespace iresearch {
 
+class automaton_cache;
 class by_edit_distance;
 class parametric_description;
 struct filter_visitor;
@@ -106,6 +107,9 @@ class IRESEARCH_API by_edit_distance final
  public:
   DECLARE_FACTORY();
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// @param cache cache of compiled automata, nullptr - the global one
+  //////////////////////////////////////////////////////////////////////////////
   static prepared::ptr prepare(
     const index_reader& index,
     const order::prepared& order,
@@ -115,7 +119,8 @@ class IRESEARCH_API by_edit_distance final
     size_t terms_limit,
     byte_type max_distance,
     options_type::pdp_f provider,
-    bool with_transpositions);
+    bool with_transpositions,
+    const automaton_cache* cache = nullptr);
 
   static field_visitor visitor(
     const options_type::filter_options& options);
@@ -123,15 +128,10 @@ class IRESEARCH_API by_edit_distance final
   using filter::prepare;
 
   virtual filter::prepared::ptr prepare(
-      const index_reader& index,
-      const order::prepared& order,
-      boost_t boost,
-      const attribute_provider* /*ctx*/) const override {
-    return prepare(index, order, this->boost()*boost,
-                   field(), options().term, options().max_terms,
-                   options().max_distance, options().provider,
-                   options().with_transpositions);
-  }
+    const index_reader& index,
+    const order::prepared& order,
+    boost_t boost,
+    const attribute_provider* ctx) const override;
 }; // by_edit_distance
 
 }
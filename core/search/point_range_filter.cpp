@@ -0,0 +1,118 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "point_range_filter.hpp"
+
+#include "index/index_reader.hpp"
+#include "search/bitset_doc_iterator.hpp"
+#include "utils/bitset.hpp"
+#include "utils/bkd_tree.hpp"
+
+namespace {
+
+using namespace irs;
+
+class point_range_query final : public filter::prepared {
+ public:
+  point_range_query(
+      const std::string& field,
+      const by_point_range_options& options,
+      bstring&& stats,
+      boost_t boost)
+    : filter::prepared(boost),
+      field_(field),
+      options_(options),
+      stats_(std::move(stats)) {
+  }
+
+  virtual doc_iterator::ptr execute(
+      const sub_reader& segment,
+      const order::prepared& ord,
+      const attribute_provider* /*ctx*/) const override {
+    const auto* field = segment.field(field_);
+
+    if (!field) {
+      return doc_iterator::empty();
+    }
+
+    const auto* tree = irs::get<bkd_tree>(*field);
+
+    if (!tree) {
+      return doc_iterator::empty();
+    }
+
+    bitset docs(doc_limits::min() + segment.docs_count());
+    bool empty = true;
+
+    tree->visit(options_.min, options_.max, [&docs, &empty](doc_id_t doc) {
+      docs.set(doc);
+      empty = false;
+    });
+
+    if (empty) {
+      return doc_iterator::empty();
+    }
+
+    // leaf blocks of a tree aren't aware of deleted documents
+    return segment.mask(memory::make_managed<bitset_doc_iterator>(
+      segment, stats_.c_str(), std::move(docs), ord, boost()));
+  }
+
+ private:
+  std::string field_;
+  by_point_range_options options_;
+  bstring stats_;
+}; // point_range_query
+
+}
+
+namespace iresearch {
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                     by_point_range implementation
+// -----------------------------------------------------------------------------
+
+DEFINE_FACTORY_DEFAULT(by_point_range)
+
+filter::prepared::ptr by_point_range::prepare(
+    const index_reader& reader,
+    const order::prepared& order,
+    boost_t filter_boost,
+    const attribute_provider* /*ctx*/) const {
+  const auto& options = this->options();
+
+  if (options.min.empty() || options.min.size() != options.max.size()) {
+    return prepared::empty();
+  }
+
+  // skip field-level/term-level statistics because there are no explicit
+  // terms, but still collect index-level statistics
+  bstring stats(order.stats_size(), 0);
+  auto* stats_buf = const_cast<byte_type*>(stats.data());
+
+  order.prepare_collectors(stats_buf, reader);
+
+  filter_boost *= boost();
+
+  return memory::make_managed<point_range_query>(
+    field(), options, std::move(stats), filter_boost);
+}
+
+} // ROOT
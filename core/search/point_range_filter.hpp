@@ -0,0 +1,74 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IRESEARCH_POINT_RANGE_FILTER_H
+#define IRESEARCH_POINT_RANGE_FILTER_H
+
+#include "filter.hpp"
+#include "utils/string.hpp"
+
+namespace iresearch {
+
+class by_point_range;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @struct by_point_range_options
+/// @brief options for point range filter, bounds are packed the same way as
+///        the points of a field, i.e. 'bkd_tree::BYTES_PER_DIM' bytes per
+///        dimension produced by bkd_tree::encode(...)
+////////////////////////////////////////////////////////////////////////////////
+struct IRESEARCH_API by_point_range_options {
+  using filter_type = by_point_range;
+
+  bstring min; // inclusive lower bound of every dimension
+  bstring max; // inclusive upper bound of every dimension
+
+  bool operator==(const by_point_range_options& rhs) const noexcept {
+    return min == rhs.min && max == rhs.max;
+  }
+
+  size_t hash() const noexcept {
+    return hash_combine(std::hash<bstring>()(min), std::hash<bstring>()(max));
+  }
+}; // by_point_range_options
+
+//////////////////////////////////////////////////////////////////////////////
+/// @class by_point_range
+/// @brief user-side filter matching documents with at least one point of a
+///        field within the specified bounds, evaluated over the bkd tree of
+///        a field, i.e. fields without 'bkd_tree' feature match nothing
+//////////////////////////////////////////////////////////////////////////////
+class IRESEARCH_API by_point_range final
+    : public filter_base<by_point_range_options> {
+ public:
+  DECLARE_FACTORY();
+
+  using filter::prepare;
+
+  virtual filter::prepared::ptr prepare(
+    const index_reader& rdr,
+    const order::prepared& ord,
+    boost_t boost,
+    const attribute_provider* ctx) const override;
+}; // by_point_range
+
+} // ROOT
+
+#endif // IRESEARCH_POINT_RANGE_FILTER_H
@@ -0,0 +1,55 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "prepared_cache.hpp"
+
+namespace iresearch {
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                    prepared_cache
+// -----------------------------------------------------------------------------
+
+prepared_cache::value_type prepared_cache::prepare(
+    const index_reader::ptr& reader,
+    const std::shared_ptr<const filter>& filter,
+    boost_t boost,
+    const attribute_provider* ctx) const {
+  assert(reader && filter);
+
+  if (!cache_.max_weight()) {
+    return filter->prepare(*reader, order_, boost, ctx);
+  }
+
+  key query_key{ filter, boost };
+
+  if (auto cached = cache_.get(reader, query_key)) {
+    return cached;
+  }
+
+  // prepare outside of the lock, concurrent misses of the same query may
+  // prepare it several times, only the first one gets cached
+  value_type value = filter->prepare(*reader, order_, boost, ctx);
+
+  cache_.put(reader, std::move(query_key), value, 1);
+
+  return value;
+}
+
+}
@@ -0,0 +1,136 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IRESEARCH_PREPARED_CACHE_H
+#define IRESEARCH_PREPARED_CACHE_H
+
+#include <memory>
+
+#include "index/index_reader.hpp"
+#include "search/filter.hpp"
+#include "search/sort.hpp"
+#include "utils/lru_cache.hpp"
+#include "utils/noncopyable.hpp"
+
+namespace iresearch {
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class prepared_cache
+/// @brief a thread-safe LRU cache of queries prepared for generations of an
+///        index, i.e. instances of 'index_reader', with a specified order,
+///        allowing repeated queries to skip term lookups and collection of
+///        statistics, the cache is disabled while 'max_size' is 0
+/// @note queries are keyed by a generation, a filter (including boosts of
+///       the filter and the nested ones) and an external boost, thus queries
+///       for different generations never evict each other explicitly, the
+///       ones of outdated generations are evicted as least recently used
+/// @note a cached query keeps the reader it is prepared for, i.e. files of
+///       an outdated generation are held until its queries are evicted,
+///       see clear()
+////////////////////////////////////////////////////////////////////////////////
+class IRESEARCH_API prepared_cache final : private util::noncopyable {
+ public:
+  typedef std::shared_ptr<const filter::prepared> value_type;
+
+  prepared_cache(irs::order::prepared&& ord, size_t max_size)
+    : order_(std::move(ord)),
+      cache_(max_size) {
+  }
+
+  explicit prepared_cache(size_t max_size)
+    : prepared_cache(irs::order::prepared(), max_size) {
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns query prepared for a specified reader with the order of
+  ///          the cache, either a cached one or a newly prepared one
+  /// @note 'filter' is a part of a key of a cached query, so it must not be
+  ///       modified afterwards
+  /// @note 'ctx' is used by filter::prepare(...) in case of a miss only, thus
+  ///       must not affect a result
+  //////////////////////////////////////////////////////////////////////////////
+  value_type prepare(
+    const index_reader::ptr& reader,
+    const std::shared_ptr<const filter>& filter,
+    boost_t boost = no_boost(),
+    const attribute_provider* ctx = nullptr) const;
+
+  // order the queries are prepared with, has to be used for their execution
+  const irs::order::prepared& order() const noexcept { return order_; }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief evict all queries along with the readers they are prepared for
+  //////////////////////////////////////////////////////////////////////////////
+  void clear() { cache_.clear(); }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief evict all queries prepared for the specified reader
+  //////////////////////////////////////////////////////////////////////////////
+  void clear(const index_reader::ptr& reader) { cache_.erase(reader); }
+
+  // maximum number of cached queries
+  size_t max_size() const noexcept { return cache_.max_weight(); }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief change maximum number of cached queries evicting least recently
+  ///        used ones if needed
+  //////////////////////////////////////////////////////////////////////////////
+  void max_size(size_t value) { cache_.max_weight(value); }
+
+  // number of cached queries
+  size_t size() const { return cache_.size(); }
+
+  // number of lookups that found a cached query
+  size_t hits() const noexcept { return cache_.hits(); }
+
+  // number of lookups that didn't find a cached query
+  size_t misses() const noexcept { return cache_.misses(); }
+
+  // state of the cache, 'weight' is the number of cached queries
+  lru_cache_stats stats() const { return cache_.stats(); }
+
+ private:
+  struct key {
+    std::shared_ptr<const irs::filter> filter;
+    boost_t boost; // external boost
+  }; // key
+
+  struct key_hash {
+    size_t operator()(const key& value) const noexcept {
+      return value.filter->hash();
+    }
+  }; // key_hash
+
+  struct key_equal {
+    bool operator()(const key& lhs, const key& rhs) const noexcept {
+      return lhs.boost == rhs.boost && *lhs.filter == *rhs.filter;
+    }
+  }; // key_equal
+
+  IRESEARCH_API_PRIVATE_VARIABLES_BEGIN
+  irs::order::prepared order_;
+  mutable lru_cache<index_reader::ptr, key, value_type,
+                    std::hash<index_reader::ptr>, key_hash, key_equal> cache_; // queries by generation and key
+  IRESEARCH_API_PRIVATE_VARIABLES_END
+}; // prepared_cache
+
+}
+
+#endif // IRESEARCH_PREPARED_CACHE_H
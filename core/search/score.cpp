@@ -131,4 +131,57 @@ void reset(irs::score& score, order::prepared::scorers&& scorers) {
   }
 }
 
+// ----------------------------------------------------------------------------
+// --SECTION--                                                           impact
+// ----------------------------------------------------------------------------
+
+REGISTER_ATTRIBUTE(impact);
+
+bool impact::prepare(
+    const order::prepared& ord,
+    const byte_type* stats,
+    boost_t boost) {
+  bucket_ = nullptr;
+
+  if (1 != ord.size() || !ord.front().reverse) {
+    return false;
+  }
+
+  const auto& bucket = ord.front();
+  assert(!bucket.score_offset);
+
+  max_.resize(ord.score_size());
+  if (!bucket.bucket->max_score(&max_[0], stats + bucket.stats_offset,
+                                max_freq_, boost)) {
+    return false;
+  }
+
+  block_max_.resize(ord.score_size());
+  block_max_score_freq_ = max_freq_;
+  std::memcpy(&block_max_[0], max_.c_str(), max_.size());
+
+  bucket_ = bucket.bucket.get();
+  stats_ = stats + bucket.stats_offset;
+  boost_ = boost;
+
+  return true;
+}
+
+const byte_type* impact::block_max() {
+  assert(prepared());
+
+  if (block_max_freq_ != block_max_score_freq_) {
+    bucket_->max_score(&block_max_[0], stats_, block_max_freq_, boost_);
+    block_max_score_freq_ = block_max_freq_;
+  }
+
+  return block_max_.c_str();
+}
+
+// ----------------------------------------------------------------------------
+// --SECTION--                                                  score_threshold
+// ----------------------------------------------------------------------------
+
+REGISTER_ATTRIBUTE(score_threshold);
+
 } // ROOT
@@ -56,6 +56,27 @@ class IRESEARCH_API score : public attribute {
     return func_();
   }
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns true if scores of multiple documents can be evaluated at once,
+  ///          i.e. score depends only on frequencies and norms exposed by
+  ///          'postings_block' of the same iterator
+  //////////////////////////////////////////////////////////////////////////////
+  bool is_batched() const noexcept {
+    return nullptr != func_.batch();
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief evaluate scores of 'count' documents with the specified term
+  ///        frequencies and quantized norms, scores of the only applicable
+  ///        scorer are written to 'scores' one after another, which matches
+  ///        scores of 'size()' bytes each for orders of a single bucket only
+  //////////////////////////////////////////////////////////////////////////////
+  void evaluate(const uint32_t* freqs, const byte_type* norms,
+                size_t count, byte_type* scores) const {
+    assert(is_batched());
+    func_(freqs, norms, count, scores);
+  }
+
   //////////////////////////////////////////////////////////////////////////////
   /// @brief reset score to default value
   //////////////////////////////////////////////////////////////////////////////
@@ -64,7 +85,8 @@ class IRESEARCH_API score : public attribute {
   void reset(const score& score) noexcept {
     assert(score.func_);
     func_.reset(const_cast<score_ctx*>(score.func_.ctx()),
-                score.func_.func());
+                score.func_.func(),
+                score.func_.batch());
   }
 
   void reset(std::unique_ptr<score_ctx>&& ctx, const score_f func) noexcept {
@@ -112,6 +134,103 @@ class IRESEARCH_API score : public attribute {
 IRESEARCH_API void reset(
   irs::score& score, order::prepared::scorers&& scorers);
 
+////////////////////////////////////////////////////////////////////////////////
+/// @class impact
+/// @brief represents upper bounds of the term frequency (and hence of the
+///        score) within the whole postings list and within the block of
+///        postings the iterator is positioned at, exposed by iterators over
+///        postings storing per-block impact metadata
+////////////////////////////////////////////////////////////////////////////////
+class IRESEARCH_API impact : public attribute {
+ public:
+  static constexpr string_ref type_name() noexcept {
+    return "iresearch::impact";
+  }
+
+  virtual ~impact() = default;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief moves impact window to the block of postings containing
+  ///        the specified 'target' without decoding the block itself
+  /// @returns the last document the block-level bound is valid for,
+  ///          doc_limits::eof() in case of the last block
+  /// @note 'target' must not decrease between the calls
+  //////////////////////////////////////////////////////////////////////////////
+  virtual doc_id_t shallow_seek(doc_id_t target) = 0;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns max frequency of a term within the whole postings list
+  //////////////////////////////////////////////////////////////////////////////
+  uint32_t max_freq() const noexcept { return max_freq_; }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns max frequency of a term within the current block of postings
+  //////////////////////////////////////////////////////////////////////////////
+  uint32_t block_max_freq() const noexcept { return block_max_freq_; }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief bind impact to a scorer in order to translate frequency bounds
+  ///        into score bounds
+  /// @returns true if bounds are available for the specified order, i.e.
+  ///          order consists of a single descending bucket capable of
+  ///          evaluating score upper bounds
+  //////////////////////////////////////////////////////////////////////////////
+  bool prepare(const order::prepared& ord, const byte_type* stats, boost_t boost);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns true if score bounds are available
+  //////////////////////////////////////////////////////////////////////////////
+  bool prepared() const noexcept { return nullptr != bucket_; }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns upper bound of a score within the whole postings list
+  //////////////////////////////////////////////////////////////////////////////
+  const byte_type* max() const noexcept {
+    assert(prepared());
+    return max_.c_str();
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns upper bound of a score within the current block of postings
+  //////////////////////////////////////////////////////////////////////////////
+  const byte_type* block_max();
+
+ protected:
+  uint32_t max_freq_{};
+  uint32_t block_max_freq_{};
+
+ private:
+  IRESEARCH_API_PRIVATE_VARIABLES_BEGIN
+  const sort::prepared* bucket_{};
+  const byte_type* stats_{};
+  bstring max_;
+  bstring block_max_;
+  boost_t boost_{no_boost()};
+  uint32_t block_max_score_freq_{}; // frequency 'block_max_' is evaluated for
+  IRESEARCH_API_PRIVATE_VARIABLES_END
+}; // impact
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class score_threshold
+/// @brief represents the score a document has to beat in order to get into
+///        the result set, filled by top-k consumers and used by iterators to
+///        skip documents which can't compete
+/// @note iterators exposing the attribute may omit documents not ranked
+///       strictly before the threshold once the threshold is set
+////////////////////////////////////////////////////////////////////////////////
+struct IRESEARCH_API score_threshold final : attribute {
+  static constexpr string_ref type_name() noexcept {
+    return "iresearch::score_threshold";
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns true if the threshold isn't set yet
+  //////////////////////////////////////////////////////////////////////////////
+  bool empty() const noexcept { return value.empty(); }
+
+  bstring value; // score value of 'order::prepared::score_size()' bytes
+}; // score_threshold
+
 } // ROOT
 
 #endif // IRESEARCH_SCORE_H
@@ -59,15 +59,19 @@ score_function::score_function() noexcept
 
 score_function::score_function(score_function&& rhs) noexcept
   : ctx_(std::move(rhs.ctx_)),
-    func_(rhs.func_) {
+    func_(rhs.func_),
+    batch_(rhs.batch_) {
   rhs.func_ = &::no_score;
+  rhs.batch_ = nullptr;
 }
 
 score_function& score_function::operator=(score_function&& rhs) noexcept {
   if (this != &rhs) {
     ctx_ = std::move(rhs.ctx_);
     func_ = rhs.func_;
+    batch_ = rhs.batch_;
     rhs.func_ = &::no_score;
+    rhs.batch_ = nullptr;
   }
   return *this;
 }
@@ -72,6 +72,16 @@ struct IRESEARCH_API score_ctx {
 using score_less_f = bool(*)(const byte_type* lhs, const byte_type* rhs);
 using score_f = const byte_type*(*)(score_ctx* ctx);
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief evaluate scores of 'count' documents at once given their term
+///        frequencies 'freqs' and quantized norms 'norms' (may be nullptr if
+///        not used by a scorer), scores are written to 'scores' one after
+///        another
+////////////////////////////////////////////////////////////////////////////////
+using score_batch_f = void(*)(score_ctx* ctx, const uint32_t* freqs,
+                              const byte_type* norms, size_t count,
+                              byte_type* scores);
+
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief combine range of scores denoted by 'src' and 'size' to 'dst',
 ///        i.e. using +=
@@ -89,19 +99,23 @@ using merge_f = void(*)(const order_bucket* ctx,
 
 ////////////////////////////////////////////////////////////////////////////////
 /// @class score_function
-/// @brief a convenient wrapper around score_f and score_ctx
+/// @brief a convenient wrapper around score_f and score_ctx, optionally
+///        accompanied by score_batch_f sharing the same context
 ////////////////////////////////////////////////////////////////////////////////
 class score_function : util::noncopyable {
  public:
   score_function() noexcept;
-  score_function(memory::managed_ptr<score_ctx>&& ctx, const score_f func) noexcept
-    : ctx_(std::move(ctx)), func_(func) {
+  score_function(memory::managed_ptr<score_ctx>&& ctx, const score_f func,
+                 const score_batch_f batch = nullptr) noexcept
+    : ctx_(std::move(ctx)), func_(func), batch_(batch) {
   }
-  score_function(std::unique_ptr<score_ctx>&& ctx, const score_f func) noexcept
-    : score_function(memory::to_managed<score_ctx>(std::move(ctx)), func) {
+  score_function(std::unique_ptr<score_ctx>&& ctx, const score_f func,
+                 const score_batch_f batch = nullptr) noexcept
+    : score_function(memory::to_managed<score_ctx>(std::move(ctx)), func, batch) {
   }
-  score_function(score_ctx* ctx, const score_f func) noexcept
-    : score_function(memory::to_managed<score_ctx, false>(std::move(ctx)), func) {
+  score_function(score_ctx* ctx, const score_f func,
+                 const score_batch_f batch = nullptr) noexcept
+    : score_function(memory::to_managed<score_ctx, false>(std::move(ctx)), func, batch) {
   }
   score_function(score_function&& rhs) noexcept;
   score_function& operator=(score_function&& rhs) noexcept;
@@ -111,8 +125,14 @@ class score_function : util::noncopyable {
     return func_(ctx_.get());
   }
 
+  void operator()(const uint32_t* freqs, const byte_type* norms,
+                  size_t count, byte_type* scores) const {
+    assert(batch_);
+    batch_(ctx_.get(), freqs, norms, count, scores);
+  }
+
   bool operator==(const score_function& rhs) const noexcept {
-    return ctx_ == rhs.ctx_ && func_ == rhs.func_;
+    return ctx_ == rhs.ctx_ && func_ == rhs.func_ && batch_ == rhs.batch_;
   }
 
   bool operator!=(const score_function& rhs) const noexcept {
@@ -121,20 +141,27 @@ class score_function : util::noncopyable {
 
   const score_ctx* ctx() const noexcept { return ctx_.get(); }
   score_f func() const noexcept { return func_; }
+  score_batch_f batch() const noexcept { return batch_; }
 
-  void reset(memory::managed_ptr<score_ctx>&& ctx, const score_f func) noexcept {
+  void reset(memory::managed_ptr<score_ctx>&& ctx, const score_f func,
+             const score_batch_f batch = nullptr) noexcept {
     ctx_ = std::move(ctx);
     func_ = func;
+    batch_ = batch;
   }
 
-  void reset(std::unique_ptr<score_ctx>&& ctx, const score_f func) noexcept {
+  void reset(std::unique_ptr<score_ctx>&& ctx, const score_f func,
+             const score_batch_f batch = nullptr) noexcept {
     ctx_ = memory::to_managed<score_ctx>(std::move(ctx));
     func_ = func;
+    batch_ = batch;
   }
 
-  void reset(score_ctx* ctx, const score_f func) noexcept {
+  void reset(score_ctx* ctx, const score_f func,
+             const score_batch_f batch = nullptr) noexcept {
     ctx_ = memory::to_managed<score_ctx, false>(ctx);
     func_ = func;
+    batch_ = batch;
   }
 
   explicit operator bool() const noexcept {
@@ -144,6 +171,7 @@ class score_function : util::noncopyable {
  private:
   memory::managed_ptr<score_ctx> ctx_;
   score_f func_;
+  score_batch_f batch_{}; // optional
 }; // score_function
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -375,6 +403,8 @@ class IRESEARCH_API sort {
 
     ////////////////////////////////////////////////////////////////////////////////
     /// @brief create a stateful scorer used for computation of document scores
+    /// @note scorer may provide batch evaluation in case scores depend on term
+    ///       frequencies and norms exposed by 'postings_block' only
     ////////////////////////////////////////////////////////////////////////////////
     virtual score_function prepare_scorer(
       const sub_reader& segment,
@@ -391,6 +421,20 @@ class IRESEARCH_API sort {
     ////////////////////////////////////////////////////////////////////////////
     virtual term_collector::ptr prepare_term_collector() const = 0;
 
+    ////////////////////////////////////////////////////////////////////////////////
+    /// @brief evaluate an upper bound of a score a scorer prepared with the
+    ///        specified 'stats' and 'boost' may produce for a document with
+    ///        term frequency not greater than 'freq'
+    /// @returns false if scorer is not able to provide score upper bounds
+    ////////////////////////////////////////////////////////////////////////////////
+    virtual bool max_score(
+        byte_type* /*score*/,
+        const byte_type* /*stats*/,
+        uint32_t /*freq*/,
+        boost_t /*boost*/) const {
+      return false;
+    }
+
     ////////////////////////////////////////////////////////////////////////////////
     /// @brief compare two score containers and determine if 'lhs' < 'rhs', i.e. <
     ////////////////////////////////////////////////////////////////////////////////
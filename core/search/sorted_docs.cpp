@@ -0,0 +1,246 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "sorted_docs.hpp"
+
+#include <algorithm>
+
+#include "index/comparer.hpp"
+#include "index/index_reader.hpp"
+
+namespace {
+
+using namespace irs;
+
+// stored values are empty for documents without a value
+inline bytes_ref value_ref(const bstring& value) noexcept {
+  return value.empty() ? bytes_ref::NIL : bytes_ref(value);
+}
+
+inline void assign(bstring& dst, const bytes_ref& src) {
+  if (src.null()) {
+    dst.clear();
+  } else {
+    dst.assign(src.c_str(), src.size());
+  }
+}
+
+}
+
+namespace iresearch {
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                             sorted_docs_collector
+// -----------------------------------------------------------------------------
+
+sorted_docs_collector::sorted_docs_collector(
+    std::vector<sort_key>&& keys, size_t k)
+  : keys_(std::move(keys)),
+    values_(keys_.size()),
+    k_(k) {
+  docs_.reserve(k);
+  readers_.reserve(keys_.size());
+}
+
+bool sorted_docs_collector::less(
+    size_t key, const bytes_ref& lhs, const bytes_ref& rhs) const {
+  const auto& less = keys_[key].less;
+  const auto& first = keys_[key].reverse ? rhs : lhs;
+  const auto& second = keys_[key].reverse ? lhs : rhs;
+
+  return less ? (*less)(first, second) : first < second;
+}
+
+bool sorted_docs_collector::less(
+    const bytes_ref* lhs_values, size_t lhs_segment,
+    doc_id_t lhs_doc, const sorted_doc& rhs) const {
+  for (size_t i = 0, size = keys_.size(); i < size; ++i) {
+    const auto rhs_value = value_ref(rhs.values[i]);
+
+    if (less(i, lhs_values[i], rhs_value)) {
+      return true;
+    }
+
+    if (less(i, rhs_value, lhs_values[i])) {
+      return false;
+    }
+  }
+
+  return lhs_segment < rhs.segment
+    || (lhs_segment == rhs.segment && lhs_doc < rhs.doc);
+}
+
+bool sorted_docs_collector::less(
+    const sorted_doc& lhs, const sorted_doc& rhs) const {
+  for (size_t i = 0, size = keys_.size(); i < size; ++i) {
+    const auto lhs_value = value_ref(lhs.values[i]);
+    const auto rhs_value = value_ref(rhs.values[i]);
+
+    if (less(i, lhs_value, rhs_value)) {
+      return true;
+    }
+
+    if (less(i, rhs_value, lhs_value)) {
+      return false;
+    }
+  }
+
+  return lhs.segment < rhs.segment
+    || (lhs.segment == rhs.segment && lhs.doc < rhs.doc);
+}
+
+void sorted_docs_collector::collect(
+    size_t offset,
+    const sub_reader& segment,
+    doc_iterator& docs) {
+  if (!k_) {
+    return;
+  }
+
+  readers_.clear();
+
+  for (auto& key : keys_) {
+    const auto* column = key.column.empty()
+      ? segment.sort()
+      : segment.column_reader(key.column);
+
+    readers_.emplace_back(column
+      ? column->values()
+      : columnstore_reader::empty_reader());
+  }
+
+  // documents of a segment follow the order of its primary sort key
+  const bool sorted = !keys_.empty()
+    && keys_.front().column.empty()
+    && !keys_.front().reverse
+    && segment.sort();
+
+  const auto less = [this](const sorted_doc& lhs, const sorted_doc& rhs) {
+    return this->less(lhs, rhs);
+  };
+
+  const auto read = [this](size_t key, doc_id_t doc) {
+    if (!readers_[key](doc, values_[key])) {
+      values_[key] = bytes_ref::NIL;
+    }
+  };
+
+  while (docs.next()) {
+    const auto doc = docs.value();
+    ++visited_;
+
+    size_t key = 0;
+
+    if (docs_.size() == k_ && !keys_.empty()) {
+      // reject document by the first key without reading the others
+      read(key++, doc);
+
+      if (this->less(0, value_ref(docs_.front().values.front()), values_.front())) {
+        if (sorted) {
+          // the rest of documents rank after the worst collected one
+          break;
+        }
+
+        continue;
+      }
+    }
+
+    for (const auto size = keys_.size(); key < size; ++key) {
+      read(key, doc);
+    }
+
+    if (docs_.size() < k_) {
+      docs_.emplace_back();
+    } else if (this->less(values_.data(), offset, doc, docs_.front())) {
+      // replace the worst document
+      std::pop_heap(docs_.begin(), docs_.end(), less);
+    } else {
+      continue;
+    }
+
+    auto& entry = docs_.back();
+    entry.values.resize(keys_.size());
+    for (size_t i = 0, size = keys_.size(); i < size; ++i) {
+      assign(entry.values[i], values_[i]);
+    }
+    entry.segment = offset;
+    entry.doc = doc;
+    std::push_heap(docs_.begin(), docs_.end(), less);
+  }
+}
+
+void sorted_docs_collector::merge(sorted_docs_collector&& other) {
+  assert(keys_.size() == other.keys_.size() && k_ == other.k_);
+
+  const auto less = [this](const sorted_doc& lhs, const sorted_doc& rhs) {
+    return this->less(lhs, rhs);
+  };
+
+  if (docs_.size() < other.docs_.size()) {
+    std::swap(docs_, other.docs_);
+  }
+
+  for (auto& doc : other.docs_) {
+    if (docs_.size() < k_) {
+      docs_.emplace_back(std::move(doc));
+      std::push_heap(docs_.begin(), docs_.end(), less);
+    } else if (less(doc, docs_.front())) {
+      std::pop_heap(docs_.begin(), docs_.end(), less);
+      docs_.back() = std::move(doc);
+      std::push_heap(docs_.begin(), docs_.end(), less);
+    }
+  }
+
+  visited_ += other.visited_;
+  other.docs_.clear();
+  other.visited_ = 0;
+}
+
+std::vector<sorted_doc> sorted_docs_collector::finish() {
+  std::sort_heap(
+    docs_.begin(), docs_.end(),
+    [this](const sorted_doc& lhs, const sorted_doc& rhs) {
+      return less(lhs, rhs);
+  });
+
+  return std::move(docs_);
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                            sorted top-k execution
+// -----------------------------------------------------------------------------
+
+std::vector<sorted_doc> execute_sorted_top_k(
+    const index_reader& index,
+    const filter::prepared& query,
+    std::vector<sort_key> keys,
+    size_t k) {
+  sorted_docs_collector collector(std::move(keys), k);
+
+  for (size_t i = 0, size = index.size(); i < size; ++i) {
+    const auto& segment = index[i];
+    auto docs = query.execute(segment, order::prepared::unordered());
+    collector.collect(i, segment, *docs);
+  }
+
+  return collector.finish();
+}
+
+}
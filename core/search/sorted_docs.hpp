@@ -0,0 +1,138 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IRESEARCH_SORTED_DOCS_H
+#define IRESEARCH_SORTED_DOCS_H
+
+#include <vector>
+
+#include "shared.hpp"
+#include "formats/formats.hpp"
+#include "search/filter.hpp"
+#include "utils/string.hpp"
+#include "utils/type_limits.hpp"
+
+namespace iresearch {
+
+class comparer;
+struct index_reader;
+struct sub_reader;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @struct sort_key
+/// @brief a key to order documents by the values of a stored column
+////////////////////////////////////////////////////////////////////////////////
+struct sort_key {
+  std::string column; // column name, empty - column of the primary sort key
+                      // of a segment, i.e. 'sub_reader::sort()'
+  const comparer* less{}; // order of values, nullptr - bytewise order
+  bool reverse{}; // order documents by descending values
+}; // sort_key
+
+////////////////////////////////////////////////////////////////////////////////
+/// @struct sorted_doc
+/// @brief document matched by a query along with its sort values
+////////////////////////////////////////////////////////////////////////////////
+struct sorted_doc {
+  std::vector<bstring> values; // value per sort key, empty if missing
+  size_t segment{}; // offset of a segment within a reader
+  doc_id_t doc{ doc_limits::invalid() }; // segment local document id
+}; // sorted_doc
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class sorted_docs_collector
+/// @brief collects 'k' first documents according to the values of the
+///        specified sort keys, ties are resolved in favor of documents having
+///        lesser (segment, doc) pair
+/// @note documents without a value are ordered as having 'bytes_ref::NIL',
+///       the same way as done by 'index_writer' for the primary sort key,
+///       an empty value is treated as a missing one
+////////////////////////////////////////////////////////////////////////////////
+class IRESEARCH_API sorted_docs_collector : private util::noncopyable {
+ public:
+  sorted_docs_collector(std::vector<sort_key>&& keys, size_t k);
+  sorted_docs_collector(sorted_docs_collector&&) = default;
+  sorted_docs_collector& operator=(sorted_docs_collector&&) = default;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief collect documents of a segment matched by a specified iterator
+  /// @param offset offset of a segment within a reader
+  /// @note if the first key is the ascending primary sort key, i.e. the order
+  ///       of documents within a segment, then collection stops as soon as a
+  ///       document ranks after the worst of the 'k' collected ones, so that
+  ///       at most 'k' documents of a segment having distinct values are
+  ///       visited, the 'comparer' of such key must be the one the segments
+  ///       were written with
+  //////////////////////////////////////////////////////////////////////////////
+  void collect(size_t offset, const sub_reader& segment, doc_iterator& docs);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief merge documents collected by another collector sharing the same
+  ///        keys and 'k'
+  //////////////////////////////////////////////////////////////////////////////
+  void merge(sorted_docs_collector&& other);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns collected documents, first ranked first
+  //////////////////////////////////////////////////////////////////////////////
+  std::vector<sorted_doc> finish();
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns number of documents visited so far
+  //////////////////////////////////////////////////////////////////////////////
+  size_t visited() const noexcept { return visited_; }
+
+  size_t size() const noexcept { return docs_.size(); }
+  bool empty() const noexcept { return docs_.empty(); }
+
+ private:
+  // true if 'lhs' value of the specified key ranks before 'rhs' one
+  bool less(size_t key, const bytes_ref& lhs, const bytes_ref& rhs) const;
+
+  // true if document denoted by 'lhs_*' ranks before 'rhs'
+  bool less(const bytes_ref* lhs_values, size_t lhs_segment,
+            doc_id_t lhs_doc, const sorted_doc& rhs) const;
+
+  bool less(const sorted_doc& lhs, const sorted_doc& rhs) const;
+
+  IRESEARCH_API_PRIVATE_VARIABLES_BEGIN
+  std::vector<sort_key> keys_;
+  std::vector<sorted_doc> docs_; // max heap, worst document first
+  std::vector<columnstore_reader::values_reader_f> readers_; // per key
+  std::vector<bytes_ref> values_; // values of the current document
+  size_t k_;
+  size_t visited_{};
+  IRESEARCH_API_PRIVATE_VARIABLES_END
+}; // sorted_docs_collector
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief executes a prepared query against every segment of a specified
+///        reader and returns 'k' first documents ordered by the values of
+///        the specified keys, first ranked first
+////////////////////////////////////////////////////////////////////////////////
+IRESEARCH_API std::vector<sorted_doc> execute_sorted_top_k(
+  const index_reader& index,
+  const filter::prepared& query,
+  std::vector<sort_key> keys,
+  size_t k);
+
+}
+
+#endif // IRESEARCH_SORTED_DOCS_H
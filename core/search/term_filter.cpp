@@ -26,6 +26,7 @@
 #include "search/filter_visitor.hpp"
 #include "search/collectors.hpp"
 #include "search/term_query.hpp"
+#include "utils/bloom_filter.hpp"
 
 namespace {
 
@@ -80,6 +81,13 @@ void visit(
     const term_reader& field,
     const bytes_ref& term,
     Visitor& visitor) {
+  // skip segments which definitely don't contain the term
+  const auto* bloom = irs::get<bloom_filter>(field);
+
+  if (bloom && !bloom->contains(term)) {
+    return;
+  }
+
   // find term
   auto terms = field.iterator();
 
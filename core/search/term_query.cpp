@@ -78,6 +78,13 @@ doc_iterator::ptr term_query::execute(
         *docs, boost());
 
       irs::reset(*score, std::move(scorers));
+
+      auto* impact = irs::get_mutable<irs::impact>(docs.get());
+
+      if (impact) {
+        // translate frequency bounds into score bounds
+        impact->prepare(ord, stats_.c_str(), boost());
+      }
     }
   }
 
@@ -290,6 +290,69 @@ struct norm_score_ctx final : public score_ctx {
   irs::norm norm_;
 }; // norm_score_ctx
 
+struct quantized_norm_score_ctx final : public score_ctx {
+  quantized_norm_score_ctx(
+      byte_type* score_buf,
+      const quantized_norm* norm,
+      boost_t boost,
+      const tfidf::idf& idf,
+      const frequency* freq,
+      const struct filter_boost* fb = nullptr) noexcept
+    : score_ctx(score_buf, boost, idf, freq, fb),
+      norm_(norm) {
+    assert(norm_);
+  }
+
+  const quantized_norm* norm_; // norm stored inline with postings
+}; // quantized_norm_score_ctx
+
+// number of documents scored in one pass by batch scorers
+constexpr size_t BATCH_SIZE = 64;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief evaluates scores of a batch of documents, tf and norm lookups are
+///        separated from the arithmetic so that the latter runs over plain
+///        arrays of floats and gets vectorized by the compiler
+////////////////////////////////////////////////////////////////////////////////
+template<typename Ctx>
+void score_batch(
+    irs::score_ctx* ctx,
+    const uint32_t* freqs,
+    const byte_type* norms,
+    size_t count,
+    byte_type* scores) noexcept {
+  constexpr bool HAS_NORMS = std::is_same_v<Ctx, quantized_norm_score_ctx>;
+
+  auto& state = *static_cast<Ctx*>(ctx);
+  auto* out = reinterpret_cast<score_t*>(scores);
+  assert(freqs && (!HAS_NORMS || norms));
+
+  float_t tf[BATCH_SIZE];
+  float_t norm[BATCH_SIZE];
+
+  for (size_t offset = 0; offset < count; offset += BATCH_SIZE) {
+    const size_t size = std::min(count - offset, BATCH_SIZE);
+
+    for (size_t i = 0; i < size; ++i) {
+      tf[i] = ::SQRT(freqs[offset + i]);
+    }
+
+    if constexpr (HAS_NORMS) {
+      for (size_t i = 0; i < size; ++i) {
+        norm[i] = quantized_norm::decode(norms[offset + i]);
+      }
+
+      for (size_t i = 0; i < size; ++i) {
+        out[offset + i] = state.idf * tf[i] * norm[i];
+      }
+    } else {
+      for (size_t i = 0; i < size; ++i) {
+        out[offset + i] = state.idf * tf[i];
+      }
+    }
+  }
+}
+
 class sort final: public irs::prepared_sort_basic<tfidf::score_t, tfidf::idf> {
  public:
   explicit sort(bool normalize, bool boost_as_score) noexcept
@@ -365,6 +428,38 @@ class sort final: public irs::prepared_sort_basic<tfidf::score_t, tfidf::idf> {
 
     // add norm attribute if requested
     if (normalize_) {
+      // prefer normalization factors stored along with postings
+      // over random access to the norm column
+      auto* quantized_norm = irs::get<irs::quantized_norm>(doc_attrs);
+
+      if (quantized_norm) {
+        if (filter_boost) {
+          return {
+            memory::make_unique<tfidf::quantized_norm_score_ctx>(score_buf, quantized_norm, boost, stats, freq, filter_boost),
+            [](irs::score_ctx* ctx) noexcept -> const byte_type* {
+              auto& state = *static_cast<tfidf::quantized_norm_score_ctx*>(ctx);
+              assert(state.filter_boost);
+              irs::sort::score_cast<tfidf::score_t>(state.score_buf) = ::tfidf(state.freq->value,
+                                                                               state.idf * state.filter_boost->value) *
+                                                                       state.norm_->read();
+
+              return state.score_buf;
+            }
+          };
+        } else {
+          return {
+            memory::make_unique<tfidf::quantized_norm_score_ctx>(score_buf, quantized_norm, boost, stats, freq),
+            [](irs::score_ctx* ctx) noexcept -> const byte_type* {
+              auto& state = *static_cast<tfidf::quantized_norm_score_ctx*>(ctx);
+              irs::sort::score_cast<tfidf::score_t>(state.score_buf) = ::tfidf(state.freq->value, state.idf) * state.norm_->read();
+
+              return state.score_buf;
+            },
+            &tfidf::score_batch<tfidf::quantized_norm_score_ctx>
+          };
+        }
+      }
+
       irs::norm norm;
 
       auto* doc = irs::get<document>(doc_attrs);
@@ -422,7 +517,8 @@ class sort final: public irs::prepared_sort_basic<tfidf::score_t, tfidf::idf> {
           irs::sort::score_cast<score_t>(state.score_buf) = ::tfidf(state.freq->value, state.idf);
 
           return state.score_buf;
-        }
+        },
+        &tfidf::score_batch<tfidf::score_ctx>
       };
     }
   }
@@ -431,6 +527,16 @@ class sort final: public irs::prepared_sort_basic<tfidf::score_t, tfidf::idf> {
     return irs::memory::make_unique<term_collector>();
   }
 
+  virtual bool max_score(
+      byte_type* score_buf,
+      const byte_type* stats_buf,
+      uint32_t freq,
+      boost_t boost) const override {
+    // norm value never exceeds 1
+    irs::sort::score_cast<score_t>(score_buf) = ::tfidf(freq, boost * stats_cast(stats_buf).value);
+    return true;
+  }
+
  private:
   bool normalize_;
   bool boost_as_score_;
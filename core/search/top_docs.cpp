@@ -0,0 +1,261 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "top_docs.hpp"
+
+#include <algorithm>
+#include <mutex>
+
+#include "analysis/token_attributes.hpp"
+#include "index/index_reader.hpp"
+#include "search/score.hpp"
+#include "utils/async_utils.hpp"
+
+namespace iresearch {
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                top_docs_collector
+// -----------------------------------------------------------------------------
+
+top_docs_collector::top_docs_collector(const order::prepared& ord, size_t k)
+  : order_(&ord),
+    score_buf_(ord.score_size(), 0),
+    k_(k) {
+  docs_.reserve(k);
+}
+
+bool top_docs_collector::less(
+    const byte_type* lhs_score, size_t lhs_segment,
+    doc_id_t lhs_doc, const scored_doc& rhs) const {
+  if (!order_->empty()) {
+    const auto* rhs_score = rhs.score.c_str();
+
+    if (order_->less(lhs_score, rhs_score)) {
+      return true;
+    }
+
+    if (order_->less(rhs_score, lhs_score)) {
+      return false;
+    }
+  }
+
+  return lhs_segment < rhs.segment
+    || (lhs_segment == rhs.segment && lhs_doc < rhs.doc);
+}
+
+void top_docs_collector::collect(
+    const segment_range& range, doc_iterator& docs) {
+  const irs::score* score = nullptr;
+  score_threshold* threshold = nullptr;
+
+  if (!order_->empty()) {
+    score = &irs::score::get(docs);
+
+    if (score == &irs::score::no_score()) {
+      score = nullptr;
+    } else if (k_) {
+      threshold = irs::get_mutable<score_threshold>(&docs);
+    }
+  }
+
+  if (threshold && docs_.size() == k_) {
+    // documents collected so far are valid for the whole range
+    threshold->value = docs_.front().score;
+  }
+
+  const auto collect_doc = [&](doc_id_t doc, const byte_type* value) {
+    if (this->collect(range.segment, doc, value) && threshold && docs_.size() == k_) {
+      // let iterator skip documents which can't beat the worst collected one
+      threshold->value = docs_.front().score;
+    }
+  };
+
+  auto doc = docs.seek(range.min);
+
+  if (doc >= range.max) {
+    return;
+  }
+
+  // score whole blocks of postings at once if possible, batch scorers write
+  // scores of their own bucket one after another which matches the layout
+  // of a block of scores only if there are no other buckets
+  auto* block = score && score->is_batched() && 1 == order_->size()
+    ? postings_block::get(docs)
+    : nullptr;
+
+  if (block) {
+    collect_doc(doc, score->evaluate());
+
+    const size_t score_size = order_->score_size();
+
+    for (size_t count; (count = block->fetch()); ) {
+      block_scores_.resize(count * score_size);
+      auto* scores = &block_scores_[0];
+      score->evaluate(block->freqs, block->norms, count, scores);
+
+      for (size_t i = 0; i < count; ++i, scores += score_size) {
+        if ((doc = block->docs[i]) >= range.max) {
+          return;
+        }
+
+        collect_doc(doc, scores);
+      }
+    }
+
+    return;
+  }
+
+  do {
+    collect_doc(doc, score ? score->evaluate() : score_buf_.c_str());
+  } while (docs.next() && (doc = docs.value()) < range.max);
+}
+
+bool top_docs_collector::collect(
+    size_t segment, doc_id_t doc, const byte_type* score) {
+  ++visited_;
+
+  const auto less = [this](const scored_doc& lhs, const scored_doc& rhs) {
+    return this->less(lhs, rhs);
+  };
+
+  if (docs_.size() < k_) {
+    docs_.emplace_back(bstring(score, order_->score_size()), segment, doc);
+    std::push_heap(docs_.begin(), docs_.end(), less);
+    return true;
+  }
+
+  if (docs_.empty() || !this->less(score, segment, doc, docs_.front())) {
+    return false;
+  }
+
+  // replace the worst document
+  std::pop_heap(docs_.begin(), docs_.end(), less);
+  auto& worst = docs_.back();
+  worst.score.assign(score, order_->score_size());
+  worst.segment = segment;
+  worst.doc = doc;
+  std::push_heap(docs_.begin(), docs_.end(), less);
+  return true;
+}
+
+void top_docs_collector::merge(top_docs_collector&& other) {
+  assert(order_ == other.order_ && k_ == other.k_);
+
+  const auto less = [this](const scored_doc& lhs, const scored_doc& rhs) {
+    return this->less(lhs, rhs);
+  };
+
+  if (docs_.size() < other.docs_.size()) {
+    std::swap(docs_, other.docs_);
+  }
+
+  for (auto& doc : other.docs_) {
+    if (docs_.size() < k_) {
+      docs_.emplace_back(std::move(doc));
+      std::push_heap(docs_.begin(), docs_.end(), less);
+    } else if (less(doc, docs_.front())) {
+      std::pop_heap(docs_.begin(), docs_.end(), less);
+      docs_.back() = std::move(doc);
+      std::push_heap(docs_.begin(), docs_.end(), less);
+    }
+  }
+
+  visited_ += other.visited_;
+  other.docs_.clear();
+  other.visited_ = 0;
+}
+
+std::vector<scored_doc> top_docs_collector::finish() {
+  std::sort_heap(
+    docs_.begin(), docs_.end(),
+    [this](const scored_doc& lhs, const scored_doc& rhs) {
+      return less(lhs, rhs);
+  });
+
+  return std::move(docs_);
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                   top-k execution
+// -----------------------------------------------------------------------------
+
+std::vector<segment_range> partition(
+    const index_reader& index,
+    size_t max_docs) {
+  std::vector<segment_range> ranges;
+  ranges.reserve(index.size());
+
+  for (size_t i = 0, size = index.size(); i < size; ++i) {
+    const auto docs_count = index[i].docs_count();
+
+    if (!docs_count) {
+      continue;
+    }
+
+    const uint64_t end = doc_limits::min() + docs_count;
+    const uint64_t step = max_docs ? max_docs : docs_count;
+
+    for (uint64_t min = doc_limits::min(); min < end; min += step) {
+      const auto max = std::min(min + step, end);
+      ranges.push_back({ i, doc_id_t(min), doc_id_t(max) });
+    }
+  }
+
+  return ranges;
+}
+
+std::vector<scored_doc> execute_top_k(
+    const index_reader& index,
+    const filter::prepared& query,
+    const order::prepared& ord,
+    size_t k,
+    async_utils::thread_pool* pool /*= nullptr*/,
+    size_t max_range_docs /*= 0*/) {
+  auto ranges = partition(index, max_range_docs);
+
+  if (!pool || ranges.size() < 2) {
+    top_docs_collector collector(ord, k);
+
+    for (auto& range : ranges) {
+      auto docs = query.execute(index[range.segment], ord);
+      collector.collect(range, *docs);
+    }
+
+    return collector.finish();
+  }
+
+  top_docs_collector result(ord, k);
+  std::mutex mutex;
+
+  // calling thread evaluates ranges as well
+  async_utils::parallel_for(pool, ranges.size(), [&](size_t i) {
+    auto& range = ranges[i];
+    top_docs_collector collector(ord, k);
+    auto docs = query.execute(index[range.segment], ord);
+    collector.collect(range, *docs);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    result.merge(std::move(collector));
+  });
+
+  return result.finish();
+}
+
+}
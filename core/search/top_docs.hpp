@@ -0,0 +1,174 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IRESEARCH_TOP_DOCS_H
+#define IRESEARCH_TOP_DOCS_H
+
+#include <vector>
+
+#include "shared.hpp"
+#include "search/filter.hpp"
+#include "search/sort.hpp"
+#include "utils/string.hpp"
+#include "utils/type_limits.hpp"
+
+namespace iresearch {
+
+struct index_reader;
+
+namespace async_utils {
+class thread_pool;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @struct scored_doc
+/// @brief document matched by a query along with its score
+////////////////////////////////////////////////////////////////////////////////
+struct scored_doc {
+  scored_doc() = default;
+  scored_doc(bstring&& score, size_t segment, doc_id_t doc) noexcept
+    : score(std::move(score)), segment(segment), doc(doc) {
+  }
+
+  bstring score; // score as evaluated by 'order::prepared'
+  size_t segment{}; // offset of a segment within a reader
+  doc_id_t doc{ doc_limits::invalid() }; // segment local document id
+}; // scored_doc
+
+////////////////////////////////////////////////////////////////////////////////
+/// @struct segment_range
+/// @brief range of document ids [min, max) within a segment
+////////////////////////////////////////////////////////////////////////////////
+struct segment_range {
+  size_t segment{}; // offset of a segment within a reader
+  doc_id_t min{ doc_limits::min() }; // first document in a range
+  doc_id_t max{ doc_limits::eof() }; // first document past the range
+}; // segment_range
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief split every segment of a specified reader into ranges of at most
+///        'max_docs' document ids each, empty segments are skipped
+/// @param max_docs 0 - do not split segments
+////////////////////////////////////////////////////////////////////////////////
+IRESEARCH_API std::vector<segment_range> partition(
+  const index_reader& index,
+  size_t max_docs);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class top_docs_collector
+/// @brief collects 'k' best scored documents according to a specified order,
+///        ties are resolved in favor of documents having lesser
+///        (segment, doc) pair
+////////////////////////////////////////////////////////////////////////////////
+class IRESEARCH_API top_docs_collector : private util::noncopyable {
+ public:
+  top_docs_collector(const order::prepared& ord, size_t k);
+  top_docs_collector(top_docs_collector&&) = default;
+  top_docs_collector& operator=(top_docs_collector&&) = default;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief collect all documents matched by a specified iterator
+  /// @param segment offset of a segment within a reader
+  //////////////////////////////////////////////////////////////////////////////
+  void collect(size_t segment, doc_iterator& docs) {
+    collect(segment_range{ segment }, docs);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief collect documents matched by a specified iterator within a
+  ///        specified range, iterator must not be positioned past 'range.min'
+  /// @note once 'k' documents are collected, the score of the worst one is
+  ///       propagated to the iterator via 'score_threshold' letting it skip
+  ///       documents which can't get into the result, thus ranges have to be
+  ///       collected in ascending order of (segment, doc)
+  /// @note iterators exposing 'postings_block' along with a batched score
+  ///       are scored a block of documents at a time, given that the order
+  ///       consists of a single bucket
+  //////////////////////////////////////////////////////////////////////////////
+  void collect(const segment_range& range, doc_iterator& docs);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief collect a single document
+  /// @param score score buffer of 'order::prepared::score_size()' bytes
+  /// @returns true if document got into collected top 'k'
+  //////////////////////////////////////////////////////////////////////////////
+  bool collect(size_t segment, doc_id_t doc, const byte_type* score);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief merge documents collected by another collector sharing the same
+  ///        order and 'k'
+  //////////////////////////////////////////////////////////////////////////////
+  void merge(top_docs_collector&& other);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns collected documents, best scored first
+  //////////////////////////////////////////////////////////////////////////////
+  std::vector<scored_doc> finish();
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns number of documents visited so far
+  //////////////////////////////////////////////////////////////////////////////
+  size_t visited() const noexcept { return visited_; }
+
+  size_t size() const noexcept { return docs_.size(); }
+  bool empty() const noexcept { return docs_.empty(); }
+
+ private:
+  // true if document denoted by 'lhs_*' ranks before 'rhs'
+  bool less(const byte_type* lhs_score, size_t lhs_segment,
+            doc_id_t lhs_doc, const scored_doc& rhs) const;
+
+  bool less(const scored_doc& lhs, const scored_doc& rhs) const {
+    return less(lhs.score.c_str(), lhs.segment, lhs.doc, rhs);
+  }
+
+  IRESEARCH_API_PRIVATE_VARIABLES_BEGIN
+  const order::prepared* order_;
+  std::vector<scored_doc> docs_; // max heap, worst document first
+  bstring score_buf_; // zero score for iterators without scores
+  bstring block_scores_; // scores of a block of postings
+  size_t k_;
+  size_t visited_{};
+  IRESEARCH_API_PRIVATE_VARIABLES_END
+}; // top_docs_collector
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief executes a prepared query against every segment of a specified
+///        reader and returns 'k' best scored documents, best first
+/// @param pool if specified, segments are evaluated concurrently by the
+///        calling thread and the threads of the pool, top 'k' of every range
+///        is merged into the result once the range is evaluated, the result
+///        is the same as for a serial execution
+/// @param max_range_docs if not 0, segments are split into ranges of at most
+///        'max_range_docs' documents evaluated independently, so that large
+///        segments are evaluated by multiple threads
+/// @note 'pool' may be the one the calling thread belongs to
+////////////////////////////////////////////////////////////////////////////////
+IRESEARCH_API std::vector<scored_doc> execute_top_k(
+  const index_reader& index,
+  const filter::prepared& query,
+  const order::prepared& ord,
+  size_t k,
+  async_utils::thread_pool* pool = nullptr,
+  size_t max_range_docs = 0);
+
+}
+
+#endif // IRESEARCH_TOP_DOCS_H
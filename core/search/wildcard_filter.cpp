@@ -28,6 +28,7 @@
 #include "search/term_filter.hpp"
 #include "search/prefix_filter.hpp"
 #include "index/index_reader.hpp"
+#include "utils/automaton_cache.hpp"
 #include "utils/wildcard_utils.hpp"
 #include "utils/automaton_utils.hpp"
 #include "utils/hash_utils.hpp"
@@ -128,22 +129,24 @@ field_visitor by_wildcard::visitor(const bytes_ref& term) {
     },
     [](const bytes_ref& term) -> field_visitor{
       struct automaton_context : util::noncopyable {
-        automaton_context(const bytes_ref& term)
-          : acceptor(from_wildcard(term)),
-            matcher(make_automaton_matcher(acceptor)) {
+        explicit automaton_context(automaton_cache::value_type&& acceptor)
+          : acceptor(std::move(acceptor)),
+            matcher(this->acceptor->matcher) {
         }
 
-        automaton acceptor;
-        automaton_table_matcher matcher;
+        automaton_cache::value_type acceptor;
+        automaton_table_matcher matcher; // matchers are stateful
       };
 
-      // FIXME
-      auto ctx = memory::make_shared<automaton_context>(term);
+      auto acceptor = automaton_cache::global().wildcard(term);
 
-      if (!validate(ctx->acceptor)) {
+      if (!acceptor->valid) {
         return [](const sub_reader&, const term_reader&, filter_visitor&) { };
       }
 
+      // FIXME
+      auto ctx = memory::make_shared<automaton_context>(std::move(acceptor));
+
       return [ctx](
           const sub_reader& segment,
           const term_reader& field,
@@ -160,7 +163,8 @@ field_visitor by_wildcard::visitor(const bytes_ref& term) {
     boost_t boost,
     const string_ref& field,
     const bytes_ref& term,
-    size_t scored_terms_limit) {
+    size_t scored_terms_limit,
+    const automaton_cache* cache /*= nullptr*/) {
   bstring buf;
   return executeWildcard(
     buf, term,
@@ -173,11 +177,30 @@ field_visitor by_wildcard::visitor(const bytes_ref& term) {
     [&index, &order, boost, &field, scored_terms_limit](const bytes_ref& term) -> filter::prepared::ptr {
       return by_prefix::prepare(index, order, boost, field, term, scored_terms_limit);
     },
-    [&index, &order, boost, &field, scored_terms_limit](const bytes_ref& term) -> filter::prepared::ptr {
-      return prepare_automaton_filter(field, from_wildcard(term), scored_terms_limit,
+    [&index, &order, boost, &field, scored_terms_limit, cache](const bytes_ref& term) -> filter::prepared::ptr {
+      const auto acceptor = (cache ? *cache : automaton_cache::global()).wildcard(term);
+
+      if (!acceptor->valid) {
+        return prepared::empty();
+      }
+
+      auto matcher = acceptor->matcher; // matchers are stateful
+
+      return prepare_automaton_filter(field, matcher, scored_terms_limit,
                                       index, order, boost);
     }
   );
 }
 
+filter::prepared::ptr by_wildcard::prepare(
+    const index_reader& index,
+    const order::prepared& order,
+    boost_t boost,
+    const attribute_provider* ctx) const {
+  return prepare(index, order, this->boost()*boost,
+                 field(), options().term,
+                 options().scored_terms_limit,
+                 &automaton_cache::from(ctx));
+}
+
 }
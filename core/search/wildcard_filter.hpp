@@ -28,6 +28,7 @@
 
 namespace iresearch {
 
+class automaton_cache;
 class by_wildcard;
 struct filter_visitor;
 
@@ -78,27 +79,27 @@ class IRESEARCH_API by_wildcard final
  public:
   DECLARE_FACTORY();
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// @param cache cache of compiled automata, nullptr - the global one
+  //////////////////////////////////////////////////////////////////////////////
   static prepared::ptr prepare(
     const index_reader& index,
     const order::prepared& order,
     boost_t boost,
     const string_ref& field,
     const bytes_ref& term,
-    size_t scored_terms_limit);
+    size_t scored_terms_limit,
+    const automaton_cache* cache = nullptr);
 
   static field_visitor visitor(const bytes_ref& term);
 
   using filter::prepare;
 
   virtual filter::prepared::ptr prepare(
-      const index_reader& index,
-      const order::prepared& order,
-      boost_t boost,
-      const attribute_provider* /*ctx*/) const override {
-    return prepare(index, order, this->boost()*boost,
-                   field(), options().term,
-                   options().scored_terms_limit);
-  }
+    const index_reader& index,
+    const order::prepared& order,
+    boost_t boost,
+    const attribute_provider* ctx) const override;
 }; // by_wildcard
 
 }
@@ -94,4 +94,47 @@ void index_file_refs::clear() {
   }
 }
 
+// -----------------------------------------------------------------------------
+// --SECTION--                                                        norm_cache
+// -----------------------------------------------------------------------------
+
+/*static*/ norm_cache::ptr norm_cache::make(size_t max_memory) {
+  return memory::make_unique<norm_cache>(max_memory);
+}
+
+bool norm_cache::acquire(size_t size) noexcept {
+  auto memory = memory_.load();
+
+  do {
+    if (size > max_memory_ - memory) {
+      return false;
+    }
+  } while (!memory_.compare_exchange_weak(memory, memory + size));
+
+  return true;
+}
+
+void norm_cache::release(size_t size) noexcept {
+  assert(memory_.load() >= size);
+  memory_ -= size;
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                      column_cache
+// -----------------------------------------------------------------------------
+
+/*static*/ column_cache::ptr column_cache::make(size_t max_memory) {
+  return memory::make_unique<column_cache>(max_memory);
+}
+
+/*static*/ column_cache& column_cache::global() noexcept {
+  return *global_ptr();
+}
+
+/*static*/ std::shared_ptr<column_cache> column_cache::global_ptr() noexcept {
+  // readers hold a copy, so the cache outlives the static pointer if needed
+  static const auto cache = std::make_shared<column_cache>(0); // disabled by default
+  return cache;
+}
+
 }
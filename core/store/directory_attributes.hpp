@@ -24,10 +24,13 @@
 #ifndef IRESEARCH_DIRECTORY_ATTRIBUTES_H
 #define IRESEARCH_DIRECTORY_ATTRIBUTES_H
 
+#include <atomic>
+
 #include "shared.hpp"
 #include "utils/attribute_store.hpp"
 #include "utils/ref_counter.hpp"
 #include "utils/container_utils.hpp"
+#include "utils/lru_cache.hpp"
 
 namespace iresearch {
 
@@ -102,6 +105,131 @@ class IRESEARCH_API index_file_refs : public stored_attribute {
   IRESEARCH_API_PRIVATE_VARIABLES_END
 }; // index_file_refs
 
+//////////////////////////////////////////////////////////////////////////////
+/// @class norm_cache
+/// @brief enables caching of quantized normalization factors by segment
+///        readers opened over a directory, accounts memory used by cached
+///        norms of all such readers against 'max_memory'
+//////////////////////////////////////////////////////////////////////////////
+class IRESEARCH_API norm_cache : public stored_attribute {
+ public:
+  DECLARE_FACTORY(size_t max_memory);
+
+  explicit norm_cache(size_t max_memory) noexcept
+    : max_memory_(max_memory) {
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief reserve 'size' bytes for cached norms
+  /// @returns false if reservation exceeds memory limit
+  //////////////////////////////////////////////////////////////////////////////
+  bool acquire(size_t size) noexcept;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief return 'size' bytes previously reserved via 'acquire'
+  //////////////////////////////////////////////////////////////////////////////
+  void release(size_t size) noexcept;
+
+  // memory limit for cached norms in bytes
+  size_t max_memory() const noexcept { return max_memory_; }
+
+  // memory currently used by cached norms in bytes
+  size_t memory() const noexcept { return memory_.load(); }
+
+ private:
+  IRESEARCH_API_PRIVATE_VARIABLES_BEGIN
+  std::atomic<size_t> memory_{0};
+  size_t max_memory_;
+  IRESEARCH_API_PRIVATE_VARIABLES_END
+}; // norm_cache
+
+//////////////////////////////////////////////////////////////////////////////
+/// @class column_cache
+/// @brief a thread-safe LRU cache of decompressed columnstore blocks shared
+///        by columnstore readers, either the global one or the one set in
+///        directory attributes, the cache is disabled while 'max_memory' is 0
+/// @note cached values are type-erased blocks owned by shared pointers,
+///       thus an evicted block stays valid while it's in use by a reader,
+///       see columnstore_reader::column_reader::values() for the validity
+///       of values returned by a reader while the cache is enabled
+//////////////////////////////////////////////////////////////////////////////
+class IRESEARCH_API column_cache : public stored_attribute {
+ public:
+  typedef std::shared_ptr<const void> value_type;
+
+  DECLARE_FACTORY(size_t max_memory);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns cache used by readers of directories without 'column_cache'
+  ///          attribute, disabled by default
+  //////////////////////////////////////////////////////////////////////////////
+  static column_cache& global() noexcept;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns shared ownership of the global cache, the cache is destroyed
+  ///          along with the last reader holding it, i.e. readers outliving
+  ///          static deinitialization may still use it
+  //////////////////////////////////////////////////////////////////////////////
+  static std::shared_ptr<column_cache> global_ptr() noexcept;
+
+  explicit column_cache(size_t max_memory) noexcept
+    : cache_(max_memory) {
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns unique identifier to distinguish blocks of different readers
+  //////////////////////////////////////////////////////////////////////////////
+  uint64_t register_owner() noexcept { return next_owner_++; }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns cached block at the specified offset of the specified owner,
+  ///          nullptr if there is no such block
+  //////////////////////////////////////////////////////////////////////////////
+  value_type get(uint64_t owner, uint64_t offset) {
+    return cache_.get(owner, offset);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief cache block of 'size' bytes evicting least recently used blocks
+  ///        if memory limit is exceeded
+  //////////////////////////////////////////////////////////////////////////////
+  void put(uint64_t owner, uint64_t offset, value_type&& value, size_t size) {
+    cache_.put(owner, offset, std::move(value), size);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief evict all blocks of the specified owner in time proportional to
+  ///        the number of its blocks
+  //////////////////////////////////////////////////////////////////////////////
+  void remove(uint64_t owner) { cache_.erase(owner); }
+
+  // memory limit for cached blocks in bytes
+  size_t max_memory() const noexcept { return cache_.max_weight(); }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief change memory limit evicting least recently used blocks if needed
+  //////////////////////////////////////////////////////////////////////////////
+  void max_memory(size_t value) { cache_.max_weight(value); }
+
+  // memory currently used by cached blocks in bytes
+  size_t memory() const noexcept { return cache_.weight(); }
+
+  // number of lookups that found a cached block
+  size_t hits() const noexcept { return cache_.hits(); }
+
+  // number of lookups that didn't find a cached block
+  size_t misses() const noexcept { return cache_.misses(); }
+
+  // state of the cache, 'weight' is in bytes
+  lru_cache_stats stats() const { return cache_.stats(); }
+
+ private:
+  IRESEARCH_API_PRIVATE_VARIABLES_BEGIN
+  lru_cache<uint64_t, uint64_t, value_type> cache_; // blocks by owner and offset
+  std::atomic<uint64_t> next_owner_{0};
+  IRESEARCH_API_PRIVATE_VARIABLES_END
+}; // column_cache
+
 }
 
 #endif
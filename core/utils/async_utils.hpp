@@ -24,12 +24,17 @@
 #ifndef IRESEARCH_ASYNC_UTILS_H
 #define IRESEARCH_ASYNC_UTILS_H
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <exception>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <queue>
 #include <thread>
 
+#include "misc.hpp"
 #include "noncopyable.hpp"
 #include "shared.hpp"
 
@@ -153,6 +158,88 @@ class IRESEARCH_API thread_pool {
   void run();
 }; // thread_pool
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief invokes 'func' for every index in [0, count) by the calling thread
+///        and at most 'pool->max_threads()' threads of the pool
+/// @note rethrows the first exception thrown by 'func', remaining indices
+///       aren't processed in this case
+////////////////////////////////////////////////////////////////////////////////
+template<typename Func>
+void parallel_for(
+    thread_pool* pool,
+    size_t count,
+    const Func& func) {
+  if (!pool || count < 2) {
+    for (size_t i = 0; i < count; ++i) {
+      func(i);
+    }
+
+    return;
+  }
+
+  // owned by every scheduled task since a task may be picked up
+  // by a pool thread after the calling thread returns
+  struct state_t {
+    std::atomic<size_t> next{0};
+    std::mutex mutex;
+    std::condition_variable finished;
+    std::exception_ptr error; // guarded by 'mutex'
+    size_t active{0}; // number of running workers, guarded by 'mutex'
+    bool closed{false}; // no more workers may start, guarded by 'mutex'
+  };
+
+  const auto process = [count, &func](state_t& state) {
+    {
+      std::lock_guard<std::mutex> lock(state.mutex);
+
+      if (state.closed) {
+        return; // 'func' may be already gone
+      }
+
+      ++state.active;
+    }
+
+    auto finish = make_finally([&state]()noexcept{
+      std::lock_guard<std::mutex> lock(state.mutex);
+      --state.active;
+      state.finished.notify_all();
+    });
+
+    try {
+      for (size_t i; (i = state.next++) < count; ) {
+        func(i);
+      }
+    } catch (...) {
+      state.next = count; // stop other workers
+
+      std::lock_guard<std::mutex> lock(state.mutex);
+
+      if (!state.error) {
+        state.error = std::current_exception();
+      }
+    }
+  };
+
+  auto state = std::make_shared<state_t>();
+
+  // calling thread processes indices as well
+  for (size_t i = 0, tasks = std::min(pool->max_threads(), count - 1); i < tasks; ++i) {
+    if (!pool->run([state, process]() { process(*state); })) {
+      break; // pool is stopped
+    }
+  }
+
+  process(*state);
+
+  std::unique_lock<std::mutex> lock(state->mutex);
+  state->closed = true;
+  state->finished.wait(lock, [&state]() { return !state->active; });
+
+  if (state->error) {
+    std::rethrow_exception(state->error);
+  }
+}
+
 } // async_utils
 } // namespace iresearch {
 
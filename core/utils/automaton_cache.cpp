@@ -0,0 +1,127 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "automaton_cache.hpp"
+
+#include "utils/automaton_utils.hpp"
+#include "utils/levenshtein_utils.hpp"
+#include "utils/wildcard_utils.hpp"
+
+namespace {
+
+using namespace irs;
+
+enum class automaton_type : byte_type {
+  LEVENSHTEIN,
+  WILDCARD
+};
+
+// @returns estimated memory used by an automaton and its table matcher
+size_t automaton_memory(const automaton_cache::entry& entry) {
+  const auto& a = entry.acceptor;
+  size_t memory = sizeof entry + size_t(a.NumStates())*sizeof(automaton::State);
+
+  for (automaton::StateId s = 0; s < a.NumStates(); ++s) {
+    memory += a.NumArcs(s)*sizeof(automaton::Arc);
+  }
+
+  return memory + entry.matcher.MemoryUsage();
+}
+
+}
+
+namespace iresearch {
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                            automaton_cache::entry
+// -----------------------------------------------------------------------------
+
+automaton_cache::entry::entry(automaton&& acceptor)
+  : acceptor(std::move(acceptor)),
+    matcher(make_automaton_matcher(this->acceptor)),
+    memory(0),
+    valid(validate(this->acceptor)) {
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                   automaton_cache
+// -----------------------------------------------------------------------------
+
+/*static*/ automaton_cache& automaton_cache::global() noexcept {
+  static automaton_cache cache(0); // disabled by default
+  return cache;
+}
+
+/*static*/ const automaton_cache& automaton_cache::from(
+    const attribute_provider* ctx) noexcept {
+  const auto* cache = ctx ? irs::get<automaton_cache>(*ctx) : nullptr;
+
+  return cache ? *cache : global();
+}
+
+template<typename Builder>
+automaton_cache::value_type automaton_cache::get(
+    byte_type type,
+    bstring&& key,
+    const Builder& build) const {
+  if (!cache_.max_weight()) {
+    return std::make_shared<const entry>(build());
+  }
+
+  if (auto cached = cache_.get(type, key)) {
+    return cached;
+  }
+
+  // build outside of the lock, concurrent misses of the same key may build
+  // the same automaton several times, only the first one gets cached
+  auto value = std::make_shared<entry>(build());
+  value->memory = automaton_memory(*value);
+  const size_t size = value->memory + key.size();
+
+  cache_.put(type, std::move(key), value, size);
+
+  return value;
+}
+
+automaton_cache::value_type automaton_cache::levenshtein(
+    const parametric_description& description,
+    const bytes_ref& term) const {
+  const auto* address = &description;
+
+  bstring key;
+  key.reserve(sizeof address + term.size());
+  key.append(reinterpret_cast<const byte_type*>(&address), sizeof address);
+  key.append(term.c_str(), term.size());
+
+  return get(byte_type(automaton_type::LEVENSHTEIN), std::move(key), [&description, &term]() {
+    return make_levenshtein_automaton(description, term);
+  });
+}
+
+automaton_cache::value_type automaton_cache::wildcard(
+    const bytes_ref& pattern) const {
+  bstring key(pattern.c_str(), pattern.size());
+
+  return get(byte_type(automaton_type::WILDCARD), std::move(key), [&pattern]() {
+    return from_wildcard(pattern);
+  });
+}
+
+}
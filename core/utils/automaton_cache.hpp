@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IRESEARCH_AUTOMATON_CACHE_H
+#define IRESEARCH_AUTOMATON_CACHE_H
+
+#include <memory>
+
+#include "utils/attribute_provider.hpp"
+#include "utils/attributes.hpp"
+#include "utils/automaton.hpp"
+#include "utils/fstext/fst_table_matcher.hpp"
+#include "utils/lru_cache.hpp"
+#include "utils/noncopyable.hpp"
+#include "utils/string.hpp"
+
+namespace iresearch {
+
+class parametric_description;
+
+//////////////////////////////////////////////////////////////////////////////
+/// @class automaton_cache
+/// @brief a thread-safe LRU cache of compiled automata of levenshtein and
+///        wildcard filters keyed by pattern and parameters, either the global
+///        one or the one exposed by the 'ctx' of filter::prepare(...), the
+///        cache is disabled while 'max_memory' is 0
+/// @note cached values are owned by shared pointers, thus an evicted
+///       automaton stays valid while it's in use by a query
+//////////////////////////////////////////////////////////////////////////////
+class IRESEARCH_API automaton_cache final : public attribute {
+ public:
+  ////////////////////////////////////////////////////////////////////////////
+  /// @struct entry
+  /// @brief compiled automaton along with its matcher
+  ////////////////////////////////////////////////////////////////////////////
+  struct IRESEARCH_API entry : private util::noncopyable {
+    explicit entry(automaton&& acceptor);
+
+    automaton acceptor;
+    automaton_table_matcher matcher; // matchers are stateful, a query must
+                                     // use its own copy sharing the table
+    size_t memory; // estimated memory used by the entry in bytes, 0 unless
+                   // the entry was built to be cached
+    bool valid; // acceptor is deterministic and epsilon-free
+  }; // entry
+
+  typedef std::shared_ptr<const entry> value_type;
+
+  static constexpr string_ref type_name() noexcept {
+    return "iresearch::automaton_cache";
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns cache used by queries prepared without 'automaton_cache'
+  ///          in their context, disabled by default
+  //////////////////////////////////////////////////////////////////////////////
+  static automaton_cache& global() noexcept;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns cache exposed by 'ctx' if any, the global one otherwise
+  //////////////////////////////////////////////////////////////////////////////
+  static const automaton_cache& from(const attribute_provider* ctx) noexcept;
+
+  explicit automaton_cache(size_t max_memory) noexcept
+    : cache_(max_memory) {
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns automaton matching terms within the edit distance of a
+  ///          description from a specified UTF-8 encoded term
+  /// @note descriptions are distinguished by address, i.e. have to outlive
+  ///       the cache, as the ones of the default provider do
+  //////////////////////////////////////////////////////////////////////////////
+  value_type levenshtein(
+    const parametric_description& description,
+    const bytes_ref& term) const;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns automaton matching terms of a specified wildcard pattern
+  //////////////////////////////////////////////////////////////////////////////
+  value_type wildcard(const bytes_ref& pattern) const;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief evict all automata
+  //////////////////////////////////////////////////////////////////////////////
+  void clear() { cache_.clear(); }
+
+  // memory limit for cached automata in bytes
+  size_t max_memory() const noexcept { return cache_.max_weight(); }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief change memory limit evicting least recently used automata if
+  ///        needed
+  //////////////////////////////////////////////////////////////////////////////
+  void max_memory(size_t value) { cache_.max_weight(value); }
+
+  // memory currently used by cached automata in bytes
+  size_t memory() const noexcept { return cache_.weight(); }
+
+  // number of cached automata
+  size_t size() const { return cache_.size(); }
+
+  // number of lookups that found a cached automaton
+  size_t hits() const noexcept { return cache_.hits(); }
+
+  // number of lookups that didn't find a cached automaton
+  size_t misses() const noexcept { return cache_.misses(); }
+
+  // state of the cache, 'weight' is in bytes
+  lru_cache_stats stats() const { return cache_.stats(); }
+
+ private:
+  template<typename Builder>
+  value_type get(byte_type type, bstring&& key, const Builder& build) const;
+
+  IRESEARCH_API_PRIVATE_VARIABLES_BEGIN
+  mutable lru_cache<byte_type, bstring, value_type> cache_; // automata by type and key
+  IRESEARCH_API_PRIVATE_VARIABLES_END
+}; // automaton_cache
+
+}
+
+#endif // IRESEARCH_AUTOMATON_CACHE_H
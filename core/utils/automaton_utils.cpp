@@ -493,6 +493,17 @@ filter::prepared::ptr prepare_automaton_filter(
     boost_t boost) {
   auto matcher = make_automaton_matcher(acceptor);
 
+  return prepare_automaton_filter(
+    field, matcher, scored_terms_limit, index, order, boost);
+}
+
+filter::prepared::ptr prepare_automaton_filter(
+    const string_ref& field,
+    automaton_table_matcher& matcher,
+    size_t scored_terms_limit,
+    const index_reader& index,
+    const order::prepared& order,
+    boost_t boost) {
   if (fst::kError == matcher.Properties(0)) {
     IR_FRMT_ERROR("Expected deterministic, epsilon-free acceptor, "
                   "got the following properties " IR_UINT64_T_SPECIFIER "",
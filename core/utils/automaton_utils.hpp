@@ -518,7 +518,7 @@ inline automaton make_all() {
 /// @brief instantiate compiled filter based on a specified automaton, field
 ///        and other properties
 /// @param field field name
-/// @param matcher input matcher
+/// @param acceptor input automaton
 /// @param scored_terms_limit score as many terms
 /// @param index index reader
 /// @param order compiled order
@@ -533,6 +533,26 @@ IRESEARCH_API filter::prepared::ptr prepare_automaton_filter(
   const order::prepared& order,
   boost_t boost);
 
+//////////////////////////////////////////////////////////////////////////////
+/// @brief instantiate compiled filter based on a matcher of an automaton,
+///        e.g. a copy of the one cached by 'automaton_cache', field and other
+///        properties
+/// @param field field name
+/// @param matcher input matcher
+/// @param scored_terms_limit score as many terms
+/// @param index index reader
+/// @param order compiled order
+/// @param bool query boost
+/// @returns compiled filter
+//////////////////////////////////////////////////////////////////////////////
+IRESEARCH_API filter::prepared::ptr prepare_automaton_filter(
+  const string_ref& field,
+  automaton_table_matcher& matcher,
+  size_t scored_terms_limit,
+  const index_reader& index,
+  const order::prepared& order,
+  boost_t boost);
+
 }
 
 #endif
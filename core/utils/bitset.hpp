@@ -139,6 +139,17 @@ class dynamic_bitset : public dynamic_bitset_base<Alloc> {
     return !(*this == rhs);
   }
 
+  // intersects bitsets of the same size a word at a time
+  dynamic_bitset& operator&=(const dynamic_bitset& rhs) noexcept {
+    assert(this->size() == rhs.size());
+    auto* lhs = data_.get();
+    const auto* words = rhs.data();
+    for (size_t i = 0; i < words_; ++i) {
+      lhs[i] &= words[i];
+    }
+    return *this;
+  }
+
   // number of bits in bitset
   size_t size() const noexcept { return bits_; }
 
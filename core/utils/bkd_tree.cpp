@@ -0,0 +1,508 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "shared.hpp"
+#include "bkd_tree.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "error/error.hpp"
+#include "store/data_input.hpp"
+#include "store/data_output.hpp"
+#include "store/store_utils.hpp"
+#include "utils/numeric_utils.hpp"
+#include "utils/string_utils.hpp"
+
+namespace {
+
+using namespace irs;
+
+constexpr size_t BYTES_PER_DIM = bkd_tree::BYTES_PER_DIM;
+
+// median splits halve the number of points at every level
+constexpr size_t MAX_DEPTH = 64;
+
+inline int compare(const byte_type* lhs, const byte_type* rhs) noexcept {
+  return std::memcmp(lhs, rhs, BYTES_PER_DIM);
+}
+
+inline uint64_t decode(const byte_type* in) noexcept {
+  uint64_t value;
+  std::memcpy(&value, in, sizeof value);
+  return numeric_utils::ntoh64(value);
+}
+
+enum class relation { OUTSIDE, INSIDE, CROSSES };
+
+relation compare(
+    const byte_type* cell_min, const byte_type* cell_max,
+    const byte_type* min, const byte_type* max,
+    size_t dims) noexcept {
+  bool inside = true;
+
+  for (size_t offset = 0, end = dims*BYTES_PER_DIM; offset < end; offset += BYTES_PER_DIM) {
+    if (compare(cell_max + offset, min + offset) < 0
+        || compare(cell_min + offset, max + offset) > 0) {
+      return relation::OUTSIDE;
+    }
+
+    inside &= compare(cell_min + offset, min + offset) >= 0
+           && compare(cell_max + offset, max + offset) <= 0;
+  }
+
+  return inside ? relation::INSIDE : relation::CROSSES;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+/// @class tree_writer
+/// @brief splits points recursively at the median of the dimension with
+///        the widest span, writes leaf blocks sequentially to 'out' and
+///        the nodes of the tree in pre-order to 'index_out'
+//////////////////////////////////////////////////////////////////////////////
+class tree_writer : util::noncopyable {
+ public:
+  tree_writer(
+      data_output& index_out,
+      index_output& out,
+      uint64_t& last_fp,
+      size_t dims,
+      const byte_type* values,
+      const doc_id_t* docs,
+      size_t count)
+    : index_out_(index_out),
+      out_(out),
+      last_fp_(last_fp),
+      values_(values),
+      docs_(docs),
+      order_(count),
+      dims_(dims),
+      stride_(dims*BYTES_PER_DIM) {
+    std::iota(order_.begin(), order_.end(), 0);
+  }
+
+  void write() {
+    write(0, order_.size());
+  }
+
+ private:
+  const byte_type* value(uint32_t point, size_t dim) const noexcept {
+    return values_ + point*stride_ + dim*BYTES_PER_DIM;
+  }
+
+  void write(size_t begin, size_t end) {
+    if (end - begin <= bkd_tree::MAX_POINTS_IN_LEAF) {
+      write_leaf(begin, end);
+      return;
+    }
+
+    // split on the dimension with the widest span
+    size_t split_dim = 0;
+    uint64_t split_span = 0;
+
+    for (size_t dim = 0; dim < dims_; ++dim) {
+      uint64_t min = integer_traits<uint64_t>::const_max;
+      uint64_t max = integer_traits<uint64_t>::const_min;
+
+      for (auto i = begin; i < end; ++i) {
+        const auto v = decode(value(order_[i], dim));
+        min = std::min(min, v);
+        max = std::max(max, v);
+      }
+
+      if (max - min > split_span) {
+        split_dim = dim;
+        split_span = max - min;
+      }
+    }
+
+    const auto mid = begin + (end - begin) / 2;
+    std::nth_element(
+      order_.begin() + begin, order_.begin() + mid, order_.begin() + end,
+      [this, split_dim](uint32_t lhs, uint32_t rhs) noexcept {
+        return compare(value(lhs, split_dim), value(rhs, split_dim)) < 0;
+    });
+
+    // points of the left subtree are <= split, points of the right one are >=
+    index_out_.write_vint(uint32_t(split_dim + 1));
+    index_out_.write_bytes(value(order_[mid], split_dim), BYTES_PER_DIM);
+
+    write(begin, mid);
+    write(mid, end);
+  }
+
+  void write_leaf(size_t begin, size_t end) {
+    const auto fp = out_.file_pointer();
+    index_out_.write_vint(0);
+    index_out_.write_vlong(fp - last_fp_);
+    last_fp_ = fp;
+
+    auto first = order_.begin() + begin;
+    auto last = order_.begin() + end;
+
+    // order by document to delta encode them
+    std::sort(first, last, [this](uint32_t lhs, uint32_t rhs) noexcept {
+      return docs_[lhs] < docs_[rhs];
+    });
+
+    out_.write_vint(uint32_t(end - begin));
+
+    doc_id_t prev = 0;
+    for (auto it = first; it != last; ++it) {
+      out_.write_vint(docs_[*it] - prev);
+      prev = docs_[*it];
+    }
+
+    // common prefix of every dimension
+    size_t prefix[bkd_tree::MAX_DIMS];
+
+    for (size_t dim = 0; dim < dims_; ++dim) {
+      const auto* lead = value(*first, dim);
+      prefix[dim] = BYTES_PER_DIM;
+
+      for (auto it = first + 1; it != last && prefix[dim]; ++it) {
+        const auto* v = value(*it, dim);
+        prefix[dim] = size_t(std::mismatch(lead, lead + prefix[dim], v).first - lead);
+      }
+
+      out_.write_byte(static_cast<byte_type>(prefix[dim]));
+      out_.write_bytes(lead, prefix[dim]);
+    }
+
+    for (auto it = first; it != last; ++it) {
+      for (size_t dim = 0; dim < dims_; ++dim) {
+        out_.write_bytes(value(*it, dim) + prefix[dim], BYTES_PER_DIM - prefix[dim]);
+      }
+    }
+  }
+
+  data_output& index_out_;
+  index_output& out_;
+  uint64_t& last_fp_; // leaf pointers are delta encoded across trees
+  const byte_type* values_;
+  const doc_id_t* docs_;
+  std::vector<uint32_t> order_; // permutation of points
+  const size_t dims_;
+  const size_t stride_;
+}; // tree_writer
+
+}
+
+namespace iresearch {
+
+REGISTER_ATTRIBUTE(bkd_tree);
+
+/*static*/ void bkd_tree::encode(int64_t value, byte_type* out) noexcept {
+  const uint64_t v = numeric_utils::hton64(
+    uint64_t(value) ^ (uint64_t(1) << 63));
+  std::memcpy(out, &v, sizeof v);
+}
+
+/*static*/ void bkd_tree::encode(double_t value, byte_type* out) noexcept {
+  encode(numeric_utils::dtoi64(value), out);
+}
+
+void bkd_tree::read(data_input& in) {
+  const uint32_t dims = in.read_vint();
+
+  if (!dims || dims > MAX_DIMS) {
+    throw index_error(string_utils::to_string(
+      "while reading bkd tree, error: invalid number of dimensions '%u'",
+      dims));
+  }
+
+  const size_t stride = dims*BYTES_PER_DIM;
+
+  count_ = in.read_vlong();
+  const uint64_t chunks = in.read_vlong();
+
+  if (!chunks || chunks > count_) {
+    throw index_error(string_utils::to_string(
+      "while reading bkd tree, error: invalid number of trees '" IR_UINT64_T_SPECIFIER "'",
+      chunks));
+  }
+
+  dims_ = dims;
+  nodes_.clear();
+  roots_.clear();
+  bounds_.clear();
+
+  uint64_t fp = 0;
+  for (uint64_t i = 0; i < chunks; ++i) {
+    const size_t offset = bounds_.size();
+    bounds_.resize(offset + 2*stride);
+    in.read_bytes(&bounds_[offset], 2*stride);
+
+    roots_.push_back(read_node(in, fp, 0));
+  }
+}
+
+size_t bkd_tree::read_node(data_input& in, uint64_t& fp, size_t depth) {
+  if (depth > MAX_DEPTH) {
+    throw index_error("while reading bkd tree, error: tree is too deep");
+  }
+
+  const auto id = nodes_.size();
+  const uint32_t header = in.read_vint();
+
+  nodes_.emplace_back();
+
+  if (!header) {
+    fp += in.read_vlong();
+    nodes_[id].value = fp;
+    nodes_[id].dim = LEAF;
+
+    return id;
+  }
+
+  if (header > dims_) {
+    throw index_error(string_utils::to_string(
+      "while reading bkd tree, error: invalid split dimension '%u'",
+      header - 1));
+  }
+
+  nodes_[id].dim = header - 1;
+  in.read_bytes(nodes_[id].split, BYTES_PER_DIM);
+
+  read_node(in, fp, depth + 1); // left child follows its parent
+  nodes_[id].value = read_node(in, fp, depth + 1);
+
+  return id;
+}
+
+void bkd_tree::visit(
+    const bytes_ref& min,
+    const bytes_ref& max,
+    const visitor_f& visitor) const {
+  const size_t stride = dims_*BYTES_PER_DIM;
+
+  if (nodes_.empty() || min.size() != stride || max.size() != stride) {
+    return;
+  }
+
+  assert(in_);
+  auto in = in_->reopen(); // thread-safe input
+
+  if (!in) {
+    throw io_error("failed to reopen bkd tree leaves");
+  }
+
+  bstring cell_min;
+  bstring cell_max;
+  const auto* bounds = bounds_.c_str();
+
+  for (const auto root : roots_) {
+    cell_min.assign(bounds, stride);
+    cell_max.assign(bounds + stride, stride);
+    bounds += 2*stride;
+
+    visit(*in, root, cell_min, cell_max, min, max, visitor);
+  }
+}
+
+void bkd_tree::visit(
+    index_input& in,
+    size_t id,
+    bstring& cell_min,
+    bstring& cell_max,
+    const bytes_ref& min,
+    const bytes_ref& max,
+    const visitor_f& visitor) const {
+  const auto rel = compare(cell_min.c_str(), cell_max.c_str(),
+                           min.c_str(), max.c_str(), dims_);
+
+  if (relation::OUTSIDE == rel) {
+    return;
+  }
+
+  if (relation::INSIDE == rel) {
+    visit_all(in, id, visitor);
+    return;
+  }
+
+  const auto& node = nodes_[id];
+
+  if (LEAF != node.dim) {
+    const size_t offset = node.dim*BYTES_PER_DIM;
+    byte_type bound[BYTES_PER_DIM];
+
+    std::memcpy(bound, &cell_max[offset], BYTES_PER_DIM);
+    std::memcpy(&cell_max[offset], node.split, BYTES_PER_DIM);
+    visit(in, id + 1, cell_min, cell_max, min, max, visitor);
+    std::memcpy(&cell_max[offset], bound, BYTES_PER_DIM);
+
+    std::memcpy(bound, &cell_min[offset], BYTES_PER_DIM);
+    std::memcpy(&cell_min[offset], node.split, BYTES_PER_DIM);
+    visit(in, size_t(node.value), cell_min, cell_max, min, max, visitor);
+    std::memcpy(&cell_min[offset], bound, BYTES_PER_DIM);
+
+    return;
+  }
+
+  // leaf crosses the query, check every point
+  in.seek(node.value);
+
+  const uint32_t count = in.read_vint();
+  std::vector<doc_id_t> docs(count);
+
+  doc_id_t doc = 0;
+  for (auto& d : docs) {
+    d = (doc += in.read_vint());
+  }
+
+  size_t prefix[MAX_DIMS];
+  bstring point(dims_*BYTES_PER_DIM, 0);
+
+  for (size_t dim = 0; dim < dims_; ++dim) {
+    prefix[dim] = in.read_byte();
+
+    if (prefix[dim] > BYTES_PER_DIM) {
+      throw index_error(string_utils::to_string(
+        "while reading bkd tree, error: invalid prefix length '" IR_SIZE_T_SPECIFIER "'",
+        prefix[dim]));
+    }
+
+    in.read_bytes(&point[dim*BYTES_PER_DIM], prefix[dim]);
+  }
+
+  for (const auto d : docs) {
+    for (size_t dim = 0; dim < dims_; ++dim) {
+      in.read_bytes(&point[dim*BYTES_PER_DIM + prefix[dim]], BYTES_PER_DIM - prefix[dim]);
+    }
+
+    if (relation::OUTSIDE != compare(point.c_str(), point.c_str(),
+                                     min.c_str(), max.c_str(), dims_)) {
+      visitor(d);
+    }
+  }
+}
+
+void bkd_tree::visit_all(
+    index_input& in,
+    size_t id,
+    const visitor_f& visitor) const {
+  const auto& node = nodes_[id];
+
+  if (LEAF != node.dim) {
+    visit_all(in, id + 1, visitor);
+    visit_all(in, size_t(node.value), visitor);
+    return;
+  }
+
+  // only documents are needed, values are skipped
+  in.seek(node.value);
+
+  doc_id_t doc = 0;
+  for (auto count = in.read_vint(); count; --count) {
+    visitor(doc += in.read_vint());
+  }
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                   bkd_tree::writer
+// -----------------------------------------------------------------------------
+
+void bkd_tree::writer::prepare(index_output& out, size_t dims) {
+  assert(dims && dims <= MAX_DIMS);
+  assert(!dims_); // cleared
+  out_ = &out;
+  dims_ = dims;
+}
+
+void bkd_tree::writer::clear() noexcept {
+  values_.clear();
+  docs_.clear();
+  index_.clear();
+  out_ = nullptr;
+  dims_ = 0;
+  count_ = 0;
+  chunks_ = 0;
+  last_fp_ = 0;
+}
+
+void bkd_tree::writer::push(
+    const byte_type* point,
+    const doc_id_t* docs,
+    size_t count) {
+  assert(out_);
+  const size_t stride = dims_*BYTES_PER_DIM;
+
+  for (; count; --count) {
+    values_.append(point, stride);
+    docs_.push_back(*docs++);
+
+    if (docs_.size() == max_points_) {
+      flush();
+    }
+  }
+}
+
+void bkd_tree::writer::flush() {
+  const size_t count = docs_.size();
+
+  if (!count) {
+    return;
+  }
+
+  const size_t stride = dims_*BYTES_PER_DIM;
+  const auto* values = values_.c_str();
+  bstring min(values, stride);
+  bstring max(values, stride);
+
+  for (size_t i = 1; i < count; ++i) {
+    const auto* point = values + i*stride;
+
+    for (size_t offset = 0; offset < stride; offset += BYTES_PER_DIM) {
+      if (compare(point + offset, &min[offset]) < 0) {
+        std::memcpy(&min[offset], point + offset, BYTES_PER_DIM);
+      }
+
+      if (compare(point + offset, &max[offset]) > 0) {
+        std::memcpy(&max[offset], point + offset, BYTES_PER_DIM);
+      }
+    }
+  }
+
+  bytes_output index_out(index_);
+  index_out.write_bytes(min.c_str(), stride);
+  index_out.write_bytes(max.c_str(), stride);
+
+  tree_writer(index_out, *out_, last_fp_, dims_, values, docs_.data(), count).write();
+
+  count_ += count;
+  ++chunks_;
+  values_.clear();
+  docs_.clear();
+}
+
+void bkd_tree::writer::finish(data_output& index_out) {
+  flush();
+  assert(count_ && chunks_);
+
+  index_out.write_vint(uint32_t(dims_));
+  index_out.write_vlong(count_);
+  index_out.write_vlong(chunks_);
+  index_out.write_bytes(index_.c_str(), index_.size());
+
+  out_ = nullptr;
+}
+
+}
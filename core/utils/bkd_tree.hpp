@@ -0,0 +1,199 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IRESEARCH_BKD_TREE_H
+#define IRESEARCH_BKD_TREE_H
+
+#include <functional>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/attributes.hpp"
+#include "utils/integer.hpp"
+#include "utils/noncopyable.hpp"
+#include "utils/string.hpp"
+
+namespace iresearch {
+
+struct data_input;
+struct data_output;
+struct index_input;
+struct index_output;
+
+//////////////////////////////////////////////////////////////////////////////
+/// @class bkd_tree
+/// @brief block KD-tree over the points of a field within a segment
+///        used as a marker in field::features to request a tree for the
+///        field (e.g. a timestamp or a location), exposed by term_reader
+///        afterwards in order to evaluate range queries over a few leaf
+///        blocks instead of a large number of terms
+/// @note every term of such a field is a point of 'dims()' dimensions,
+///       each dimension is 'BYTES_PER_DIM' bytes produced by encode(...)
+/// @note points of a field are split into chunks of at most
+///       'MAX_POINTS_IN_CHUNK' points in the order they're written, each
+///       chunk is indexed by a tree of its own, thus the memory needed to
+///       write a field doesn't depend on the number of its points
+//////////////////////////////////////////////////////////////////////////////
+struct IRESEARCH_API bkd_tree final : attribute {
+  typedef std::function<void(doc_id_t)> visitor_f;
+
+  // DO NOT CHANGE NAME
+  static constexpr string_ref type_name() noexcept {
+    return "iresearch::bkd_tree";
+  }
+
+  static constexpr size_t BYTES_PER_DIM = sizeof(uint64_t);
+  static constexpr size_t MAX_DIMS = 8;
+  static constexpr size_t MAX_POINTS_IN_LEAF = 512;
+  static constexpr size_t MAX_POINTS_IN_CHUNK = size_t(1) << 18;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @class writer
+  /// @brief accumulates points of a field and writes leaf blocks of a tree
+  ///        to the output of leaves once a chunk of points is full, only the
+  ///        index of the trees is kept till the end of the field
+  //////////////////////////////////////////////////////////////////////////////
+  class IRESEARCH_API writer : private util::noncopyable {
+   public:
+    explicit writer(size_t max_points = MAX_POINTS_IN_CHUNK) noexcept
+      : max_points_(max_points) {
+      assert(max_points_);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief start writing points of 'dims' dimensions each, leaf blocks
+    ///        are written to 'out'
+    /// @note writer has to be empty, i.e. just created or cleared
+    //////////////////////////////////////////////////////////////////////////
+    void prepare(index_output& out, size_t dims);
+
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief add a point of 'dims*BYTES_PER_DIM' bytes for every document
+    ///        of the specified ones
+    //////////////////////////////////////////////////////////////////////////
+    void push(const byte_type* point, const doc_id_t* docs, size_t count);
+
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief write remaining points and the index of the trees, which is
+    ///        later read by bkd_tree::read(...), to 'index_out'
+    //////////////////////////////////////////////////////////////////////////
+    void finish(data_output& index_out);
+
+    //////////////////////////////////////////////////////////////////////////
+    /// @brief drop accumulated points, prepare(...) is required afterwards
+    //////////////////////////////////////////////////////////////////////////
+    void clear() noexcept;
+
+    // @returns number of dimensions of points, 0 before prepare(...)
+    size_t dims() const noexcept { return dims_; }
+
+    // @returns number of points written so far
+    uint64_t size() const noexcept { return count_; }
+
+   private:
+    void flush();
+
+    IRESEARCH_API_PRIVATE_VARIABLES_BEGIN
+    bstring values_; // points of a current chunk
+    std::vector<doc_id_t> docs_; // documents of 'values_'
+    bstring index_; // index of flushed trees
+    index_output* out_{};
+    size_t max_points_;
+    size_t dims_{};
+    uint64_t count_{};
+    uint64_t chunks_{};
+    uint64_t last_fp_{}; // leaf pointers are delta encoded
+    IRESEARCH_API_PRIVATE_VARIABLES_END
+  }; // writer
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief encode a dimension of a point into 'BYTES_PER_DIM' bytes
+  ///        preserving the order of values
+  //////////////////////////////////////////////////////////////////////////////
+  static void encode(int64_t value, byte_type* out) noexcept;
+  static void encode(double_t value, byte_type* out) noexcept;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief read the index of a tree, leaf blocks are read on demand from
+  ///        the input specified via reset(...)
+  //////////////////////////////////////////////////////////////////////////////
+  void read(data_input& in);
+
+  void reset(const index_input* in) noexcept { in_ = in; }
+
+  void clear() noexcept {
+    nodes_.clear();
+    roots_.clear();
+    bounds_.clear();
+    count_ = 0;
+    dims_ = 0;
+  }
+
+  bool empty() const noexcept { return nodes_.empty(); }
+
+  // @returns number of dimensions of points
+  size_t dims() const noexcept { return dims_; }
+
+  // @returns number of points
+  uint64_t size() const noexcept { return count_; }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief visit documents of points within ['min', 'max'] inclusive in
+  ///        every dimension, a document is visited once per matching point
+  /// @note 'min' and 'max' are packed the same way as the points
+  //////////////////////////////////////////////////////////////////////////////
+  void visit(
+    const bytes_ref& min,
+    const bytes_ref& max,
+    const visitor_f& visitor) const;
+
+ private:
+  static constexpr uint32_t LEAF = integer_traits<uint32_t>::const_max;
+
+  struct node {
+    uint64_t value; // file pointer of a leaf or index of a right child
+    uint32_t dim; // split dimension, 'LEAF' for leaves
+    byte_type split[BYTES_PER_DIM]; // split value, unused for leaves
+  };
+
+  size_t read_node(data_input& in, uint64_t& fp, size_t depth);
+
+  void visit(
+    index_input& in,
+    size_t node,
+    bstring& cell_min,
+    bstring& cell_max,
+    const bytes_ref& min,
+    const bytes_ref& max,
+    const visitor_f& visitor) const;
+
+  void visit_all(index_input& in, size_t node, const visitor_f& visitor) const;
+
+  std::vector<node> nodes_; // nodes of every tree in pre-order
+  std::vector<size_t> roots_; // roots of trees in 'nodes_'
+  bstring bounds_; // lower and upper bounds of points of every tree
+  const index_input* in_{}; // input with leaf blocks
+  uint64_t count_{};
+  uint32_t dims_{};
+}; // bkd_tree
+
+}
+
+#endif // IRESEARCH_BKD_TREE_H
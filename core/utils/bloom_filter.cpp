@@ -0,0 +1,124 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "shared.hpp"
+#include "bloom_filter.hpp"
+
+#include "MurmurHash/MurmurHash3.h"
+#include "error/error.hpp"
+#include "store/data_input.hpp"
+#include "store/data_output.hpp"
+#include "utils/string_utils.hpp"
+
+namespace {
+
+// optimal number of probes for 'BITS_PER_KEY' bits per key: ~bits*ln(2)
+constexpr uint32_t NUM_HASHES = 7;
+
+constexpr uint32_t MAX_HASHES = 30;
+
+}
+
+namespace iresearch {
+
+REGISTER_ATTRIBUTE(bloom_filter);
+
+/*static*/ uint64_t bloom_filter::hash(const bytes_ref& key) noexcept {
+  uint64_t out[2];
+  MurmurHash3_x64_128(key.c_str(), int(key.size()), 0, out);
+  return out[0];
+}
+
+void bloom_filter::reset(const uint64_t* hashes, size_t count) {
+  bits_.clear();
+  num_hashes_ = 0;
+
+  if (!count) {
+    return;
+  }
+
+  bits_.resize((count*BITS_PER_KEY + 63) / 64, 0);
+  num_hashes_ = NUM_HASHES;
+
+  const uint64_t num_bits = bits_.size()*64;
+
+  for (auto* end = hashes + count; hashes != end; ++hashes) {
+    // double hashing, see Kirsch & Mitzenmacher
+    const uint32_t h1 = uint32_t(*hashes);
+    const uint32_t h2 = uint32_t(*hashes >> 32) | 1;
+
+    for (uint32_t i = 0; i < num_hashes_; ++i) {
+      const uint64_t bit = (h1 + uint64_t(i)*h2) % num_bits;
+      bits_[bit >> 6] |= uint64_t(1) << (bit & 63);
+    }
+  }
+}
+
+bool bloom_filter::contains(uint64_t hash) const noexcept {
+  if (bits_.empty()) {
+    return true;
+  }
+
+  const uint64_t num_bits = bits_.size()*64;
+  const uint32_t h1 = uint32_t(hash);
+  const uint32_t h2 = uint32_t(hash >> 32) | 1;
+
+  for (uint32_t i = 0; i < num_hashes_; ++i) {
+    const uint64_t bit = (h1 + uint64_t(i)*h2) % num_bits;
+
+    if (!(bits_[bit >> 6] & (uint64_t(1) << (bit & 63)))) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void bloom_filter::read(data_input& in) {
+  const uint32_t num_hashes = in.read_vint();
+  const uint64_t num_words = in.read_vlong();
+
+  if (num_hashes > MAX_HASHES || (num_words && !num_hashes)) {
+    throw index_error(string_utils::to_string(
+      "while reading bloom filter, error: invalid number of hashes '%u'",
+      num_hashes));
+  }
+
+  std::vector<uint64_t> bits(num_words);
+
+  for (auto& word : bits) {
+    word = static_cast<uint64_t>(in.read_long());
+  }
+
+  bits_ = std::move(bits);
+  num_hashes_ = num_hashes;
+}
+
+void bloom_filter::write(data_output& out) const {
+  out.write_vint(num_hashes_);
+  out.write_vlong(bits_.size());
+
+  for (const auto word : bits_) {
+    out.write_long(static_cast<int64_t>(word));
+  }
+}
+
+}
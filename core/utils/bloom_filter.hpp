@@ -0,0 +1,86 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IRESEARCH_BLOOM_FILTER_H
+#define IRESEARCH_BLOOM_FILTER_H
+
+#include <vector>
+
+#include "utils/attributes.hpp"
+#include "utils/string.hpp"
+
+namespace iresearch {
+
+struct data_input;
+struct data_output;
+
+//////////////////////////////////////////////////////////////////////////////
+/// @class bloom_filter
+/// @brief probabilistic set of terms of a field within a segment
+///        used as a marker in field::features to request a filter for the
+///        field (e.g. a primary key), exposed by term_reader afterwards in
+///        order to reject absent terms without seeking the term dictionary
+/// @note an empty filter reports every term as present
+//////////////////////////////////////////////////////////////////////////////
+struct IRESEARCH_API bloom_filter final : attribute {
+  // DO NOT CHANGE NAME
+  static constexpr string_ref type_name() noexcept {
+    return "iresearch::bloom_filter";
+  }
+
+  static constexpr size_t BITS_PER_KEY = 10; // ~1% false positive rate
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns hash of a key suitable for reset(...)/contains(...)
+  //////////////////////////////////////////////////////////////////////////////
+  static uint64_t hash(const bytes_ref& key) noexcept;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief rebuild filter to hold the specified key hashes
+  //////////////////////////////////////////////////////////////////////////////
+  void reset(const uint64_t* hashes, size_t count);
+
+  void clear() noexcept {
+    bits_.clear();
+    num_hashes_ = 0;
+  }
+
+  bool contains(uint64_t hash) const noexcept;
+
+  bool contains(const bytes_ref& key) const noexcept {
+    return contains(hash(key));
+  }
+
+  bool empty() const noexcept { return bits_.empty(); }
+
+  // @returns size of the filter in bytes
+  size_t memory() const noexcept { return bits_.size()*sizeof(uint64_t); }
+
+  void read(data_input& in);
+  void write(data_output& out) const;
+
+ private:
+  std::vector<uint64_t> bits_;
+  uint32_t num_hashes_{};
+}; // bloom_filter
+
+}
+
+#endif // IRESEARCH_BLOOM_FILTER_H
@@ -24,6 +24,7 @@
 #define IRESEARCH_TABLE_MATCHER_H
 
 #include <algorithm>
+#include <memory>
 
 #include "fst/matcher.h"
 #include "utils/misc.hpp"
@@ -69,15 +70,20 @@ class TableMatcher final : public MatcherBase<typename F::Arc> {
     | kAcceptor;
 
   explicit TableMatcher(const FST& fst, Label rho)
-    : start_labels_(fst::getStartLabels<F, MatchInput>(fst)),
-      arc_(kNoLabel, kNoLabel, Weight::NoWeight(), kNoStateId),
+    : arc_(kNoLabel, kNoLabel, Weight::NoWeight(), kNoStateId),
       rho_(rho), fst_(&fst),
       error_(fst.Properties(FST_PROPERTIES, true) != FST_PROPERTIES) {
-    const size_t numLabels = start_labels_.size();
+    auto table = std::make_shared<Table>();
+    auto& start_labels = table->start_labels;
+    auto& transitions = table->transitions;
+    auto& cached_label_offsets = table->cached_label_offsets;
+
+    start_labels = fst::getStartLabels<F, MatchInput>(fst);
+    const size_t numLabels = start_labels.size();
 
     // initialize transition table
     ArcIteratorData<Arc> data;
-    transitions_.resize(fst.NumStates()*numLabels , kNoStateId);
+    transitions.resize(fst.NumStates()*numLabels , kNoStateId);
     for (StateIterator<FST> siter(fst); !siter.Done(); siter.Next()) {
       const auto state = siter.Value();
 
@@ -90,7 +96,7 @@ class TableMatcher final : public MatcherBase<typename F::Arc> {
 
         for (; rbegin != rend; ++rbegin) {
           if (rho_ == get_label(*rbegin)) {
-            std::fill_n(transitions_.begin() + state*numLabels, numLabels, rbegin->nextstate);
+            std::fill_n(transitions.begin() + state*numLabels, numLabels, rbegin->nextstate);
             break;
           }
         }
@@ -99,8 +105,8 @@ class TableMatcher final : public MatcherBase<typename F::Arc> {
       // fill existing transitions
       auto arc = data.arcs;
       auto arc_end = data.arcs + data.narcs;
-      auto label = start_labels_.begin();
-      auto label_end = start_labels_.end();
+      auto label = start_labels.begin();
+      auto label_end = start_labels.end();
       for (; arc != arc_end && label != label_end;) {
         for (; arc != arc_end && get_label(*arc) < *label; ++arc) { }
 
@@ -115,7 +121,7 @@ class TableMatcher final : public MatcherBase<typename F::Arc> {
         }
 
         if (get_label(*arc) == *label) {
-          transitions_[state*numLabels + std::distance(start_labels_.begin(), label)] = arc->nextstate;
+          transitions[state*numLabels + std::distance(start_labels.begin(), label)] = arc->nextstate;
           ++label;
           ++arc;
         }
@@ -125,20 +131,22 @@ class TableMatcher final : public MatcherBase<typename F::Arc> {
     // initialize lookup table for first CacheSize labels,
     // code below is the optimized version of:
     // for (size_t i = 0; i < CacheSize; ++i) {
-    //   cached_label_offsets_[i] = find_label_offset(i);
+    //   cached_label_offsets[i] = find_label_offset(i);
     // }
-    auto begin = start_labels_.begin();
-    auto end = start_labels_.end();
+    auto begin = start_labels.begin();
+    auto end = start_labels.end();
     for (size_t i = 0, offset = 0;
-         i < IRESEARCH_COUNTOF(cached_label_offsets_); ++i) {
+         i < IRESEARCH_COUNTOF(cached_label_offsets); ++i) {
       if (begin != end && size_t(*begin) == i) {
-        cached_label_offsets_[i] = offset;
+        cached_label_offsets[i] = offset;
         ++offset;
         ++begin;
       } else {
-        cached_label_offsets_[i] = numLabels;
+        cached_label_offsets[i] = numLabels;
       }
     }
+
+    table_ = std::move(table);
   }
 
   virtual TableMatcher* Copy(bool) const override {
@@ -171,25 +179,27 @@ class TableMatcher final : public MatcherBase<typename F::Arc> {
 
   virtual void SetState(StateId s) noexcept final {
     assert(!error_);
-    assert(s*start_labels_.size() < transitions_.size());
-    state_begin_ = transitions_.data() + s*start_labels_.size();
+    const auto num_labels = table_->start_labels.size();
+    assert(s*num_labels < table_->transitions.size());
+    state_begin_ = table_->transitions.data() + s*num_labels;
     state_ = state_begin_;
-    state_end_ = state_begin_ + start_labels_.size();
+    state_end_ = state_begin_ + num_labels;
   }
 
   virtual bool Find(Label label) noexcept final {
     assert(!error_);
-    auto label_offset = (size_t(label) < IRESEARCH_COUNTOF(cached_label_offsets_)
-                           ? cached_label_offsets_[size_t(label)]
+    const auto& start_labels = table_->start_labels;
+    auto label_offset = (size_t(label) < IRESEARCH_COUNTOF(table_->cached_label_offsets)
+                           ? table_->cached_label_offsets[size_t(label)]
                            : find_label_offset(label));
 
-    if (label_offset == start_labels_.size()) {
-      if (start_labels_.back() != rho_) {
+    if (label_offset == start_labels.size()) {
+      if (start_labels.back() != rho_) {
         state_ = state_end_;
         return false;
       }
 
-      label_offset = start_labels_.size() - 1;
+      label_offset = start_labels.size() - 1;
     }
 
     state_ = state_begin_ + label_offset;
@@ -220,7 +230,7 @@ class TableMatcher final : public MatcherBase<typename F::Arc> {
     for (; !Done(); ++state_) {
       if (*state_ != kNoLabel) {
         assert(state_ > state_begin_ && state_ < state_end_);
-        const auto label = start_labels_[size_t(std::distance(state_begin_, state_))];
+        const auto label = table_->start_labels[size_t(std::distance(state_begin_, state_))];
         if constexpr (MATCH_TYPE == MATCH_INPUT) {
           arc_.ilabel = label;
         } else {
@@ -248,7 +258,21 @@ class TableMatcher final : public MatcherBase<typename F::Arc> {
     return inprops | (error_ ? kError : 0);
   }
 
+  // memory used by the transition table shared between copies in bytes
+  size_t MemoryUsage() const noexcept {
+    return sizeof(Table)
+      + table_->start_labels.size()*sizeof(Label)
+      + table_->transitions.size()*sizeof(StateId);
+  }
+
  private:
+  // read-only after construction, thus shared between copies of a matcher
+  struct Table {
+    size_t cached_label_offsets[CacheSize]{};
+    std::vector<Label> start_labels;
+    std::vector<StateId> transitions;
+  };
+
   template<typename Arc>
   static typename Arc::Label get_label(Arc& arc) {
     if constexpr (MATCH_TYPE == MATCH_INPUT) {
@@ -259,20 +283,19 @@ class TableMatcher final : public MatcherBase<typename F::Arc> {
   }
 
   size_t find_label_offset(Label label) const noexcept {
-    const auto it = std::lower_bound(start_labels_.begin(), start_labels_.end(), label);
+    const auto& start_labels = table_->start_labels;
+    const auto it = std::lower_bound(start_labels.begin(), start_labels.end(), label);
 
-    if (it == start_labels_.end() || *it != label) {
-      return start_labels_.size();
+    if (it == start_labels.end() || *it != label) {
+      return start_labels.size();
     }
 
-    assert(it != start_labels_.end());
-    assert(start_labels_.begin() <= it);
-    return size_t(std::distance(start_labels_.begin(), it));
+    assert(it != start_labels.end());
+    assert(start_labels.begin() <= it);
+    return size_t(std::distance(start_labels.begin(), it));
   }
 
-  size_t cached_label_offsets_[CacheSize]{};
-  std::vector<Label> start_labels_;
-  std::vector<StateId> transitions_;
+  std::shared_ptr<const Table> table_;
   Arc arc_;
   Label rho_;
   const FST* fst_;                   // FST for matching
@@ -28,8 +28,10 @@
 #include <fst/expanded-fst.h>
 
 #include "shared.hpp"
+#include "error/error.hpp"
 #include "store/data_output.hpp"
 #include "store/data_input.hpp"
+#include "utils/bytes_utils.hpp"
 #include "utils/misc.hpp"
 
 namespace fst {
@@ -79,7 +81,9 @@ class ImmutableFstImpl : public internal::FstImpl<A> {
 
   size_t NumOutputEpsilons(StateId) const noexcept { return 0; }
 
-  static std::shared_ptr<ImmutableFstImpl<Arc>> Read(irs::data_input& strm);
+  static std::shared_ptr<ImmutableFstImpl<Arc>> Read(irs::index_input& strm);
+
+  static bool Skip(irs::index_input& strm);
 
   const Arc* Arcs(StateId s) const noexcept { return states_[s].arcs; }
 
@@ -113,9 +117,24 @@ class ImmutableFstImpl : public internal::FstImpl<A> {
   // Properties always true of this FST class.
   static constexpr uint64 kStaticProperties = kExpanded;
 
+  // reads a variable length value from [in, end),
+  // throws 'index_error' on truncated input
+  template<typename T>
+  static T CheckedRead(const irs::byte_type*& in, const irs::byte_type* end);
+
+  // reads states & arcs directly from the memory of a stream supporting
+  // persistent buffers, weights are referenced in place,
+  // throws 'index_error' on truncated or malformed input
+  static bool ReadInPlace(
+    irs::index_input& stream,
+    State* states, size_t nstates,
+    Arc* arcs, size_t narcs,
+    size_t total_weight_size);
+
   std::unique_ptr<State[]> states_;
   std::unique_ptr<Arc[]> arcs_;
-  std::unique_ptr<irs::byte_type[]> weights_;
+  std::unique_ptr<irs::byte_type[]> weights_; // nullptr if read in place
+  irs::index_input::ptr input_; // keeps weights read in place alive
   size_t narcs_;                               // Number of arcs.
   StateId nstates_;                            // Number of states.
   StateId start_;                              // Initial state.
@@ -125,7 +144,160 @@ class ImmutableFstImpl : public internal::FstImpl<A> {
 };
 
 template<typename Arc>
-std::shared_ptr<ImmutableFstImpl<Arc>> ImmutableFstImpl<Arc>::Read(irs::data_input& stream) {
+template<typename T>
+T ImmutableFstImpl<Arc>::CheckedRead(
+    const irs::byte_type*& in,
+    const irs::byte_type* end) {
+  constexpr size_t kMaxSize = irs::bytes_io<T, sizeof(T)>::const_max_vsize;
+
+  if (size_t(end - in) >= kMaxSize) {
+    return irs::vread<T>(in); // fast path, the longest value fits
+  }
+
+  // slow path, value is near the end of input
+  T value = 0;
+  for (size_t shift = 0; in != end; shift += 7) {
+    const irs::byte_type b = *in++;
+    value |= T(b & 0x7F) << shift;
+
+    if (!(b & 0x80)) {
+      return value;
+    }
+  }
+
+  throw irs::index_error("unexpected end of immutable FST");
+}
+
+template<typename Arc>
+bool ImmutableFstImpl<Arc>::ReadInPlace(
+    irs::index_input& stream,
+    State* states, size_t nstates,
+    Arc* arcs, size_t narcs,
+    size_t total_weight_size) {
+  const size_t start = stream.file_pointer();
+  const size_t length = stream.length();
+
+  if (start > length) {
+    return false;
+  }
+
+  const auto* data = stream.read_buffer(length - start, irs::BufferHint::PERSISTENT);
+
+  if (!data) {
+    return false;
+  }
+
+  const auto* data_end = data + (length - start);
+
+  // read states & arcs
+  const auto* in = data;
+  auto* arc = arcs;
+  auto* arcs_end = arcs + narcs;
+  for (auto* state = states, *end = state + nstates; state != end; ++state) {
+    if (in == data_end) {
+      throw irs::index_error("unexpected end of immutable FST");
+    }
+
+    state->arcs = arc;
+    state->narcs = *in++;
+    state->weight = { nullptr, CheckedRead<uint64_t>(in, data_end) };
+
+    if (state->narcs > size_t(arcs_end - arc)) {
+      throw irs::index_error("invalid number of arcs in immutable FST");
+    }
+
+    for (auto* end = arc + state->narcs; arc != end; ++arc) {
+      if (in == data_end) {
+        throw irs::index_error("unexpected end of immutable FST");
+      }
+
+      arc->ilabel = *in++;
+      arc->nextstate = CheckedRead<uint32_t>(in, data_end);
+      arc->weight = { nullptr, CheckedRead<uint64_t>(in, data_end) };
+
+      if (size_t(arc->nextstate) >= nstates) {
+        throw irs::index_error("invalid arc target in immutable FST");
+      }
+    }
+  }
+
+  if (arc != arcs_end || total_weight_size > size_t(data_end - in)) {
+    throw irs::index_error("invalid size of immutable FST");
+  }
+
+  // point weights to the stream memory
+  const auto* weight = in;
+  const auto* weight_end = in + total_weight_size;
+  arc = arcs;
+  for (auto* state = states, *end = state + nstates; state != end; ++state) {
+    if (state->weight.Size() > size_t(weight_end - weight)) {
+      throw irs::index_error("invalid weight size in immutable FST");
+    }
+
+    state->weight = { weight, state->weight.Size() };
+    weight += state->weight.Size();
+
+    for (auto* end = arc + state->narcs; arc != end; ++arc) {
+      if (arc->weight.Size() > size_t(weight_end - weight)) {
+        throw irs::index_error("invalid weight size in immutable FST");
+      }
+
+      arc->weight = { weight, arc->weight.Size() };
+      weight += arc->weight.Size();
+    }
+  }
+
+  if (weight != weight_end) {
+    throw irs::index_error("invalid size of immutable FST weights");
+  }
+
+  stream.seek(start + size_t(std::distance(data, weight)));
+
+  return true;
+}
+
+template<typename Arc>
+bool ImmutableFstImpl<Arc>::Skip(irs::index_input& stream) {
+  // read header
+  if (Version(stream.read_byte()) != Version::MIN) {
+    return false;
+  }
+
+  stream.read_long(); // properties
+  const size_t total_weight_size = stream.read_long();
+  stream.read_vint(); // start state
+  const size_t nstates = stream.read_vlong();
+  const size_t narcs = stream.read_vlong();
+
+  // skip states & arcs
+  size_t arcs_left = narcs;
+  for (size_t state = 0; state < nstates; ++state) {
+    size_t state_narcs = stream.read_byte();
+    stream.read_vlong(); // final weight size
+
+    if (state_narcs > arcs_left) {
+      return false;
+    }
+
+    for (arcs_left -= state_narcs; state_narcs; --state_narcs) {
+      stream.read_byte(); // label
+      stream.read_vint(); // next state
+      stream.read_vlong(); // weight size
+    }
+  }
+
+  if (arcs_left) {
+    return false;
+  }
+
+  // skip weights
+  stream.seek(stream.file_pointer() + total_weight_size);
+
+  return true;
+}
+
+template<typename Arc>
+std::shared_ptr<ImmutableFstImpl<Arc>> ImmutableFstImpl<Arc>::Read(irs::index_input& stream) {
   auto impl = std::make_shared<ImmutableFstImpl<Arc>>();
 
   // read header
@@ -141,6 +313,23 @@ std::shared_ptr<ImmutableFstImpl<Arc>> ImmutableFstImpl<Arc>::Read(irs::data_inp
 
   auto states = std::make_unique<State[]>(nstates);
   auto arcs = std::make_unique<Arc[]>(narcs);
+
+  if (ReadInPlace(stream, states.get(), nstates, arcs.get(), narcs, total_weight_size)) {
+    // keep stream memory referenced by weights alive
+    auto input = stream.dup();
+
+    // noexcept block
+    impl->properties_ = props;
+    impl->start_ = start;
+    impl->nstates_ = nstates;
+    impl->narcs_ = narcs;
+    impl->states_ = std::move(states);
+    impl->arcs_ = std::move(arcs);
+    impl->input_ = std::move(input);
+
+    return impl;
+  }
+
   auto weights = std::make_unique<irs::byte_type[]>(total_weight_size);
 
   // read states & arcs
@@ -200,11 +389,16 @@ class ImmutableFst : public ImplToExpandedFst<ImmutableFstImpl<A>> {
     return new ImmutableFst<A>(*this, safe);
   }
 
-  static ImmutableFst<A>* Read(irs::data_input& strm) {
+  static ImmutableFst<A>* Read(irs::index_input& strm) {
     auto impl = Impl::Read(strm);
     return impl ? new ImmutableFst<A>(std::move(impl)) : nullptr;
   }
 
+  // skips an FST without materializing it, returns false on malformed input
+  static bool Skip(irs::index_input& strm) {
+    return Impl::Skip(strm);
+  }
+
   // for OpenFST API compliance
   static ImmutableFst<A>* Read(std::istream& strm,
                                const FstReadOptions& /*opts*/) {
@@ -223,6 +417,10 @@ class ImmutableFst : public ImplToExpandedFst<ImmutableFstImpl<A>> {
                     irs::data_output& strm,
                     const Stats& stats);
 
+  // returns number of bytes written by Write(...) for the specified FST
+  template<typename FST, typename Stats>
+  static size_t WriteSize(const FST& fst, const Stats& stats);
+
   void InitStateIterator(StateIteratorData<Arc> *data) const override {
     GetImpl()->InitStateIterator(data);
   }
@@ -316,6 +514,45 @@ bool ImmutableFst<A>::Write(
   return true;
 }
 
+template <typename A>
+template <typename FST, typename Stats>
+size_t ImmutableFst<A>::WriteSize(const FST& fst, const Stats& stats) {
+  using uint32_io = irs::bytes_io<uint32_t, sizeof(uint32_t)>;
+  using uint64_io = irs::bytes_io<uint64_t, sizeof(uint64_t)>;
+
+  auto* impl = fst.GetImpl();
+  assert(impl);
+
+  // header
+  size_t size = sizeof(irs::byte_type) + 2*sizeof(uint64_t)
+    + uint32_io::vsize(uint32_t(fst.Start()))
+    + uint64_io::vsize(stats.num_states)
+    + uint64_io::vsize(stats.num_arcs);
+
+  // states & arcs
+  for (StateIterator<FST> siter(fst); !siter.Done(); siter.Next()) {
+    const StateId s = siter.Value();
+
+    size += sizeof(irs::byte_type);
+    if constexpr (detail::has_member_FinalRef_v<typename FST::Impl>) {
+      size += uint64_io::vsize(impl->FinalRef(s).Size());
+    } else {
+      size += uint64_io::vsize(impl->Final(s).Size());
+    }
+
+    for (ArcIterator<FST> aiter(fst, s); !aiter.Done(); aiter.Next()) {
+      const auto& arc = aiter.Value();
+
+      size += sizeof(irs::byte_type)
+        + uint32_io::vsize(uint32_t(arc.nextstate))
+        + uint64_io::vsize(arc.weight.Size());
+    }
+  }
+
+  // weights
+  return size + stats.total_weight_size;
+}
+
 } // fstext
 
 // Specialization for ConstFst; see generic version in fst.h for sample usage
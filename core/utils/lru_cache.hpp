@@ -0,0 +1,255 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IRESEARCH_LRU_CACHE_H
+#define IRESEARCH_LRU_CACHE_H
+
+#include <atomic>
+#include <cassert>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include "utils/noncopyable.hpp"
+
+namespace iresearch {
+
+//////////////////////////////////////////////////////////////////////////////
+/// @struct lru_cache_stats
+/// @brief snapshot of the state of an 'lru_cache'
+//////////////////////////////////////////////////////////////////////////////
+struct lru_cache_stats {
+  size_t size; // number of cached values
+  size_t weight; // total weight of cached values
+  size_t max_weight; // limit for the total weight of cached values
+  size_t hits; // number of lookups that found a cached value
+  size_t misses; // number of lookups that didn't find a cached value
+}; // lru_cache_stats
+
+//////////////////////////////////////////////////////////////////////////////
+/// @class lru_cache
+/// @brief a thread-safe cache evicting least recently used values once the
+///        total weight of cached values exceeds 'max_weight', values are
+///        keyed by a group and by a key within the group, the cache is
+///        disabled while 'max_weight' is 0
+/// @note values of a group are evicted together in time proportional to
+///       their number, see erase(...)
+/// @note values are returned by copy, i.e. 'Value' is expected to be a cheap
+///       handle like a shared pointer keeping an evicted value valid while
+///       it's in use
+//////////////////////////////////////////////////////////////////////////////
+template<
+  typename Group,
+  typename Key,
+  typename Value,
+  typename GroupHash = std::hash<Group>,
+  typename KeyHash = std::hash<Key>,
+  typename KeyEqual = std::equal_to<Key>
+> class lru_cache : private util::noncopyable {
+ public:
+  typedef Group group_type;
+  typedef Key key_type;
+  typedef Value value_type;
+
+  explicit lru_cache(size_t max_weight) noexcept
+    : max_weight_(max_weight) {
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns cached value of the specified group and key marking it as
+  ///          recently used, 'value_type()' if there is no such value
+  //////////////////////////////////////////////////////////////////////////////
+  value_type get(const group_type& group, const key_type& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    const auto keys = groups_.find(group);
+
+    if (keys != groups_.end()) {
+      const auto it = keys->second.find(key);
+
+      if (it != keys->second.end()) {
+        ++hits_;
+        entries_.splice(entries_.begin(), entries_, it->second); // mark as recently used
+
+        return it->second->value;
+      }
+    }
+
+    ++misses_;
+
+    return value_type();
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief cache value of the specified weight evicting least recently used
+  ///        values if 'max_weight' is exceeded
+  /// @returns false if the value is heavier than 'max_weight' or a value of
+  ///          the same group and key is already cached, e.g. by a concurrent
+  ///          lookup that missed the same key
+  //////////////////////////////////////////////////////////////////////////////
+  bool put(
+      const group_type& group,
+      key_type key,
+      value_type value,
+      size_t weight) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto max_weight = max_weight_.load();
+
+    if (!max_weight || weight > max_weight) {
+      return false; // value doesn't fit into the cache at all
+    }
+
+    auto& node = *groups_.try_emplace(group).first; // address is stable
+    auto& keys = node.second;
+    const auto res = keys.emplace(std::move(key), entries_.end());
+
+    if (!res.second) {
+      return false; // already cached
+    }
+
+    try {
+      entries_.push_front(entry{ std::move(value), weight, &node, &res.first->first });
+    } catch (...) {
+      keys.erase(res.first);
+
+      if (keys.empty()) {
+        groups_.erase(groups_.find(node.first));
+      }
+
+      throw;
+    }
+
+    res.first->second = entries_.begin();
+    weight_ += weight;
+    evict(max_weight);
+
+    return true;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief evict all values of the specified group
+  //////////////////////////////////////////////////////////////////////////////
+  void erase(const group_type& group) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    const auto keys = groups_.find(group);
+
+    if (keys == groups_.end()) {
+      return;
+    }
+
+    for (auto& key : keys->second) {
+      weight_ -= key.second->weight;
+      entries_.erase(key.second);
+    }
+
+    groups_.erase(keys);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief evict all values
+  //////////////////////////////////////////////////////////////////////////////
+  void clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    evict(0);
+  }
+
+  // limit for the total weight of cached values
+  size_t max_weight() const noexcept { return max_weight_.load(); }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief change the limit for the total weight of cached values evicting
+  ///        least recently used values if needed
+  //////////////////////////////////////////////////////////////////////////////
+  void max_weight(size_t value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    max_weight_ = value;
+    evict(value);
+  }
+
+  // total weight of cached values
+  size_t weight() const noexcept { return weight_.load(); }
+
+  // number of cached values
+  size_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+  }
+
+  // number of lookups that found a cached value
+  size_t hits() const noexcept { return hits_.load(); }
+
+  // number of lookups that didn't find a cached value
+  size_t misses() const noexcept { return misses_.load(); }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns consistent snapshot of the cache state
+  //////////////////////////////////////////////////////////////////////////////
+  lru_cache_stats stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    return lru_cache_stats{
+      entries_.size(), weight_.load(), max_weight_.load(),
+      hits_.load(), misses_.load()
+    };
+  }
+
+ private:
+  struct entry;
+
+  typedef std::list<entry> entries_t; // most recently used first
+  typedef std::unordered_map<key_type, typename entries_t::iterator, KeyHash, KeyEqual> keys_t;
+  typedef std::unordered_map<group_type, keys_t, GroupHash> groups_t;
+
+  struct entry {
+    value_type value;
+    size_t weight;
+    typename groups_t::value_type* group; // group the entry belongs to
+    const key_type* key; // key of the entry in 'group'
+  }; // entry
+
+  void evict(size_t max_weight) noexcept { // requires 'mutex_' to be held
+    while (weight_.load() > max_weight) {
+      assert(!entries_.empty());
+      auto& lru = entries_.back();
+      auto& keys = lru.group->second;
+      keys.erase(keys.find(*lru.key));
+
+      if (keys.empty()) {
+        groups_.erase(groups_.find(lru.group->first));
+      }
+
+      weight_ -= lru.weight;
+      entries_.pop_back();
+    }
+  }
+
+  mutable std::mutex mutex_;
+  entries_t entries_; // guarded by 'mutex_'
+  groups_t groups_; // guarded by 'mutex_'
+  std::atomic<size_t> max_weight_;
+  std::atomic<size_t> weight_{0};
+  std::atomic<size_t> hits_{0};
+  std::atomic<size_t> misses_{0};
+}; // lru_cache
+
+}
+
+#endif // IRESEARCH_LRU_CACHE_H
@@ -35,6 +35,8 @@
 #include "cpuinfo.hpp"
 
 #include <numeric>
+#include <limits>
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 
@@ -336,6 +338,52 @@ template<
   output_type table_[Size];
 }; // sqrt
 
+// -----------------------------------------------------------------------------
+// --SECTION--                      lossy 1-byte encoding of unsigned integers
+// -----------------------------------------------------------------------------
+// small values are stored as is, the rest is stored as a float having 4 bits
+// of precision, i.e. 3 stored bits of mantissa along with an implicit leading
+// one, and an exponent in the remaining bits, decoded value never exceeds the
+// encoded one
+
+/// @brief number of values stored as is by 'int_to_byte4'
+constexpr uint32_t BYTE4_EXACT_VALUES = 24;
+
+/// @brief encodes 'value' into a float with 4 bits of precision, 3 stored
+///        bits of mantissa are followed by the exponent
+FORCE_INLINE uint32_t int_to_int4(uint64_t value) noexcept {
+  if (value < 8) {
+    return uint32_t(value);
+  }
+
+  const auto shift = uint32_t(log2_floor_64(value)) - 3; // keep 3 bits of mantissa
+  return (uint32_t(value >> shift) & 0x07) | ((shift + 1) << 3);
+}
+
+/// @brief decodes a float encoded with 'int_to_int4'
+FORCE_INLINE uint64_t int4_to_int(uint32_t value) noexcept {
+  const uint64_t bits = value & 0x07;
+  const uint32_t shift = value >> 3;
+  return shift ? (bits | 0x08) << (shift - 1) : bits;
+}
+
+/// @brief encodes unsigned 'value' into a single byte,
+///        values exceeding 2^31-1 are clamped
+FORCE_INLINE byte_type int_to_byte4(uint32_t value) noexcept {
+  value = std::min(value, uint32_t(std::numeric_limits<int32_t>::max()));
+
+  return value < BYTE4_EXACT_VALUES
+    ? byte_type(value)
+    : byte_type(BYTE4_EXACT_VALUES + int_to_int4(value - BYTE4_EXACT_VALUES));
+}
+
+/// @brief decodes a byte encoded with 'int_to_byte4'
+FORCE_INLINE uint32_t byte4_to_int(byte_type value) noexcept {
+  return value < BYTE4_EXACT_VALUES
+    ? value
+    : uint32_t(BYTE4_EXACT_VALUES + int4_to_int(value - BYTE4_EXACT_VALUES));
+}
+
 } // math
 } // root
 
@@ -0,0 +1,181 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tests_shared.hpp"
+#include "formats_test_case_base.hpp"
+#include "formats/formats_10_attributes.hpp"
+#include "search/score.hpp"
+
+namespace {
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                          format 15 specific tests
+// -----------------------------------------------------------------------------
+
+class format_15_test_case : public tests::index_test_base {
+};
+
+TEST_P(format_15_test_case, postings_impact) {
+  {
+    tests::templates::europarl_doc_template doc;
+    tests::delim_doc_generator gen(resource("europarl.subset.txt"), doc);
+    add_segment(gen);
+  }
+
+  auto reader = irs::directory_reader::open(dir(), codec());
+  ASSERT_EQ(1, reader.size());
+  auto& segment = reader[0];
+
+  const irs::flags features{ irs::type<irs::frequency>::get() };
+
+  auto* field = segment.field("body_anl");
+  ASSERT_NE(nullptr, field);
+
+  size_t checked_terms = 0;
+
+  for (auto terms = field->iterator(); terms->next(); ) {
+    terms->read();
+    auto* meta = irs::get<irs::term_meta>(*terms);
+    ASSERT_NE(nullptr, meta);
+
+    // collect expected postings
+    std::vector<std::pair<irs::doc_id_t, uint32_t>> postings;
+    {
+      auto docs = terms->postings(features);
+      auto* freq = irs::get<irs::frequency>(*docs);
+      ASSERT_NE(nullptr, freq);
+      while (docs->next()) {
+        postings.emplace_back(docs->value(), freq->value);
+      }
+    }
+    ASSERT_EQ(meta->docs_count, postings.size());
+
+    const auto max_freq = std::max_element(
+      postings.begin(), postings.end(),
+      [](const auto& lhs, const auto& rhs) { return lhs.second < rhs.second; })->second;
+
+    // frequencies are not requested
+    {
+      auto docs = terms->postings(irs::flags::empty_instance());
+      ASSERT_EQ(nullptr, irs::get<irs::impact>(*docs));
+    }
+
+    auto docs = terms->postings(features);
+    auto* impact = irs::get_mutable<irs::impact>(docs.get());
+    ASSERT_NE(nullptr, impact);
+    ASSERT_FALSE(impact->prepared());
+    ASSERT_EQ(max_freq, impact->max_freq());
+
+    if (postings.size() <= 128) {
+      ASSERT_TRUE(irs::doc_limits::eof(impact->shallow_seek(irs::doc_limits::min())));
+      ASSERT_EQ(max_freq, impact->block_max_freq());
+      continue;
+    }
+
+    // interleave shallow seeks and seeks, block bounds must hold for
+    // every document within a block
+    auto* freq = irs::get<irs::frequency>(*docs);
+    ASSERT_NE(nullptr, freq);
+    size_t step = 1;
+    for (size_t i = 0; i < postings.size(); i += step, step = 1 + (step * 7) % 97) {
+      const auto target = postings[i].first;
+      const auto block_end = impact->shallow_seek(target);
+      ASSERT_LE(target, block_end);
+      ASSERT_LE(impact->block_max_freq(), max_freq);
+
+      for (size_t j = i; j < postings.size() && postings[j].first <= block_end; ++j) {
+        ASSERT_LE(postings[j].second, impact->block_max_freq());
+      }
+
+      if (i % 2) {
+        ASSERT_EQ(target, docs->seek(target));
+        ASSERT_EQ(postings[i].second, freq->value);
+      }
+    }
+
+    ++checked_terms;
+  }
+
+  ASSERT_LT(0, checked_terms);
+}
+
+TEST_P(format_15_test_case, postings_impact_no_freq) {
+  tests::json_doc_generator gen(
+    resource("simple_sequential.json"),
+    &tests::generic_json_field_factory);
+  add_segment(gen);
+
+  auto reader = irs::directory_reader::open(dir(), codec());
+  ASSERT_EQ(1, reader.size());
+  auto& segment = reader[0];
+
+  // numeric fields have no frequencies, thus no impacts
+  auto* field = segment.field("seq");
+  ASSERT_NE(nullptr, field);
+  ASSERT_FALSE(field->meta().features.check<irs::frequency>());
+  auto terms = field->iterator();
+  ASSERT_TRUE(terms->next());
+  auto docs = terms->postings(irs::flags{ irs::type<irs::frequency>::get() });
+  ASSERT_EQ(nullptr, irs::get<irs::impact>(*docs));
+}
+
+// Separate definition as MSVC parser fails to do conditional defines in macro expansion
+#if defined(IRESEARCH_SSE2)
+const auto format_15_test_case_values = ::testing::Values(tests::format_info{"1_5", "1_0"},
+                                                          tests::format_info{"1_5simd", "1_0"});
+#else
+const auto format_15_test_case_values = ::testing::Values(tests::format_info{"1_5", "1_0"});
+#endif
+
+INSTANTIATE_TEST_CASE_P(
+  format_15_test,
+  format_15_test_case,
+  ::testing::Combine(
+    ::testing::Values(
+      &tests::memory_directory,
+      &tests::fs_directory,
+      &tests::mmap_directory
+    ),
+    format_15_test_case_values
+  ),
+  tests::to_string
+);
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                     generic tests
+// -----------------------------------------------------------------------------
+
+using tests::format_test_case;
+
+INSTANTIATE_TEST_CASE_P(
+  format_15_test,
+  format_test_case,
+  ::testing::Combine(
+    ::testing::Values(
+      &tests::rot13_cipher_directory<&tests::memory_directory, 16>,
+      &tests::rot13_cipher_directory<&tests::fs_directory, 16>,
+      &tests::rot13_cipher_directory<&tests::mmap_directory, 16>
+    ),
+    format_15_test_case_values
+  ),
+  tests::to_string
+);
+
+}
@@ -0,0 +1,717 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tests_shared.hpp"
+#include "formats_test_case_base.hpp"
+#include "analysis/analyzers.hpp"
+#include "index/comparer.hpp"
+#include "search/point_range_filter.hpp"
+#include "search/term_filter.hpp"
+#include "utils/bkd_tree.hpp"
+#include "utils/bloom_filter.hpp"
+#include "utils/index_utils.hpp"
+
+namespace {
+
+//////////////////////////////////////////////////////////////////////////////
+/// @class text_norm_field
+/// @brief whitespace delimited field with frequencies, positions and norms
+//////////////////////////////////////////////////////////////////////////////
+class text_norm_field final : public tests::field_base {
+ public:
+  explicit text_norm_field(const irs::string_ref& name)
+    : stream_(irs::analysis::analyzers::get(
+        "delimiter", irs::type<irs::text_format::text>::get(), " ")) {
+    this->name(name);
+  }
+
+  void value(const std::string& value) { value_ = value; }
+
+  virtual const irs::flags& features() const override {
+    static const irs::flags features{
+      irs::type<irs::frequency>::get(), irs::type<irs::position>::get(),
+      irs::type<irs::norm>::get()
+    };
+    return features;
+  }
+
+  virtual irs::token_stream& get_tokens() const override {
+    stream_->reset(value_);
+    return *stream_;
+  }
+
+  virtual bool write(irs::data_output&) const override {
+    return false;
+  }
+
+ private:
+  irs::analysis::analyzer::ptr stream_;
+  std::string value_;
+}; // text_norm_field
+
+//////////////////////////////////////////////////////////////////////////////
+/// @class norm_doc_template
+/// @brief document template for europarl.subset.text, 'body' field has norms,
+///        documents are sorted by 'id' if a comparator is specified
+//////////////////////////////////////////////////////////////////////////////
+class norm_doc_template final : public tests::delim_doc_generator::doc_template {
+ public:
+  explicit norm_doc_template(bool sort) noexcept
+    : sort_(sort) {
+  }
+
+  virtual void init() override {
+    clear();
+    indexed.push_back(std::make_shared<text_norm_field>("body"));
+    if (sort_) {
+      sorted = std::make_shared<tests::templates::string_field>("id");
+    }
+  }
+
+  virtual void value(size_t idx, const std::string& value) override {
+    if (2 == idx) { // body
+      indexed.get<text_norm_field>("body")->value(value);
+      bodies_.emplace_back(value);
+    }
+  }
+
+  virtual void end() override {
+    if (sorted) {
+      static_cast<tests::templates::string_field&>(*sorted).value(
+        std::to_string(bodies_.size() - 1));
+    }
+  }
+
+  // field values in order of generation
+  const std::vector<std::string>& bodies() const noexcept {
+    return bodies_;
+  }
+
+ private:
+  std::vector<std::string> bodies_;
+  bool sort_;
+}; // norm_doc_template
+
+struct reverse_comparer final : irs::comparer {
+  virtual bool less(const irs::bytes_ref& lhs, const irs::bytes_ref& rhs) const override {
+    return lhs > rhs;
+  }
+};
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                          format 16 specific tests
+// -----------------------------------------------------------------------------
+
+//////////////////////////////////////////////////////////////////////////////
+/// @class point_field
+/// @brief field with a single point per document indexed into a bkd tree
+//////////////////////////////////////////////////////////////////////////////
+class point_field final : public tests::field_base {
+ public:
+  explicit point_field(const irs::string_ref& name) {
+    this->name(name);
+  }
+
+  void value(std::initializer_list<int64_t> dims) {
+    value_ = encode(dims);
+  }
+
+  static irs::bstring encode(std::initializer_list<int64_t> dims) {
+    irs::bstring value(dims.size()*irs::bkd_tree::BYTES_PER_DIM, 0);
+    auto* out = &value[0];
+    for (auto dim : dims) {
+      irs::bkd_tree::encode(dim, out);
+      out += irs::bkd_tree::BYTES_PER_DIM;
+    }
+    return value;
+  }
+
+  virtual const irs::flags& features() const override {
+    static const irs::flags features{ irs::type<irs::bkd_tree>::get() };
+    return features;
+  }
+
+  virtual irs::token_stream& get_tokens() const override {
+    stream_.reset(irs::bytes_ref(value_));
+    return stream_;
+  }
+
+  virtual bool write(irs::data_output&) const override {
+    return false;
+  }
+
+ private:
+  irs::bstring value_;
+  mutable irs::string_token_stream stream_;
+}; // point_field
+
+class format_16_test_case : public tests::index_test_base {
+ protected:
+  std::vector<std::string> add_documents(
+      size_t count,
+      irs::OpenMode mode = irs::OM_CREATE,
+      const irs::index_writer::init_options& opts = {}) {
+    norm_doc_template doc(nullptr != opts.comparator);
+    tests::delim_doc_generator gen(resource("europarl.subset.txt"), doc);
+    tests::limiting_doc_generator limiting_gen(gen, 0, count);
+    add_segment(limiting_gen, mode, opts);
+    return doc.bodies();
+  }
+
+  // inline norms must match the ones stored in 'norm' column
+  // or the ones evaluated by the specified function
+  void assert_norms(
+      const irs::sub_reader& segment,
+      const std::function<irs::byte_type(irs::doc_id_t)>& expected = {}) {
+    const irs::flags features{
+      irs::type<irs::frequency>::get(), irs::type<irs::norm>::get()
+    };
+
+    auto* field = segment.field("body");
+    ASSERT_NE(nullptr, field);
+    ASSERT_TRUE(field->meta().features.check<irs::norm>());
+
+    size_t checked_docs = 0;
+
+    for (auto terms = field->iterator(); terms->next(); ) {
+      // norms are not requested
+      {
+        auto docs = terms->postings(irs::flags{ irs::type<irs::frequency>::get() });
+        ASSERT_EQ(nullptr, irs::get<irs::quantized_norm>(*docs));
+      }
+
+      auto docs = terms->postings(features);
+      auto* doc = irs::get<irs::document>(*docs);
+      ASSERT_NE(nullptr, doc);
+      auto* quantized_norm = irs::get<irs::quantized_norm>(*docs);
+      ASSERT_NE(nullptr, quantized_norm);
+
+      irs::norm norm;
+      ASSERT_TRUE(norm.reset(segment, field->meta().norm, *doc));
+
+      while (docs->next()) {
+        if (expected) {
+          ASSERT_EQ(expected(docs->value()), quantized_norm->value);
+        } else {
+          ASSERT_EQ(irs::quantized_norm::encode(norm.read()), quantized_norm->value);
+          ASSERT_LE(norm.read(), quantized_norm->read());
+        }
+        ++checked_docs;
+      }
+
+      // seek to the last document
+      if (irs::doc_limits::valid(docs->value())) {
+        docs = terms->postings(features);
+        quantized_norm = irs::get<irs::quantized_norm>(*docs);
+        ASSERT_NE(nullptr, quantized_norm);
+        doc = irs::get<irs::document>(*docs);
+        ASSERT_TRUE(norm.reset(segment, field->meta().norm, *doc));
+
+        irs::doc_id_t last = irs::doc_limits::invalid();
+        for (auto copy = terms->postings(irs::flags::empty_instance()); copy->next(); ) {
+          last = copy->value();
+        }
+
+        ASSERT_EQ(last, docs->seek(last));
+        ASSERT_EQ(expected ? expected(last) : irs::quantized_norm::encode(norm.read()),
+                  quantized_norm->value);
+      }
+    }
+
+    ASSERT_LT(0, checked_docs);
+  }
+};
+
+TEST_P(format_16_test_case, postings_norms) {
+  add_documents(1024);
+
+  auto reader = irs::directory_reader::open(dir(), codec());
+  ASSERT_EQ(1, reader.size());
+  assert_norms(reader[0]);
+}
+
+TEST_P(format_16_test_case, postings_norms_cached) {
+  add_documents(1024);
+
+  auto uncached = irs::directory_reader::open(dir(), codec());
+  ASSERT_EQ(1, uncached.size());
+  auto* field = uncached[0].field("body");
+  ASSERT_NE(nullptr, field);
+  const auto column = field->meta().norm;
+  ASSERT_EQ(nullptr, uncached[0].norms(column));
+  const size_t size = irs::doc_limits::min() + uncached[0].docs_count();
+
+  // memory limit is too low
+  {
+    auto& cache = dir().attributes().emplace<irs::norm_cache>(size - 1);
+    ASSERT_NE(nullptr, cache);
+
+    auto reader = irs::directory_reader::open(dir(), codec());
+    ASSERT_EQ(1, reader.size());
+    ASSERT_EQ(nullptr, reader[0].norms(column));
+    ASSERT_EQ(0, cache->memory());
+
+    // fallback to the column
+    irs::document doc;
+    irs::norm norm;
+    ASSERT_TRUE(norm.reset(reader[0], column, doc));
+    doc.value = irs::doc_limits::min();
+    ASSERT_LT(0.f, norm.read());
+    ASSERT_TRUE(dir().attributes().remove<irs::norm_cache>());
+  }
+
+  auto cache = dir().attributes().emplace<irs::norm_cache>(size);
+  ASSERT_NE(nullptr, cache);
+
+  {
+    auto reader = irs::directory_reader::open(dir(), codec());
+    ASSERT_EQ(1, reader.size());
+    auto& segment = reader[0];
+
+    // norms are materialized on first use only
+    const auto* norms = segment.norms(column);
+    ASSERT_NE(nullptr, norms);
+    ASSERT_EQ(size, cache->memory());
+    ASSERT_EQ(norms, segment.norms(column));
+    ASSERT_EQ(size, cache->memory());
+
+    // non-existent column isn't cached
+    ASSERT_EQ(nullptr, segment.norms(irs::field_limits::invalid()));
+    ASSERT_EQ(size, cache->memory());
+
+    // cached norms match the ones stored in the column
+    irs::document doc;
+    irs::norm cached_norm;
+    ASSERT_TRUE(cached_norm.reset(segment, column, doc));
+    irs::norm column_norm;
+    ASSERT_TRUE(column_norm.reset(uncached[0], column, doc));
+
+    for (doc.value = irs::doc_limits::min(); doc.value < size; ++doc.value) {
+      ASSERT_EQ(irs::quantized_norm::encode(column_norm.read()), norms[doc.value]);
+      ASSERT_EQ(norms[doc.value], cached_norm.read_quantized());
+      ASSERT_EQ(irs::quantized_norm::decode(norms[doc.value]), cached_norm.read());
+      ASSERT_LE(column_norm.read(), cached_norm.read());
+    }
+
+    ASSERT_TRUE(dir().attributes().remove<irs::norm_cache>());
+  }
+
+  // memory is returned along with the reader
+  ASSERT_EQ(0, cache->memory());
+}
+
+TEST_P(format_16_test_case, postings_block) {
+  add_documents(1024);
+
+  auto reader = irs::directory_reader::open(dir(), codec());
+  ASSERT_EQ(1, reader.size());
+  auto& segment = reader[0];
+  auto* field = segment.field("body");
+  ASSERT_NE(nullptr, field);
+
+  const irs::flags features{
+    irs::type<irs::frequency>::get(), irs::type<irs::norm>::get()
+  };
+
+  size_t fetched_docs = 0;
+
+  for (auto terms = field->iterator(); terms->next(); ) {
+    // positions are skipped document by document
+    {
+      auto docs = terms->postings(irs::flags{
+        irs::type<irs::frequency>::get(), irs::type<irs::position>::get() });
+      ASSERT_EQ(nullptr, irs::postings_block::get(*docs));
+    }
+
+    std::vector<std::tuple<irs::doc_id_t, uint32_t, irs::byte_type>> expected;
+    {
+      auto docs = terms->postings(features);
+      auto* freq = irs::get<irs::frequency>(*docs);
+      ASSERT_NE(nullptr, freq);
+      auto* norm = irs::get<irs::quantized_norm>(*docs);
+      ASSERT_NE(nullptr, norm);
+      while (docs->next()) {
+        expected.emplace_back(docs->value(), freq->value, norm->value);
+      }
+    }
+    ASSERT_FALSE(expected.empty());
+
+    // fetch blocks after every other document, position each iterator
+    // by 'next' or 'seek' in between
+    for (bool use_seek : { false, true }) {
+      auto docs = terms->postings(features);
+      auto* block = irs::postings_block::get(*docs);
+      ASSERT_NE(nullptr, block);
+      auto* freq = irs::get<irs::frequency>(*docs);
+      ASSERT_NE(nullptr, freq);
+      auto* norm = irs::get<irs::quantized_norm>(*docs);
+      ASSERT_NE(nullptr, norm);
+
+      auto it = expected.begin();
+      while (it != expected.end()) {
+        if (use_seek) {
+          ASSERT_EQ(std::get<0>(*it), docs->seek(std::get<0>(*it)));
+        } else {
+          ASSERT_TRUE(docs->next());
+          ASSERT_EQ(std::get<0>(*it), docs->value());
+        }
+        ASSERT_EQ(std::get<1>(*it), freq->value);
+        ASSERT_EQ(std::get<2>(*it), norm->value);
+        ++it;
+
+        const size_t count = block->fetch();
+        ASSERT_EQ(it == expected.end(), 0 == count);
+        for (size_t i = 0; i < count; ++i, ++it) {
+          ASSERT_NE(expected.end(), it);
+          ASSERT_EQ(std::get<0>(*it), block->docs[i]);
+          ASSERT_EQ(std::get<1>(*it), block->freqs[i]);
+          ASSERT_EQ(std::get<2>(*it), block->norms[i]);
+        }
+        fetched_docs += count;
+
+        // iterator is positioned at the last fetched document
+        if (count) {
+          ASSERT_EQ(block->docs[count - 1], docs->value());
+          ASSERT_EQ(block->freqs[count - 1], freq->value);
+          ASSERT_EQ(block->norms[count - 1], norm->value);
+        }
+      }
+
+      ASSERT_FALSE(docs->next());
+      ASSERT_TRUE(irs::doc_limits::eof(docs->value()));
+      ASSERT_EQ(0, block->fetch());
+    }
+  }
+
+  ASSERT_LT(0, fetched_docs);
+}
+
+TEST_P(format_16_test_case, postings_norms_sorted) {
+  reverse_comparer less;
+  irs::index_writer::init_options opts;
+  opts.comparator = &less;
+  const auto bodies = add_documents(1024, irs::OM_CREATE, opts);
+
+  auto reader = irs::directory_reader::open(dir(), codec());
+  ASSERT_EQ(1, reader.size());
+  auto& segment = reader[0];
+  auto* sort = segment.sort();
+  ASSERT_NE(nullptr, sort);
+  auto values = sort->values();
+
+  // evaluate expected norms from the field value, 'norm' column
+  // isn't remapped according to the segment sort order
+  text_norm_field field("body");
+  assert_norms(segment, [&](irs::doc_id_t doc) {
+    irs::bytes_ref value;
+    EXPECT_TRUE(values(doc, value));
+    irs::bytes_ref_input in(value);
+    const auto id = std::stoul(irs::read_string<std::string>(in));
+    EXPECT_LT(id, bodies.size());
+    field.value(bodies[id]);
+
+    uint32_t num_terms = 0;
+    for (auto& tokens = field.get_tokens(); tokens.next(); ) {
+      ++num_terms;
+    }
+
+    return irs::quantized_norm::encode(num_terms);
+  });
+}
+
+TEST_P(format_16_test_case, postings_norms_consolidate_legacy) {
+  // segment without inline norms
+  {
+    auto legacy_codec = irs::formats::get("1_5");
+    ASSERT_NE(nullptr, legacy_codec);
+
+    norm_doc_template doc(false);
+    tests::delim_doc_generator gen(resource("europarl.subset.txt"), doc);
+    tests::limiting_doc_generator limiting_gen(gen, 0, 512);
+    auto writer = irs::index_writer::make(dir(), legacy_codec, irs::OM_CREATE);
+    add_segment(*writer, limiting_gen);
+  }
+
+  add_documents(512, irs::OM_APPEND);
+
+  auto writer = open_writer(irs::OM_APPEND);
+  ASSERT_TRUE(writer->consolidate(irs::index_utils::consolidation_policy(
+    irs::index_utils::consolidate_count())));
+  writer->commit();
+
+  auto reader = irs::directory_reader::open(dir(), codec());
+  ASSERT_EQ(1, reader.size());
+  assert_norms(reader[0]);
+}
+
+TEST_P(format_16_test_case, terms_bloom_filter) {
+  const irs::flags bloom_features{ irs::type<irs::bloom_filter>::get() };
+
+  // only 'name' field requests a bloom filter
+  tests::json_doc_generator gen(
+    resource("simple_sequential.json"),
+    [&bloom_features](tests::document& doc,
+                      const std::string& name,
+                      const tests::json_doc_generator::json_value& data) {
+    if (data.is_string()) {
+      doc.insert(std::make_shared<tests::templates::string_field>(
+        irs::string_ref(name), data.str,
+        "name" == name ? bloom_features : irs::flags::empty_instance()));
+    }
+  });
+
+  add_segment(gen);
+
+  // segment without bloom filters
+  {
+    auto legacy_codec = irs::formats::get("1_5");
+    ASSERT_NE(nullptr, legacy_codec);
+
+    gen.reset();
+    auto writer = irs::index_writer::make(dir(), legacy_codec, irs::OM_APPEND);
+    add_segment(*writer, gen);
+  }
+
+  auto reader = irs::directory_reader::open(dir(), codec());
+  ASSERT_EQ(2, reader.size());
+
+  auto count_docs = [&reader](const irs::string_ref& term) {
+    irs::by_term filter;
+    *filter.mutable_field() = "name";
+    filter.mutable_options()->term = irs::ref_cast<irs::byte_type>(term);
+
+    size_t count = 0;
+    auto prepared = filter.prepare(reader);
+    for (auto& segment : reader) {
+      for (auto docs = prepared->execute(segment); docs->next(); ) {
+        ++count;
+      }
+    }
+    return count;
+  };
+
+  // every term of the field passes the filter
+  {
+    auto& segment = reader[0];
+    ASSERT_EQ(nullptr, irs::get<irs::bloom_filter>(*segment.field("same")));
+    auto* field = segment.field("name");
+    ASSERT_NE(nullptr, field);
+    ASSERT_TRUE(field->meta().features.check<irs::bloom_filter>());
+    auto* bloom = irs::get<irs::bloom_filter>(*field);
+    ASSERT_NE(nullptr, bloom);
+    ASSERT_FALSE(bloom->empty());
+
+    size_t count = 0;
+    for (auto terms = field->iterator(); terms->next(); ++count) {
+      ASSERT_TRUE(bloom->contains(terms->value()));
+      auto it = field->iterator();
+      ASSERT_TRUE(it->seek(terms->value()));
+      ASSERT_EQ(terms->value(), it->value());
+      ASSERT_EQ(2, count_docs(irs::ref_cast<char>(terms->value())));
+    }
+    ASSERT_EQ(field->size(), count);
+
+    // absent terms are mostly rejected by the filter
+    size_t false_positives = 0;
+    for (size_t i = 0; i < 1000; ++i) {
+      const auto term = "absent" + std::to_string(i);
+      false_positives += bloom->contains(irs::ref_cast<irs::byte_type>(irs::string_ref(term)));
+      ASSERT_FALSE(field->iterator()->seek(irs::ref_cast<irs::byte_type>(irs::string_ref(term))));
+      ASSERT_EQ(0, count_docs(term));
+    }
+    ASSERT_GT(50, false_positives);
+  }
+
+  // legacy segment doesn't expose a bloom filter
+  {
+    auto& segment = reader[1];
+    auto* field = segment.field("name");
+    ASSERT_NE(nullptr, field);
+    ASSERT_TRUE(field->meta().features.check<irs::bloom_filter>());
+    ASSERT_EQ(nullptr, irs::get<irs::bloom_filter>(*field));
+    ASSERT_TRUE(field->iterator()->seek(irs::ref_cast<irs::byte_type>(irs::string_ref("A"))));
+  }
+}
+
+TEST_P(format_16_test_case, points_range) {
+  constexpr size_t DOCS_PER_SEGMENT = 3000; // several leaves per tree
+
+  auto make_x = [](size_t i) { return int64_t(i % 97) - 50; };
+  auto make_y = [](size_t i) { return int64_t((i*31) % 1000); };
+
+  auto writer = open_writer();
+
+  // two segments to exercise merging of trees
+  for (size_t base : { size_t(0), DOCS_PER_SEGMENT }) {
+    {
+      point_field ts("ts");
+      point_field xy("xy");
+      auto ctx = writer->documents();
+
+      for (size_t i = base; i < base + DOCS_PER_SEGMENT; ++i) {
+        auto doc = ctx.insert();
+        ts.value({ int64_t(i) });
+        xy.value({ make_x(i), make_y(i) });
+        ASSERT_TRUE(doc.insert<irs::Action::INDEX>(ts));
+        ASSERT_TRUE(doc.insert<irs::Action::INDEX>(xy));
+      }
+    }
+
+    writer->commit();
+  }
+
+  auto count_docs = [](const irs::index_reader& reader,
+                       const irs::string_ref& field,
+                       irs::bstring&& min, irs::bstring&& max) {
+    irs::by_point_range filter;
+    *filter.mutable_field() = field;
+    filter.mutable_options()->min = std::move(min);
+    filter.mutable_options()->max = std::move(max);
+
+    size_t count = 0;
+    auto prepared = filter.prepare(reader);
+    for (auto& segment : reader) {
+      for (auto docs = prepared->execute(segment); docs->next(); ) {
+        ++count;
+      }
+    }
+    return count;
+  };
+
+  auto assert_ranges = [&](const irs::index_reader& reader) {
+    // 1-dimensional ranges
+    ASSERT_EQ(0, count_docs(reader, "ts", point_field::encode({ -10 }), point_field::encode({ -1 })));
+    ASSERT_EQ(1, count_docs(reader, "ts", point_field::encode({ 0 }), point_field::encode({ 0 })));
+    ASSERT_EQ(1000, count_docs(reader, "ts", point_field::encode({ 2500 }), point_field::encode({ 3499 })));
+    ASSERT_EQ(2*DOCS_PER_SEGMENT, count_docs(
+      reader, "ts", point_field::encode({ INT64_MIN }), point_field::encode({ INT64_MAX })));
+
+    // 2-dimensional ranges
+    const std::pair<irs::bstring, irs::bstring> boxes[] {
+      { point_field::encode({ -50, 0 }), point_field::encode({ 46, 999 }) },
+      { point_field::encode({ -5, 100 }), point_field::encode({ 5, 200 }) },
+      { point_field::encode({ 0, 0 }), point_field::encode({ 0, 999 }) },
+      { point_field::encode({ 10, 500 }), point_field::encode({ 5, 600 }) }, // empty
+      { point_field::encode({ 100, 0 }), point_field::encode({ 200, 999 }) } // outside
+    };
+    const std::pair<int64_t, int64_t> bounds[][2] {
+      { { -50, 0 }, { 46, 999 } },
+      { { -5, 100 }, { 5, 200 } },
+      { { 0, 0 }, { 0, 999 } },
+      { { 10, 500 }, { 5, 600 } },
+      { { 100, 0 }, { 200, 999 } }
+    };
+
+    for (size_t b = 0; b < IRESEARCH_COUNTOF(boxes); ++b) {
+      size_t expected = 0;
+      for (size_t i = 0; i < 2*DOCS_PER_SEGMENT; ++i) {
+        const auto x = make_x(i);
+        const auto y = make_y(i);
+        expected += x >= bounds[b][0].first && x <= bounds[b][1].first
+                 && y >= bounds[b][0].second && y <= bounds[b][1].second;
+      }
+
+      ASSERT_EQ(expected, count_docs(reader, "xy",
+                                     irs::bstring(boxes[b].first),
+                                     irs::bstring(boxes[b].second)));
+    }
+
+    // mismatched number of dimensions matches nothing
+    ASSERT_EQ(0, count_docs(reader, "xy", point_field::encode({ -50 }), point_field::encode({ 46 })));
+  };
+
+  {
+    auto reader = irs::directory_reader::open(dir(), codec());
+    ASSERT_EQ(2, reader.size());
+
+    for (auto& segment : reader) {
+      auto* field = segment.field("xy");
+      ASSERT_NE(nullptr, field);
+      auto* tree = irs::get<irs::bkd_tree>(*field);
+      ASSERT_NE(nullptr, tree);
+      ASSERT_EQ(2, tree->dims());
+      ASSERT_EQ(DOCS_PER_SEGMENT, tree->size());
+    }
+
+    assert_ranges(reader);
+  }
+
+  // merged segment has a tree over the points of both segments
+  ASSERT_TRUE(writer->consolidate(irs::index_utils::consolidation_policy(
+    irs::index_utils::consolidate_count())));
+  writer->commit();
+
+  {
+    auto reader = irs::directory_reader::open(dir(), codec());
+    ASSERT_EQ(1, reader.size());
+    auto* field = reader[0].field("ts");
+    ASSERT_NE(nullptr, field);
+    auto* tree = irs::get<irs::bkd_tree>(*field);
+    ASSERT_NE(nullptr, tree);
+    ASSERT_EQ(1, tree->dims());
+    ASSERT_EQ(2*DOCS_PER_SEGMENT, tree->size());
+
+    assert_ranges(reader);
+  }
+}
+
+// Separate definition as MSVC parser fails to do conditional defines in macro expansion
+#if defined(IRESEARCH_SSE2)
+const auto format_16_test_case_values = ::testing::Values(tests::format_info{"1_6", "1_0"},
+                                                          tests::format_info{"1_6simd", "1_0"});
+#else
+const auto format_16_test_case_values = ::testing::Values(tests::format_info{"1_6", "1_0"});
+#endif
+
+INSTANTIATE_TEST_CASE_P(
+  format_16_test,
+  format_16_test_case,
+  ::testing::Combine(
+    ::testing::Values(
+      &tests::memory_directory,
+      &tests::fs_directory,
+      &tests::mmap_directory
+    ),
+    format_16_test_case_values
+  ),
+  tests::to_string
+);
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                     generic tests
+// -----------------------------------------------------------------------------
+
+using tests::format_test_case;
+
+INSTANTIATE_TEST_CASE_P(
+  format_16_test,
+  format_test_case,
+  ::testing::Combine(
+    ::testing::Values(
+      &tests::rot13_cipher_directory<&tests::memory_directory, 16>,
+      &tests::rot13_cipher_directory<&tests::fs_directory, 16>,
+      &tests::rot13_cipher_directory<&tests::mmap_directory, 16>
+    ),
+    format_16_test_case_values
+  ),
+  tests::to_string
+);
+
+}
@@ -22,6 +22,9 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "formats_test_case_base.hpp"
+
+#include <thread>
+
 #include "utils/lz4compression.hpp"
 
 namespace tests {
@@ -456,6 +459,54 @@ TEST_P(format_test_case, fields_seek_ge) {
   }
 }
 
+TEST_P(format_test_case, fields_read_concurrent) {
+  // add segment
+  {
+    tests::json_doc_generator gen(
+      resource("simple_sequential.json"),
+      &tests::generic_json_field_factory);
+    add_segment(gen);
+  }
+
+  auto reader = open_reader();
+  ASSERT_EQ(1, reader->size());
+  auto& segment = reader[0];
+
+  // term dictionaries may be read on the first access from many threads
+  const std::vector<std::string> names{ "name", "same", "duplicated", "prefix" };
+  std::vector<size_t> terms_count(2*names.size(), 0);
+  std::vector<std::thread> threads;
+  std::atomic<bool> start{false};
+
+  for (size_t i = 0; i < terms_count.size(); ++i) {
+    threads.emplace_back([&, i]() {
+      while (!start) {
+        std::this_thread::yield();
+      }
+
+      auto* field = segment.field(names[i % names.size()]);
+
+      if (field) {
+        for (auto it = field->iterator(); it->next(); ) {
+          ++terms_count[i];
+        }
+      }
+    });
+  }
+
+  start = true;
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (size_t i = 0; i < terms_count.size(); ++i) {
+    auto* field = segment.field(names[i % names.size()]);
+    ASSERT_NE(nullptr, field);
+    ASSERT_EQ(field->size(), terms_count[i]);
+  }
+}
+
 TEST_P(format_test_case, fields_read_write) {
   /*
     Term dictionary structure:
@@ -1077,6 +1128,137 @@ TEST_P(format_test_case, columns_rw_sparse_column_dense_block) {
   }
 }
 
+TEST_P(format_test_case, columns_rw_block_cache) {
+  irs::segment_meta seg("_1", codec());
+
+  size_t column_id;
+
+  // write docs
+  {
+    auto writer = codec()->get_columnstore_writer();
+    writer->prepare(dir(), seg);
+    auto column = writer->push_column({
+      irs::type<irs::compression::lz4>::get(),
+      irs::compression::options(),
+      bool(irs::get_encryption(dir().attributes()))
+    });
+    column_id = column.first;
+    auto& column_handler = column.second;
+
+    for (auto id = irs::doc_limits::min(); id <= 10000; ++id, ++seg.docs_count) {
+      auto& stream = column_handler(id);
+      irs::write_string(stream, std::to_string(id));
+    }
+
+    ASSERT_TRUE(writer->commit());
+  }
+
+  const auto read_all = [this, &seg, &column_id]() {
+    auto reader = codec()->get_columnstore_reader();
+    ASSERT_TRUE(reader->prepare(dir(), seg));
+
+    auto column = reader->column(column_id);
+    ASSERT_NE(nullptr, column);
+
+    // read values twice to hit cached blocks
+    for (size_t i = 0; i < 2; ++i) {
+      auto values = column->values();
+      irs::bytes_ref actual_value;
+
+      for (irs::doc_id_t id = irs::doc_limits::min(); id <= seg.docs_count; ++id) {
+        ASSERT_TRUE(values(id, actual_value));
+        irs::bytes_ref_input in(actual_value);
+        ASSERT_EQ(std::to_string(id), irs::read_string<std::string>(in));
+      }
+    }
+
+    // iterate over evicted and cached blocks
+    auto it = column->iterator();
+    auto* payload = irs::get<irs::payload>(*it);
+    ASSERT_NE(nullptr, payload);
+
+    irs::doc_id_t expected = irs::doc_limits::min();
+    for (; it->next(); ++expected) {
+      ASSERT_EQ(expected, it->value());
+      irs::bytes_ref_input in(payload->value);
+      ASSERT_EQ(std::to_string(expected), irs::read_string<std::string>(in));
+    }
+    ASSERT_EQ(seg.docs_count + 1, expected);
+  };
+
+  // small cache evicting blocks
+  {
+    auto& cache = dir().attributes().emplace<irs::column_cache>(0); // disabled
+    ASSERT_NE(nullptr, cache);
+    read_all();
+    ASSERT_EQ(0, cache->hits() + cache->misses());
+
+    cache->max_memory(1 << 15);
+    read_all();
+    ASSERT_LT(0, cache->misses());
+    ASSERT_LE(cache->memory(), cache->max_memory());
+
+    // reader is gone, its blocks are evicted
+    ASSERT_EQ(0, cache->memory());
+    ASSERT_TRUE(dir().attributes().remove<irs::column_cache>());
+  }
+
+  // cache fits all blocks
+  {
+    auto& cache = dir().attributes().emplace<irs::column_cache>(1 << 24);
+    ASSERT_NE(nullptr, cache);
+    read_all();
+    ASSERT_LT(0, cache->misses());
+    ASSERT_LT(cache->misses(), cache->hits());
+    ASSERT_EQ(0, cache->memory());
+    ASSERT_TRUE(dir().attributes().remove<irs::column_cache>());
+  }
+}
+
+TEST(column_cache_test, remove_owner) {
+  irs::column_cache cache(1 << 10);
+  const auto owner0 = cache.register_owner();
+  const auto owner1 = cache.register_owner();
+  ASSERT_NE(owner0, owner1);
+
+  auto make_block = []() { return std::make_shared<int>(42); };
+
+  cache.put(owner0, 0, make_block(), 100);
+  cache.put(owner0, 10, make_block(), 100);
+  cache.put(owner1, 0, make_block(), 100);
+  ASSERT_EQ(300, cache.memory());
+
+  // blocks are distinguished by owner
+  auto block = cache.get(owner1, 0);
+  ASSERT_NE(nullptr, block);
+  ASSERT_NE(block, cache.get(owner0, 0));
+  ASSERT_EQ(nullptr, cache.get(owner1, 10));
+  ASSERT_EQ(2, cache.hits());
+  ASSERT_EQ(1, cache.misses());
+
+  cache.remove(owner0);
+  ASSERT_EQ(100, cache.memory());
+  ASSERT_EQ(nullptr, cache.get(owner0, 0));
+  ASSERT_EQ(nullptr, cache.get(owner0, 10));
+  ASSERT_EQ(block, cache.get(owner1, 0));
+
+  cache.remove(owner0); // nothing to remove
+  ASSERT_EQ(100, cache.memory());
+
+  // least recently used block of the only owner is evicted
+  cache.max_memory(50);
+  ASSERT_EQ(0, cache.memory());
+  ASSERT_EQ(nullptr, cache.get(owner1, 0));
+  ASSERT_EQ(42, *static_cast<const int*>(block.get())); // pinned block stays valid
+}
+
+TEST(column_cache_test, global) {
+  auto cache = irs::column_cache::global_ptr();
+  ASSERT_NE(nullptr, cache);
+  ASSERT_EQ(cache.get(), &irs::column_cache::global());
+  ASSERT_EQ(0, cache->max_memory());
+}
+
 TEST_P(format_test_case, columns_rw_dense_mask) {
   irs::segment_meta seg("_1", codec());
   const irs::doc_id_t MAX_DOC = 1026;
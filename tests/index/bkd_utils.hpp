@@ -0,0 +1,57 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IRESEARCH_BKD_UTILS_H
+#define IRESEARCH_BKD_UTILS_H
+
+#include <initializer_list>
+
+#include "utils/bkd_tree.hpp"
+#include "utils/string.hpp"
+
+namespace tests {
+
+//////////////////////////////////////////////////////////////////////////////
+/// @returns point of the specified coordinates encoded as expected by
+///          'irs::bkd_tree', i.e. comparable bytewise
+//////////////////////////////////////////////////////////////////////////////
+inline irs::bstring encode_point(std::initializer_list<int64_t> dims) {
+  irs::bstring out(dims.size()*irs::bkd_tree::BYTES_PER_DIM, 0);
+  auto* dim = &out[0];
+
+  for (auto value : dims) {
+    irs::bkd_tree::encode(value, dim);
+    dim += irs::bkd_tree::BYTES_PER_DIM;
+  }
+
+  return out;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+/// @returns 1-dimensional point encoded as expected by 'irs::bkd_tree'
+//////////////////////////////////////////////////////////////////////////////
+inline irs::bstring encode_point(int64_t value) {
+  return encode_point({ value });
+}
+
+}
+
+#endif // IRESEARCH_BKD_UTILS_H
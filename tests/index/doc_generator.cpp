@@ -211,6 +211,20 @@ bool binary_field::write(irs::data_output& out) const {
   return true;
 }
 
+namespace templates {
+
+irs::token_stream& bytes_field::get_tokens() const {
+  stream_.reset(irs::bytes_ref(value_));
+  return stream_;
+}
+
+bool bytes_field::write(irs::data_output& out) const {
+  out.write_bytes(value_.c_str(), value_.size());
+  return true;
+}
+
+} // templates
+
 // -----------------------------------------------------------------------------
 // --SECTION--                                           particle implementation
 // -----------------------------------------------------------------------------
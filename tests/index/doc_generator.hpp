@@ -197,6 +197,31 @@ class binary_field: public field_base {
   irs::bstring value_;
 }; // binary_field
 
+namespace templates {
+
+//////////////////////////////////////////////////////////////////////////////
+/// @class bytes_field
+/// @brief provides capabilities for storing & indexing binary values, unlike
+///        'binary_field' stores a raw value, i.e. without a length prefix
+//////////////////////////////////////////////////////////////////////////////
+class bytes_field: public field_base {
+ public:
+  explicit bytes_field(const irs::string_ref& name) {
+    this->name(name);
+  }
+
+  irs::token_stream& get_tokens() const override;
+  const irs::bstring& value() const { return value_; }
+  void value(irs::bstring&& value) { value_ = std::move(value); }
+  bool write(irs::data_output& out) const override;
+
+ private:
+  mutable irs::string_token_stream stream_;
+  irs::bstring value_;
+}; // bytes_field
+
+} // templates
+
 /* -------------------------------------------------------------------
 * document 
 * ------------------------------------------------------------------*/
@@ -27,6 +27,8 @@
 
 #include "tests_shared.hpp" 
 #include "iql/query_builder.hpp"
+#include "search/all_filter.hpp"
+#include "search/term_filter.hpp"
 #include "store/memory_directory.hpp"
 #include "utils/index_utils.hpp"
 #include "utils/lz4compression.hpp"
@@ -13417,6 +13419,475 @@ TEST_P(index_test_case, segment_options) {
   }
 }
 
+TEST_P(index_test_case, segment_options_memory_max) {
+  tests::json_doc_generator gen(
+    resource("simple_sequential.json"),
+    [] (tests::document& doc, const std::string& name, const tests::json_doc_generator::json_value& data) {
+    if (data.is_string()) {
+      doc.insert(std::make_shared<tests::templates::string_field>(
+        irs::string_ref(name),
+        data.str
+      ));
+    }
+  });
+
+  std::vector<const tests::document*> docs;
+  for (const tests::document* doc; (doc = gen.next()); ) {
+    docs.emplace_back(doc);
+  }
+  ASSERT_LT(8, docs.size());
+
+  auto insert_docs = [](irs::index_writer& writer, const std::vector<const tests::document*>& docs) {
+    for (auto* doc : docs) {
+      ASSERT_TRUE(insert(writer,
+        doc->indexed.begin(), doc->indexed.end(),
+        doc->stored.begin(), doc->stored.end()
+      ));
+    }
+  };
+
+  auto shared_memory = std::make_shared<irs::index_writer::memory_accounting>();
+
+  // memory of a large idle segment is accounted but never exceeds the limit
+  irs::index_writer::init_options opts;
+  opts.memory_max = irs::integer_traits<size_t>::const_max;
+  opts.shared_memory = shared_memory;
+  auto writer = open_writer(irs::OM_CREATE, opts);
+  for (size_t i = 0; i < 16; ++i) {
+    insert_docs(*writer, docs);
+  }
+
+  const size_t memory = shared_memory->memory.load();
+  ASSERT_LT(0, memory);
+  ASSERT_EQ(1, shared_memory->segments.load());
+
+  const std::vector<const tests::document*> few_docs(docs.begin(), docs.begin() + 3);
+
+  // writer accounting its segments separately stays within the limit
+  {
+    irs::index_writer::init_options options;
+    options.memory_max = memory / 2;
+
+    irs::memory_directory dir;
+    auto writer = irs::index_writer::make(dir, codec(), irs::OM_CREATE, options);
+    insert_docs(*writer, few_docs);
+    writer->commit();
+
+    auto reader = irs::directory_reader::open(dir, codec());
+    ASSERT_EQ(1, reader.size());
+    ASSERT_EQ(few_docs.size(), reader.docs_count());
+    ASSERT_EQ(memory, shared_memory->memory.load());
+  }
+
+  // writer exceeding the limit flushes its segment once it's the largest one,
+  // memory stays bounded without producing a segment per document
+  {
+    auto memory_accounting = std::make_shared<irs::index_writer::memory_accounting>();
+    irs::index_writer::init_options options;
+    options.memory_max = memory / 2;
+    options.shared_memory = memory_accounting;
+
+    irs::memory_directory dir;
+    auto writer = irs::index_writer::make(dir, codec(), irs::OM_CREATE, options);
+    size_t memory_peak = 0;
+    for (size_t i = 0; i < 16; ++i) {
+      insert_docs(*writer, docs);
+      memory_peak = std::max(memory_peak, memory_accounting->memory.load());
+      ASSERT_GE(1, memory_accounting->segments.load());
+    }
+    ASSERT_LT(0, memory_peak);
+    ASSERT_GT(memory, memory_peak);
+    writer->commit();
+    ASSERT_EQ(0, memory_accounting->memory.load());
+
+    auto reader = irs::directory_reader::open(dir, codec());
+    ASSERT_LT(1, reader.size());
+    ASSERT_GT(docs.size(), reader.size());
+    ASSERT_EQ(16*docs.size(), reader.docs_count());
+  }
+
+  // writer sharing the accounting flushes the largest idle segment of another
+  // writer since the total memory of both writers exceeds the limit, while its
+  // own small segment is kept in memory
+  {
+    irs::index_writer::init_options options;
+    options.memory_max = memory / 2;
+    options.shared_memory = shared_memory;
+
+    irs::memory_directory dir;
+    auto writer = irs::index_writer::make(dir, codec(), irs::OM_CREATE, options);
+    insert_docs(*writer, few_docs);
+    ASSERT_GE(options.memory_max, shared_memory->memory.load());
+    writer->commit();
+
+    auto reader = irs::directory_reader::open(dir, codec());
+    ASSERT_EQ(1, reader.size());
+    ASSERT_EQ(few_docs.size(), reader.docs_count());
+    ASSERT_GT(memory, shared_memory->memory.load()); // large idle segment was flushed, memory is released on commit
+  }
+
+  writer->commit();
+  ASSERT_EQ(0, shared_memory->memory.load());
+  ASSERT_EQ(0, shared_memory->segments.load());
+
+  auto reader = irs::directory_reader::open(dir(), codec());
+  ASSERT_EQ(1, reader.size());
+  ASSERT_EQ(16*docs.size(), reader.docs_count());
+}
+
+TEST_P(index_test_case, nrt_reader) {
+  tests::json_doc_generator gen(
+    resource("simple_sequential.json"),
+    [] (tests::document& doc, const std::string& name, const tests::json_doc_generator::json_value& data) {
+    if (data.is_string()) {
+      doc.insert(std::make_shared<tests::templates::string_field>(
+        irs::string_ref(name),
+        data.str
+      ));
+    }
+  });
+
+  tests::document const* doc1 = gen.next();
+  tests::document const* doc2 = gen.next();
+  tests::document const* doc3 = gen.next();
+
+  irs::by_term remove_doc1;
+  *remove_doc1.mutable_field() = "name";
+  remove_doc1.mutable_options()->term = irs::ref_cast<irs::byte_type>(irs::string_ref("A"));
+
+  auto writer = open_writer();
+  writer->commit(); // create empty index
+
+  ASSERT_TRUE(insert(*writer,
+    doc1->indexed.begin(), doc1->indexed.end(),
+    doc1->stored.begin(), doc1->stored.end()
+  ));
+  ASSERT_TRUE(insert(*writer,
+    doc2->indexed.begin(), doc2->indexed.end(),
+    doc2->stored.begin(), doc2->stored.end()
+  ));
+
+  // buffered documents are visible without commit
+  auto reader = writer->reader();
+  ASSERT_EQ(1, reader.size());
+  ASSERT_EQ(2, reader.docs_count());
+  ASSERT_EQ(2, reader.live_docs_count());
+  ASSERT_EQ(0, irs::directory_reader::open(dir(), codec()).docs_count());
+
+  // no changes, the same reader is returned
+  ASSERT_TRUE(reader == writer->reader(reader));
+
+  // removals are visible without commit, unchanged segments are reused
+  writer->documents().remove(remove_doc1);
+  ASSERT_TRUE(insert(*writer,
+    doc3->indexed.begin(), doc3->indexed.end(),
+    doc3->stored.begin(), doc3->stored.end()
+  ));
+  {
+    auto new_reader = writer->reader(reader);
+    ASSERT_FALSE(reader == new_reader);
+    ASSERT_EQ(2, reader.live_docs_count());
+    ASSERT_EQ(2, new_reader.size());
+    ASSERT_EQ(3, new_reader.docs_count());
+    ASSERT_EQ(2, new_reader.live_docs_count());
+    reader = new_reader;
+  }
+  ASSERT_EQ(0, irs::directory_reader::open(dir(), codec()).docs_count());
+
+  // flushed segments are committed without further changes
+  writer->commit();
+  {
+    auto committed = irs::directory_reader::open(dir(), codec());
+    ASSERT_EQ(2, committed.size());
+    ASSERT_EQ(3, committed.docs_count());
+    ASSERT_EQ(2, committed.live_docs_count());
+
+    auto new_reader = writer->reader(reader);
+    ASSERT_EQ(2, new_reader.size());
+    ASSERT_EQ(2, new_reader.live_docs_count());
+  }
+
+  // flushed changes aren't part of a transaction, rollback keeps them
+  writer->documents().remove(remove_doc1);
+  writer->documents().remove(irs::all());
+  ASSERT_EQ(0, writer->reader().live_docs_count());
+  writer->rollback();
+  ASSERT_EQ(0, writer->reader().live_docs_count());
+  ASSERT_EQ(2, irs::directory_reader::open(dir(), codec()).live_docs_count());
+  writer->commit();
+  ASSERT_EQ(0, irs::directory_reader::open(dir(), codec()).live_docs_count());
+}
+
+TEST_P(index_test_case, nrt_reader_rollback) {
+  tests::json_doc_generator gen(
+    resource("simple_sequential.json"),
+    &tests::generic_json_field_factory);
+
+  tests::document const* doc1 = gen.next();
+  tests::document const* doc2 = gen.next();
+  tests::document const* doc3 = gen.next();
+
+  auto writer = open_writer();
+  writer->commit(); // create empty index
+
+  ASSERT_TRUE(insert(*writer,
+    doc1->indexed.begin(), doc1->indexed.end(),
+    doc1->stored.begin(), doc1->stored.end()
+  ));
+  ASSERT_EQ(1, writer->reader().docs_count());
+
+  // there is no transaction to roll back, flushed segment is kept
+  writer->rollback();
+  ASSERT_EQ(1, writer->reader().docs_count());
+  ASSERT_EQ(0, irs::directory_reader::open(dir(), codec()).docs_count());
+
+  // rollback of a started transaction discards documents buffered
+  // after the last flush only
+  ASSERT_TRUE(insert(*writer,
+    doc2->indexed.begin(), doc2->indexed.end(),
+    doc2->stored.begin(), doc2->stored.end()
+  ));
+  ASSERT_TRUE(writer->begin());
+  ASSERT_EQ(2, writer->reader().docs_count());
+  writer->rollback();
+  ASSERT_EQ(1, writer->reader().docs_count());
+  ASSERT_EQ(0, irs::directory_reader::open(dir(), codec()).docs_count());
+
+  // flushed segment is committed along with new documents
+  ASSERT_TRUE(insert(*writer,
+    doc3->indexed.begin(), doc3->indexed.end(),
+    doc3->stored.begin(), doc3->stored.end()
+  ));
+  writer->commit();
+
+  auto reader = irs::directory_reader::open(dir(), codec());
+  ASSERT_EQ(2, reader.size());
+  ASSERT_EQ(2, reader.docs_count());
+  ASSERT_EQ(2, reader.live_docs_count());
+}
+
+TEST_P(index_test_case, commit_flush_pool) {
+  tests::json_doc_generator gen(
+    resource("simple_sequential.json"),
+    [] (tests::document& doc, const std::string& name, const tests::json_doc_generator::json_value& data) {
+    if (data.is_string()) {
+      doc.insert(std::make_shared<tests::templates::string_field>(
+        irs::string_ref(name),
+        data.str
+      ));
+    }
+  });
+
+  irs::async_utils::thread_pool pool(4, 4);
+  irs::index_writer::init_options opts;
+  opts.flush_pool = &pool;
+  auto writer = open_writer(irs::OM_CREATE, opts);
+
+  std::unordered_set<std::string> expected_names;
+  const size_t segments_count = 8;
+
+  // every documents context holds its own segment, all of them are flushed
+  // concurrently by commit
+  for (size_t commit = 0; commit < 2; ++commit) {
+    {
+      std::vector<irs::index_writer::documents_context> ctxs;
+      ctxs.reserve(segments_count);
+      for (size_t i = 0; i < segments_count; ++i) {
+        ctxs.emplace_back(writer->documents());
+      }
+
+      for (size_t i = 0; i < 2*segments_count; ++i) {
+        const auto* src = gen.next();
+        ASSERT_NE(nullptr, src);
+        auto doc = ctxs[i % segments_count].insert();
+        ASSERT_TRUE(
+          doc.insert<irs::Action::INDEX>(src->indexed.begin(), src->indexed.end())
+          && doc.insert<irs::Action::STORE>(src->stored.begin(), src->stored.end())
+        );
+        expected_names.emplace(src->stored.get<tests::templates::string_field>("name")->value());
+      }
+    }
+
+    writer->commit();
+
+    auto reader = irs::directory_reader::open(dir(), codec());
+    ASSERT_EQ((1 + commit)*segments_count, reader.size());
+    ASSERT_EQ(expected_names.size(), reader.docs_count());
+
+    auto names = expected_names;
+    for (auto& segment : reader) {
+      ASSERT_EQ(2, segment.docs_count());
+      const auto* column = segment.column_reader("name");
+      ASSERT_NE(nullptr, column);
+      auto values = column->values();
+
+      irs::bytes_ref actual_value;
+      for (auto docs = segment.docs_iterator(); docs->next(); ) {
+        ASSERT_TRUE(values(docs->value(), actual_value));
+        ASSERT_EQ(1, names.erase(irs::to_string<std::string>(actual_value.c_str())));
+      }
+    }
+    ASSERT_TRUE(names.empty());
+  }
+}
+
+TEST_P(index_test_case, consolidate_background) {
+  tests::json_doc_generator gen(
+    resource("simple_sequential.json"),
+    &tests::generic_json_field_factory);
+
+  irs::async_utils::thread_pool pool(2, 2);
+  irs::index_writer::init_options opts;
+  opts.consolidation.pool = &pool;
+  opts.consolidation.max_concurrent = 2;
+  opts.consolidation.max_bytes_per_second = 1 << 30;
+  opts.consolidation.policies.emplace_back(
+    irs::index_utils::consolidation_policy(irs::index_utils::consolidate_count()));
+  auto writer = open_writer(irs::OM_CREATE, opts);
+
+  size_t docs_count = 0;
+
+  // every commit creates a new segment and triggers background consolidation
+  for (const tests::document* doc; docs_count < 8 && (doc = gen.next()); ++docs_count) {
+    ASSERT_TRUE(insert(*writer,
+      doc->indexed.begin(), doc->indexed.end(),
+      doc->stored.begin(), doc->stored.end()
+    ));
+    writer->commit();
+  }
+
+  // consolidated segments become visible with subsequent commits
+  auto reader = irs::directory_reader::open(dir(), codec());
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+
+  while (reader.size() > 1 && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    writer->commit();
+    reader = reader.reopen();
+  }
+
+  ASSERT_EQ(1, reader.size());
+  ASSERT_EQ(docs_count, reader.docs_count());
+  ASSERT_EQ(docs_count, reader.live_docs_count());
+
+  writer.reset(); // writer waits for running background tasks
+  pool.stop();
+}
+
+TEST_P(index_test_case, replace_by_term_bulk) {
+  tests::json_doc_generator gen(
+    resource("simple_sequential.json"),
+    [] (tests::document& doc, const std::string& name, const tests::json_doc_generator::json_value& data) {
+    if (data.is_string()) {
+      doc.insert(std::make_shared<tests::templates::string_field>(
+        irs::string_ref(name),
+        data.str
+      ));
+    }
+  });
+
+  auto make_by_term = [](const irs::string_ref& field, const irs::string_ref& term) {
+    auto filter = irs::memory::make_unique<irs::by_term>();
+    *filter->mutable_field() = field;
+    filter->mutable_options()->term = irs::ref_cast<irs::byte_type>(term);
+    return irs::filter::ptr(std::move(filter));
+  };
+
+  std::vector<const tests::document*> docs;
+  for (const tests::document* doc; (doc = gen.next()); ) {
+    docs.emplace_back(doc);
+  }
+  ASSERT_LT(8, docs.size());
+
+  auto name = [](const tests::document& doc) {
+    return irs::string_ref(doc.stored.get<tests::templates::string_field>("name")->value());
+  };
+
+  auto writer = open_writer();
+
+  // committed segment
+  {
+    auto ctx = writer->documents();
+
+    for (auto* src : docs) {
+      auto doc = ctx.insert();
+      ASSERT_TRUE(
+        doc.insert<irs::Action::INDEX>(src->indexed.begin(), src->indexed.end())
+        && doc.insert<irs::Action::STORE>(src->stored.begin(), src->stored.end())
+      );
+    }
+  }
+
+  writer->commit();
+
+  // term modifications are resolved in bulk against both committed and
+  // uncommitted segments, but applied in order of requests
+  {
+    auto ctx = writer->documents();
+
+    for (size_t i = 0; i < docs.size(); ++i) {
+      auto& src = *docs[i];
+
+      switch (i % 4) {
+        case 0: { // replace by term
+          auto doc = ctx.replace(make_by_term("name", name(src)));
+          ASSERT_TRUE(
+            doc.insert<irs::Action::INDEX>(src.indexed.begin(), src.indexed.end())
+            && doc.insert<irs::Action::STORE>(src.stored.begin(), src.stored.end())
+          );
+        } break;
+        case 1: // remove by the same term twice
+          ctx.remove(make_by_term("name", name(src)));
+          ctx.remove(make_by_term("name", name(src)));
+          break;
+        case 2: { // replace by term matching nothing, i.e. nothing is inserted
+          auto doc = ctx.replace(make_by_term("name", "invalid_term"));
+          ASSERT_TRUE(
+            doc.insert<irs::Action::INDEX>(src.indexed.begin(), src.indexed.end())
+            && doc.insert<irs::Action::STORE>(src.stored.begin(), src.stored.end())
+          );
+        } break;
+        default: // remove by term of a missing field
+          ctx.remove(make_by_term("invalid_field", name(src)));
+      }
+    }
+
+    // replace a document inserted by the same transaction
+    auto& src = *docs[0];
+    auto doc = ctx.replace(make_by_term("name", name(src)));
+    ASSERT_TRUE(
+      doc.insert<irs::Action::INDEX>(src.indexed.begin(), src.indexed.end())
+      && doc.insert<irs::Action::STORE>(src.stored.begin(), src.stored.end())
+    );
+  }
+
+  writer->commit();
+
+  std::multiset<std::string> actual_names;
+  auto reader = irs::directory_reader::open(dir(), codec());
+
+  for (auto& segment : reader) {
+    const auto* column = segment.column_reader("name");
+    ASSERT_NE(nullptr, column);
+    auto values = column->values();
+
+    irs::bytes_ref actual_value;
+    for (auto itr = segment.docs_iterator(); itr->next(); ) {
+      ASSERT_TRUE(values(itr->value(), actual_value));
+      actual_names.emplace(irs::to_string<std::string>(actual_value.c_str()));
+    }
+  }
+
+  std::multiset<std::string> expected;
+  for (size_t i = 0; i < docs.size(); ++i) {
+    if (1 != i % 4) { // not removed
+      expected.emplace(name(*docs[i]));
+    }
+  }
+  ASSERT_EQ(expected, actual_names);
+  ASSERT_EQ(expected.size(), reader.live_docs_count());
+}
+
 TEST_P(index_test_case, writer_close) {
   tests::json_doc_generator gen(
     resource("simple_sequential.json"),
@@ -13689,6 +14160,30 @@ INSTANTIATE_TEST_CASE_P(
   tests::to_string
 );
 
+// Separate definition as MSVC parser fails to do conditional defines in macro expansion
+namespace {
+#if defined(IRESEARCH_SSE2)
+const auto index_test_case_16_values = ::testing::Values(tests::format_info{"1_6", "1_0"},
+                                                         tests::format_info{"1_6simd", "1_0"});
+#else
+const auto index_test_case_16_values = ::testing::Values(tests::format_info{"1_6", "1_0"});
+#endif
+}
+
+INSTANTIATE_TEST_CASE_P(
+  index_test_16,
+  index_test_case,
+  ::testing::Combine(
+    ::testing::Values(
+      tests::memory_directory,
+      &tests::rot13_cipher_directory<&tests::memory_directory, 16>,
+      &tests::rot13_cipher_directory<&tests::mmap_directory, 16>
+    ),
+    index_test_case_16_values
+  ),
+  tests::to_string
+);
+
 class index_test_case_10 : public tests::index_test_base { };
 
 TEST_P(index_test_case_10, commit_payload) {
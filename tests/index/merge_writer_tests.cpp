@@ -25,6 +25,7 @@
 #include "formats/formats_10.hpp"
 #include "iql/query_builder.hpp"
 #include "store/memory_directory.hpp"
+#include "utils/async_utils.hpp"
 #include "utils/type_limits.hpp"
 #include "utils/lz4compression.hpp"
 #include "index/merge_writer.hpp"
@@ -2248,6 +2249,242 @@ TEST_F(merge_writer_tests, test_merge_writer_add_segments) {
   }
 }
 
+TEST_F(merge_writer_tests, test_merge_writer_pool) {
+  auto codec_ptr = irs::formats::get("1_0");
+  ASSERT_NE(nullptr, codec_ptr);
+  irs::memory_directory data_dir;
+
+  // populate directory
+  {
+    tests::json_doc_generator gen(
+      test_base::resource("simple_sequential.json"),
+      &tests::generic_json_field_factory
+    );
+    auto writer = irs::index_writer::make(data_dir, codec_ptr, irs::OM_CREATE);
+
+    for (size_t i = 0; i < 4; ++i) {
+      auto* doc = gen.next();
+      ASSERT_NE(nullptr, doc);
+      ASSERT_TRUE(insert(
+        *writer,
+        doc->indexed.begin(), doc->indexed.end(),
+        doc->stored.begin(), doc->stored.end()
+      ));
+      writer->commit(); // create segmentN
+    }
+  }
+
+  auto reader = irs::directory_reader::open(data_dir, codec_ptr);
+  ASSERT_EQ(4, reader.size());
+
+  irs::column_info_provider_t column_info = [](const irs::string_ref&) {
+    return irs::column_info(irs::type<irs::compression::lz4>::get(), irs::compression::options{}, true );
+  };
+
+  irs::async_utils::thread_pool pool(2, 2);
+  irs::memory_directory expected_dir;
+  irs::memory_directory dir;
+  irs::index_meta::index_segment_t expected_segment;
+  irs::index_meta::index_segment_t index_segment;
+
+  // merge segments one after another
+  {
+    irs::merge_writer writer(expected_dir, column_info);
+
+    for (auto& sub_reader: reader) {
+      writer.add(sub_reader);
+    }
+
+    expected_segment.meta.codec = codec_ptr;
+    ASSERT_TRUE(writer.flush(expected_segment));
+  }
+
+  // merge segments writing columns and fields concurrently
+  {
+    irs::merge_writer writer(dir, column_info, nullptr, &pool);
+
+    for (auto& sub_reader: reader) {
+      writer.add(sub_reader);
+    }
+
+    std::atomic<size_t> calls{0};
+    index_segment.meta.codec = codec_ptr;
+    ASSERT_TRUE(writer.flush(index_segment, [&calls]()->bool { ++calls; return true; }));
+    ASSERT_LT(0, calls);
+  }
+
+  auto expected = irs::segment_reader::open(expected_dir, expected_segment.meta);
+  auto segment = irs::segment_reader::open(dir, index_segment.meta);
+  ASSERT_EQ(4, segment.docs_count());
+  ASSERT_EQ(expected.docs_count(), segment.docs_count());
+  ASSERT_EQ(expected.live_docs_count(), segment.live_docs_count());
+  ASSERT_EQ(expected.size(), segment.size());
+
+  // fields are identical
+  {
+    auto expected_fields = expected.fields();
+    auto fields = segment.fields();
+
+    while (expected_fields->next()) {
+      ASSERT_TRUE(fields->next());
+      auto& expected_field = expected_fields->value();
+      auto& field = fields->value();
+      ASSERT_EQ(expected_field.meta().name, field.meta().name);
+      ASSERT_EQ(expected_field.meta().features, field.meta().features);
+      ASSERT_EQ(expected_field.size(), field.size());
+      ASSERT_EQ(expected_field.docs_count(), field.docs_count());
+      ASSERT_EQ(irs::field_limits::valid(expected_field.meta().norm),
+                irs::field_limits::valid(field.meta().norm));
+
+      auto expected_terms = expected_field.iterator();
+      auto terms = field.iterator();
+
+      while (expected_terms->next()) {
+        ASSERT_TRUE(terms->next());
+        ASSERT_EQ(expected_terms->value(), terms->value());
+      }
+      ASSERT_FALSE(terms->next());
+    }
+    ASSERT_FALSE(fields->next());
+  }
+
+  // columns are identical
+  {
+    auto expected_columns = expected.columns();
+    auto columns = segment.columns();
+
+    while (expected_columns->next()) {
+      ASSERT_TRUE(columns->next());
+      ASSERT_EQ(expected_columns->value().name, columns->value().name);
+
+      auto expected_values = expected.column_reader(expected_columns->value().id)->values();
+      auto values = segment.column_reader(columns->value().id)->values();
+
+      for (irs::doc_id_t doc = irs::doc_limits::min(); doc < irs::doc_limits::min() + segment.docs_count(); ++doc) {
+        irs::bytes_ref expected_value;
+        irs::bytes_ref value;
+        ASSERT_EQ(expected_values(doc, expected_value), values(doc, value));
+        ASSERT_EQ(expected_value, value);
+      }
+    }
+    ASSERT_FALSE(columns->next());
+  }
+}
+
+TEST_F(merge_writer_tests, test_merge_writer_pool_large_columns) {
+  auto codec_ptr = irs::formats::get("1_0");
+  ASSERT_NE(nullptr, codec_ptr);
+  irs::memory_directory data_dir;
+
+  // values of every column span multiple chunks passed between threads
+  constexpr size_t SEGMENTS = 3;
+  constexpr size_t DOCS = 200;
+  const std::string names[] { "column0", "column1", "column2" };
+
+  // populate directory
+  {
+    auto writer = irs::index_writer::make(data_dir, codec_ptr, irs::OM_CREATE);
+
+    for (size_t i = 0; i < SEGMENTS; ++i) {
+      for (size_t j = 0; j < DOCS; ++j) {
+        tests::document doc;
+
+        for (auto& name : names) {
+          std::string value(1024 + j, char('a' + (i + j) % 26));
+          value.append(name);
+          doc.insert(std::make_shared<tests::templates::string_field>(name, value), false, true);
+        }
+
+        ASSERT_TRUE(insert(*writer, doc.indexed.begin(), doc.indexed.end(),
+                           doc.stored.begin(), doc.stored.end()));
+      }
+
+      writer->commit(); // create segmentN
+    }
+  }
+
+  auto reader = irs::directory_reader::open(data_dir, codec_ptr);
+  ASSERT_EQ(SEGMENTS, reader.size());
+
+  irs::column_info_provider_t column_info = [](const irs::string_ref&) {
+    return irs::column_info(irs::type<irs::compression::lz4>::get(), irs::compression::options{}, true );
+  };
+
+  irs::async_utils::thread_pool pool(2, 2);
+  irs::memory_directory expected_dir;
+  irs::memory_directory dir;
+  irs::index_meta::index_segment_t expected_segment;
+  irs::index_meta::index_segment_t index_segment;
+
+  // merge segments one after another
+  {
+    irs::merge_writer writer(expected_dir, column_info);
+
+    for (auto& sub_reader: reader) {
+      writer.add(sub_reader);
+    }
+
+    expected_segment.meta.codec = codec_ptr;
+    ASSERT_TRUE(writer.flush(expected_segment));
+  }
+
+  // stop requested during flush
+  {
+    irs::memory_directory aborted_dir;
+    irs::merge_writer writer(aborted_dir, column_info, nullptr, &pool);
+
+    for (auto& sub_reader: reader) {
+      writer.add(sub_reader);
+    }
+
+    std::atomic<size_t> calls{0};
+    irs::index_meta::index_segment_t aborted_segment;
+    aborted_segment.meta.codec = codec_ptr;
+    ASSERT_FALSE(writer.flush(aborted_segment, [&calls]()->bool { return ++calls < 8; }));
+  }
+
+  // merge segments writing columns concurrently
+  {
+    irs::merge_writer writer(dir, column_info, nullptr, &pool);
+
+    for (auto& sub_reader: reader) {
+      writer.add(sub_reader);
+    }
+
+    index_segment.meta.codec = codec_ptr;
+    ASSERT_TRUE(writer.flush(index_segment));
+  }
+
+  auto expected = irs::segment_reader::open(expected_dir, expected_segment.meta);
+  auto segment = irs::segment_reader::open(dir, index_segment.meta);
+  ASSERT_EQ(SEGMENTS * DOCS, segment.docs_count());
+  ASSERT_EQ(expected.docs_count(), segment.docs_count());
+
+  // columns are identical
+  auto expected_columns = expected.columns();
+  auto columns = segment.columns();
+
+  for (auto& name : names) {
+    ASSERT_TRUE(expected_columns->next());
+    ASSERT_TRUE(columns->next());
+    ASSERT_EQ(name, expected_columns->value().name);
+    ASSERT_EQ(name, columns->value().name);
+
+    auto expected_values = expected.column_reader(expected_columns->value().id)->values();
+    auto values = segment.column_reader(columns->value().id)->values();
+
+    for (irs::doc_id_t doc = irs::doc_limits::min(); doc < irs::doc_limits::min() + segment.docs_count(); ++doc) {
+      irs::bytes_ref expected_value;
+      irs::bytes_ref value;
+      ASSERT_TRUE(expected_values(doc, expected_value));
+      ASSERT_TRUE(values(doc, value));
+      ASSERT_EQ(expected_value, value);
+    }
+  }
+  ASSERT_FALSE(expected_columns->next());
+  ASSERT_FALSE(columns->next());
+}
+
 TEST_F(merge_writer_tests, test_merge_writer_flush_progress) {
   auto codec_ptr = irs::formats::get("1_0");
   ASSERT_NE(nullptr, codec_ptr);
@@ -159,3 +159,48 @@ TEST(postings_tests, slice_alignment) {
     ASSERT_EQ(tests::detail::to_bytes_ref("string1"), bh.begin()->first);
   }
 }
+
+TEST(postings_tests, rehash) {
+  const uint32_t block_size = 32768;
+  block_pool<byte_type, block_size> pool;
+  block_pool<byte_type, block_size>::inserter writer(pool.begin());
+  postings bh(writer);
+
+  std::vector<std::string> data;
+  for (size_t i = 0; i < 10000; ++i) {
+    data.emplace_back(std::to_string(i));
+  }
+
+  for (size_t pass = 0; pass < 2; ++pass) {
+    // insert terms growing the table several times
+    for (size_t i = 0; i < data.size(); ++i) {
+      auto res = bh.emplace(tests::detail::to_bytes_ref(data[i]));
+      ASSERT_TRUE(res.second);
+      ASSERT_NE(bh.end(), res.first);
+      res.first->second.doc = irs::doc_id_t(i);
+    }
+    ASSERT_EQ(data.size(), bh.size());
+
+    // existing terms are found along with their postings
+    for (size_t i = 0; i < data.size(); ++i) {
+      auto res = bh.emplace(tests::detail::to_bytes_ref(data[i]));
+      ASSERT_FALSE(res.second);
+      ASSERT_NE(bh.end(), res.first);
+      ASSERT_EQ(tests::detail::to_bytes_ref(data[i]), res.first->first);
+      ASSERT_EQ(irs::doc_id_t(i), res.first->second.doc);
+    }
+    ASSERT_EQ(data.size(), bh.size());
+
+    // postings are iterated in order of insertion
+    size_t i = 0;
+    for (auto& entry : bh) {
+      ASSERT_EQ(tests::detail::to_bytes_ref(data[i++]), entry.first);
+    }
+    ASSERT_EQ(data.size(), i);
+
+    // reuse after clear
+    bh.clear();
+    ASSERT_TRUE(bh.empty());
+    ASSERT_EQ(0, bh.size());
+  }
+}
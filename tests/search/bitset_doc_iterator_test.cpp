@@ -948,4 +948,42 @@ TEST(bitset_iterator_test, seek_next) {
   }
 }
 
+TEST(bitset_iterator_test, materialize) {
+  const size_t size = 189;
+
+  // bitset is owned by an iterator
+  irs::bitset expected(size);
+  irs::doc_iterator::ptr it;
+  {
+    irs::bitset bs(size);
+    for (size_t i = 1; i < size; i += 7) {
+      bs.set(i);
+      expected.set(i);
+    }
+
+    it = irs::memory::make_managed<irs::bitset_doc_iterator>(std::move(bs));
+  }
+
+  auto* cost = irs::get<irs::cost>(*it);
+  ASSERT_TRUE(bool(cost));
+  ASSERT_EQ(expected.count(), cost->estimate());
+
+  // skip the first document
+  ASSERT_TRUE(it->next());
+  ASSERT_EQ(1, it->value());
+  expected.unset(1);
+
+  irs::bitset actual(size);
+  ASSERT_EQ(expected.count(), irs::materialize(*it, actual));
+  for (size_t i = 0; i < size; ++i) {
+    ASSERT_EQ(expected.test(i), actual.test(i));
+  }
+  ASSERT_TRUE(irs::doc_limits::eof(it->value()));
+
+  // exhausted iterator
+  actual.clear();
+  ASSERT_EQ(0, irs::materialize(*it, actual));
+  ASSERT_TRUE(actual.none());
+}
+
 #endif
@@ -34,6 +34,8 @@
 #include "search/score.hpp"
 #include "search/bm25.hpp"
 #include "search/term_filter.hpp"
+#include "search/top_docs.hpp"
+#include "store/memory_directory.hpp"
 #include "utils/utf8_path.hpp"
 
 namespace {
@@ -1451,6 +1453,487 @@ INSTANTIATE_TEST_CASE_P(
   tests::to_string
 );
 
+class bm25_block_max_test: public index_test_base { };
+
+TEST_P(bm25_block_max_test, test_top_k_disjunction) {
+  {
+    tests::templates::europarl_doc_template doc;
+    tests::delim_doc_generator gen(resource("europarl.subset.txt"), doc);
+    add_segment(gen);
+  }
+
+  auto reader = irs::directory_reader::open(dir(), codec());
+  ASSERT_EQ(1, reader.size());
+  auto& segment = reader[0];
+
+  irs::Or query;
+  for (auto* term : { "the", "of", "european", "commission", "report", "mr", "and", "union" }) {
+    auto& filter = query.add<irs::by_term>();
+    *filter.mutable_field() = "body_anl";
+    filter.mutable_options()->term = irs::ref_cast<irs::byte_type>(irs::string_ref(term));
+  }
+
+  irs::order ord;
+  ord.add<irs::bm25_sort>(true);
+  auto prepared_order = ord.prepare();
+  auto prepared = query.prepare(reader, prepared_order);
+  ASSERT_NE(nullptr, prepared);
+
+  using entry = std::pair<float_t, irs::doc_id_t>;
+  constexpr size_t TOP_K = 10;
+
+  // exhaustive evaluation
+  std::vector<entry> expected;
+  {
+    auto docs = prepared->execute(segment, prepared_order);
+    ASSERT_NE(nullptr, irs::get<irs::score_threshold>(*docs));
+    auto& score = irs::score::get(*docs);
+
+    while (docs->next()) {
+      expected.emplace_back(*reinterpret_cast<const float_t*>(score.evaluate()), docs->value());
+    }
+
+    std::sort(expected.begin(), expected.end(), std::greater<>());
+    ASSERT_LT(TOP_K, expected.size());
+    expected.resize(TOP_K);
+  }
+
+  // evaluation with threshold feedback
+  std::vector<entry> actual;
+  size_t evaluated = 0;
+  {
+    auto docs = prepared->execute(segment, prepared_order);
+    auto* threshold = irs::get_mutable<irs::score_threshold>(docs.get());
+    ASSERT_NE(nullptr, threshold);
+    auto& score = irs::score::get(*docs);
+
+    auto less = std::greater<>();
+    while (docs->next()) {
+      ++evaluated;
+      const entry value{ *reinterpret_cast<const float_t*>(score.evaluate()), docs->value() };
+
+      if (actual.size() < TOP_K) {
+        actual.emplace_back(value);
+        std::push_heap(actual.begin(), actual.end(), less);
+      } else if (value.first > actual.front().first) {
+        std::pop_heap(actual.begin(), actual.end(), less);
+        actual.back() = value;
+        std::push_heap(actual.begin(), actual.end(), less);
+      } else {
+        continue;
+      }
+
+      if (actual.size() == TOP_K) {
+        threshold->value.resize(prepared_order.score_size());
+        std::memcpy(&threshold->value[0], &actual.front().first, sizeof(float_t));
+      }
+    }
+
+    std::sort(actual.begin(), actual.end(), std::greater<>());
+  }
+
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_NEAR(expected[i].first, actual[i].first, 1e-5);
+  }
+  ASSERT_LT(evaluated, segment.docs_count());
+}
+
+//////////////////////////////////////////////////////////////////////////////
+/// @class delimited_field
+/// @brief whitespace delimited field with frequencies and optionally norms
+//////////////////////////////////////////////////////////////////////////////
+class delimited_field final : public tests::field_base {
+ public:
+  delimited_field(const irs::string_ref& name, const std::string& value,
+                  bool norms = false)
+    : stream_(irs::analysis::analyzers::get(
+        "delimiter", irs::type<irs::text_format::text>::get(), " ")),
+      value_(value),
+      norms_(norms) {
+    this->name(name);
+  }
+
+  virtual const irs::flags& features() const override {
+    static const irs::flags features[] {
+      { irs::type<irs::frequency>::get() },
+      { irs::type<irs::frequency>::get(), irs::type<irs::norm>::get() }
+    };
+    return features[norms_];
+  }
+
+  virtual irs::token_stream& get_tokens() const override {
+    stream_->reset(value_);
+    return *stream_;
+  }
+
+  virtual bool write(irs::data_output&) const override {
+    return false;
+  }
+
+ private:
+  irs::analysis::analyzer::ptr stream_;
+  std::string value_;
+  bool norms_;
+}; // delimited_field
+
+// evaluate top-k of a specified query exhaustively and with the library
+// collector, which lets iterators skip documents via 'score_threshold'
+void assert_top_k(
+    const irs::sub_reader& segment,
+    const irs::filter::prepared& query,
+    const irs::order::prepared& ord,
+    size_t k) {
+  // exhaustive evaluation
+  std::vector<float_t> expected;
+  {
+    auto docs = query.execute(segment, ord);
+    ASSERT_NE(nullptr, irs::get<irs::score_threshold>(*docs));
+    auto& score = irs::score::get(*docs);
+
+    while (docs->next()) {
+      expected.emplace_back(*reinterpret_cast<const float_t*>(score.evaluate()));
+    }
+
+    std::sort(expected.begin(), expected.end(), std::greater<>());
+  }
+  ASSERT_LT(k, expected.size());
+
+  // evaluation with threshold feedback
+  irs::top_docs_collector collector(ord, k);
+  {
+    auto docs = query.execute(segment, ord);
+    collector.collect(0, *docs);
+  }
+  ASSERT_LT(collector.visited(), expected.size());
+
+  const auto actual = collector.finish();
+  ASSERT_EQ(k, actual.size());
+  for (size_t i = 0; i < k; ++i) {
+    ASSERT_EQ(0, actual[i].segment);
+    ASSERT_NEAR(expected[i], *reinterpret_cast<const float_t*>(actual[i].score.c_str()), 1e-5);
+  }
+}
+
+TEST_P(bm25_block_max_test, test_top_k_collector_disjunction) {
+  {
+    tests::templates::europarl_doc_template doc;
+    tests::delim_doc_generator gen(resource("europarl.subset.txt"), doc);
+    add_segment(gen);
+  }
+
+  auto reader = irs::directory_reader::open(dir(), codec());
+  ASSERT_EQ(1, reader.size());
+
+  irs::Or query;
+  for (auto* term : { "the", "european", "commission", "union" }) {
+    auto& filter = query.add<irs::by_term>();
+    *filter.mutable_field() = "body_anl";
+    filter.mutable_options()->term = irs::ref_cast<irs::byte_type>(irs::string_ref(term));
+  }
+
+  irs::order ord;
+  ord.add<irs::bm25_sort>(true);
+  auto prepared_order = ord.prepare();
+  auto prepared = query.prepare(reader, prepared_order);
+  ASSERT_NE(nullptr, prepared);
+
+  assert_top_k(reader[0], *prepared, prepared_order, 10);
+}
+
+TEST_P(bm25_block_max_test, test_top_k_collector_conjunction) {
+  // few leading documents with high term frequencies,
+  // the rest of postings blocks can't compete
+  {
+    std::string frequent;
+    for (size_t i = 0; i < 64; ++i) {
+      frequent += "quick fox ";
+    }
+
+    auto writer = open_writer();
+    for (size_t i = 0; i < 2000; ++i) {
+      tests::document doc;
+      doc.insert(std::make_shared<delimited_field>(
+        "body", i < 20 ? frequent : "quick fox"));
+      ASSERT_TRUE(insert(*writer, doc.indexed.begin(), doc.indexed.end()));
+    }
+    writer->commit();
+  }
+
+  auto reader = irs::directory_reader::open(dir(), codec());
+  ASSERT_EQ(1, reader.size());
+
+  irs::And query;
+  for (auto* term : { "quick", "fox" }) {
+    auto& filter = query.add<irs::by_term>();
+    *filter.mutable_field() = "body";
+    filter.mutable_options()->term = irs::ref_cast<irs::byte_type>(irs::string_ref(term));
+  }
+
+  irs::order ord;
+  ord.add<irs::bm25_sort>(true);
+  auto prepared_order = ord.prepare();
+  auto prepared = query.prepare(reader, prepared_order);
+  ASSERT_NE(nullptr, prepared);
+
+  assert_top_k(reader[0], *prepared, prepared_order, 10);
+}
+
+TEST_P(bm25_block_max_test, test_conjunction_seek_current) {
+  {
+    auto writer = open_writer();
+    for (size_t i = 0; i < 2000; ++i) {
+      tests::document doc;
+      doc.insert(std::make_shared<delimited_field>("body", "quick fox"));
+      ASSERT_TRUE(insert(*writer, doc.indexed.begin(), doc.indexed.end()));
+    }
+    writer->commit();
+  }
+
+  auto reader = irs::directory_reader::open(dir(), codec());
+  ASSERT_EQ(1, reader.size());
+
+  irs::And query;
+  for (auto* term : { "quick", "fox" }) {
+    auto& filter = query.add<irs::by_term>();
+    *filter.mutable_field() = "body";
+    filter.mutable_options()->term = irs::ref_cast<irs::byte_type>(irs::string_ref(term));
+  }
+
+  irs::order ord;
+  ord.add<irs::bm25_sort>(true);
+  auto prepared_order = ord.prepare();
+  auto prepared = query.prepare(reader, prepared_order);
+  ASSERT_NE(nullptr, prepared);
+
+  auto docs = prepared->execute(reader[0], prepared_order);
+  auto* threshold = irs::get_mutable<irs::score_threshold>(docs.get());
+  ASSERT_NE(nullptr, threshold);
+  ASSERT_TRUE(docs->next());
+  const auto doc = docs->value();
+
+  // nothing can compete from now on
+  const auto max = std::numeric_limits<float_t>::max();
+  threshold->value.resize(prepared_order.score_size());
+  std::memcpy(&threshold->value[0], &max, sizeof(float_t));
+
+  // seeking the current document doesn't move the iterator
+  ASSERT_EQ(doc, docs->seek(doc));
+  ASSERT_EQ(doc, docs->seek(doc));
+  ASSERT_EQ(doc, docs->seek(irs::doc_limits::min()));
+  ASSERT_EQ(doc, docs->value());
+
+  ASSERT_TRUE(irs::doc_limits::eof(docs->seek(doc + 1)));
+  ASSERT_TRUE(irs::doc_limits::eof(docs->value()));
+}
+
+TEST_P(bm25_block_max_test, test_batch_scores) {
+  // documents of various lengths and term frequencies
+  {
+    auto writer = open_writer();
+    for (size_t i = 0; i < 1000; ++i) {
+      std::string value;
+      for (size_t j = 0, freq = 1 + i % 7; j < freq; ++j) {
+        value += "quick ";
+      }
+      for (size_t j = 0, length = i % 13; j < length; ++j) {
+        value += "fox ";
+      }
+
+      tests::document doc;
+      doc.insert(std::make_shared<delimited_field>("body", value, true));
+      ASSERT_TRUE(insert(*writer, doc.indexed.begin(), doc.indexed.end()));
+    }
+    writer->commit();
+  }
+
+  auto reader = irs::directory_reader::open(dir(), codec());
+  ASSERT_EQ(1, reader.size());
+  auto& segment = reader[0];
+
+  irs::by_term query;
+  *query.mutable_field() = "body";
+  query.mutable_options()->term = irs::ref_cast<irs::byte_type>(irs::string_ref("quick"));
+
+  // BM25 with norms and BM15 without
+  for (const float_t b : { irs::bm25_sort::B(), 0.f }) {
+    SCOPED_TRACE(b);
+    irs::order ord;
+    ord.add<irs::bm25_sort>(true, irs::bm25_sort::K(), b);
+    auto prepared_order = ord.prepare();
+    auto prepared = query.prepare(reader, prepared_order);
+    ASSERT_NE(nullptr, prepared);
+
+    std::vector<std::pair<irs::doc_id_t, float_t>> expected;
+    {
+      auto docs = prepared->execute(segment, prepared_order);
+      auto& score = irs::score::get(*docs);
+      while (docs->next()) {
+        expected.emplace_back(docs->value(), *reinterpret_cast<const float_t*>(score.evaluate()));
+      }
+    }
+    ASSERT_EQ(1000, expected.size());
+
+    auto docs = prepared->execute(segment, prepared_order);
+    auto& score = irs::score::get(*docs);
+    auto* block = irs::postings_block::get(*docs);
+    ASSERT_NE(nullptr, block);
+
+    // norms are read from the column unless stored inline
+    if (0.f != b && !irs::get<irs::quantized_norm>(*docs)) {
+      ASSERT_FALSE(score.is_batched());
+      continue;
+    }
+    ASSERT_TRUE(score.is_batched());
+
+    auto it = expected.begin();
+    for (size_t count; (count = block->fetch()); ) {
+      std::vector<float_t> scores(count);
+      score.evaluate(block->freqs, block->norms, count,
+                     reinterpret_cast<irs::byte_type*>(scores.data()));
+
+      for (size_t i = 0; i < count; ++i, ++it) {
+        ASSERT_NE(expected.end(), it);
+        ASSERT_EQ(it->first, block->docs[i]);
+        ASSERT_FLOAT_EQ(it->second, scores[i]);
+      }
+    }
+    ASSERT_EQ(expected.end(), it);
+
+    // collector scores blocks of postings at once
+    std::sort(expected.begin(), expected.end(), [](const auto& lhs, const auto& rhs) {
+      return lhs.second > rhs.second || (lhs.second == rhs.second && lhs.first < rhs.first);
+    });
+
+    irs::top_docs_collector collector(prepared_order, 10);
+    collector.collect(0, *prepared->execute(segment, prepared_order));
+    ASSERT_EQ(1000, collector.visited());
+    const auto actual = collector.finish();
+    ASSERT_EQ(10, actual.size());
+    for (size_t i = 0; i < actual.size(); ++i) {
+      ASSERT_FLOAT_EQ(expected[i].second, *reinterpret_cast<const float_t*>(actual[i].score.c_str()));
+    }
+  }
+}
+
+// Separate definition as MSVC parser fails to do conditional defines in macro expansion
+#if defined(IRESEARCH_SSE2)
+const auto bm25_block_max_test_values = ::testing::Values(tests::format_info{"1_5", "1_0"},
+                                                          tests::format_info{"1_5simd", "1_0"},
+                                                          tests::format_info{"1_6", "1_0"},
+                                                          tests::format_info{"1_6simd", "1_0"});
+#else
+const auto bm25_block_max_test_values = ::testing::Values(tests::format_info{"1_5", "1_0"},
+                                                          tests::format_info{"1_6", "1_0"});
+#endif
+
+INSTANTIATE_TEST_CASE_P(
+  bm25_block_max_test,
+  bm25_block_max_test,
+  ::testing::Combine(
+    ::testing::Values(
+      &tests::memory_directory,
+      &tests::fs_directory,
+      &tests::mmap_directory
+    ),
+    bm25_block_max_test_values
+  ),
+  tests::to_string
+);
+
+class bm25_inline_norms_test: public index_test_base { };
+
+TEST_P(bm25_inline_norms_test, test_query_norms) {
+  auto field_factory = [](tests::document& doc, const std::string& name,
+                          const tests::json_doc_generator::json_value& data) {
+    static irs::flags extra_features = { irs::type<irs::norm>::get() };
+
+    if (data.is_string()) { // field
+      doc.insert(std::make_shared<templates::string_field>(name, data.str, extra_features), true, false);
+    } else if (data.is_number()) { // seq
+      const auto value = std::to_string(data.as_number<uint64_t>());
+      doc.insert(std::make_shared<templates::string_field>(name, value, extra_features), false, true);
+    }
+  };
+
+  {
+    tests::json_doc_generator gen(resource("simple_sequential_order.json"), field_factory);
+    add_segment(gen);
+  }
+
+  // same documents indexed with norms stored in a column only
+  irs::memory_directory legacy_dir;
+  {
+    auto legacy_codec = irs::formats::get("1_5");
+    ASSERT_NE(nullptr, legacy_codec);
+    auto writer = irs::index_writer::make(legacy_dir, legacy_codec, irs::OM_CREATE);
+    tests::json_doc_generator gen(resource("simple_sequential_order.json"), field_factory);
+    tests::index_segment segment;
+    write_segment(*writer, segment, gen);
+    writer->commit();
+  }
+
+  auto reader = irs::directory_reader::open(dir(), codec());
+  ASSERT_EQ(1, reader.size());
+  auto legacy_reader = irs::directory_reader::open(legacy_dir);
+  ASSERT_EQ(1, legacy_reader.size());
+
+  irs::Or query;
+  for (auto* term : { "2", "7", "9" }) {
+    auto& filter = query.add<irs::by_term>();
+    *filter.mutable_field() = "field";
+    filter.mutable_options()->term = irs::ref_cast<irs::byte_type>(irs::string_ref(term));
+  }
+
+  irs::order ord;
+  ord.add<irs::bm25_sort>(true);
+  auto prepared_order = ord.prepare();
+
+  auto evaluate = [&](const irs::index_reader& index) {
+    std::map<irs::doc_id_t, float_t> scores;
+    auto prepared = query.prepare(index, prepared_order);
+    auto docs = prepared->execute(index[0], prepared_order);
+    auto& score = irs::score::get(*docs);
+    while (docs->next()) {
+      scores.emplace(docs->value(), *reinterpret_cast<const float_t*>(score.evaluate()));
+    }
+    return scores;
+  };
+
+  // inline norms are exact for short fields
+  const auto expected = evaluate(legacy_reader);
+  const auto actual = evaluate(reader);
+  ASSERT_FALSE(expected.empty());
+  ASSERT_EQ(expected.size(), actual.size());
+  for (auto& entry : expected) {
+    auto it = actual.find(entry.first);
+    ASSERT_NE(actual.end(), it);
+    ASSERT_NEAR(entry.second, it->second, 1e-5);
+  }
+}
+
+// Separate definition as MSVC parser fails to do conditional defines in macro expansion
+#if defined(IRESEARCH_SSE2)
+const auto bm25_inline_norms_test_values = ::testing::Values(tests::format_info{"1_6", "1_0"},
+                                                             tests::format_info{"1_6simd", "1_0"});
+#else
+const auto bm25_inline_norms_test_values = ::testing::Values(tests::format_info{"1_6", "1_0"});
+#endif
+
+INSTANTIATE_TEST_CASE_P(
+  bm25_inline_norms_test,
+  bm25_inline_norms_test,
+  ::testing::Combine(
+    ::testing::Values(
+      &tests::memory_directory,
+      &tests::fs_directory,
+      &tests::mmap_directory
+    ),
+    bm25_inline_norms_test_values
+  ),
+  tests::to_string
+);
+
 #endif // IRESEARCH_DLL
 
 } // namespace {
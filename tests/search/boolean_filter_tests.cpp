@@ -24,7 +24,9 @@
 #include "tests_shared.hpp"
 #include "search/all_filter.hpp"
 #include "search/all_iterator.hpp"
+#include "search/bitset_doc_iterator.hpp"
 #include "search/boolean_filter.hpp"
+#include "search/conjunction.hpp"
 #include "search/range_filter.hpp"
 #include "search/disjunction.hpp"
 #include "search/min_match_disjunction.hpp"
@@ -14097,6 +14099,50 @@ TEST_P(boolean_filter_test_case, and_sequential) {
     append<irs::by_term>(root, "name", "B"); // 2
     check_query(root, docs_t{}, rdr);
   }
+
+  // duplicated=abcd AND same=xyz AND prefix=abcy (dense terms are intersected via bitsets)
+  {
+    irs::And root;
+    root.dense_intersection(true);
+    append<irs::by_term>(root, "duplicated", "abcd"); // 1,5,11,21,27,31
+    append<irs::by_term>(root, "same", "xyz"); // 1..32
+    append<irs::by_term>(root, "prefix", "abcy"); // 31,32
+    check_query(root, docs_t{ 31 }, rdr);
+  }
+
+  // duplicated=abcd AND same=xyz AND duplicated=vczc (dense terms are intersected via bitsets)
+  {
+    irs::And root;
+    root.dense_intersection(true);
+    append<irs::by_term>(root, "duplicated", "abcd"); // 1,5,11,21,27,31
+    append<irs::by_term>(root, "same", "xyz"); // 1..32
+    append<irs::by_term>(root, "duplicated", "vczc"); // 2,3,8,14,17,19,24
+    check_query(root, docs_t{}, rdr);
+  }
+
+  // duplicated=abcd AND same=xyz (leapfrogging unless dense intersection is requested)
+  {
+    irs::And root;
+    ASSERT_FALSE(root.dense_intersection());
+    append<irs::by_term>(root, "duplicated", "abcd"); // 1,5,11,21,27,31
+    append<irs::by_term>(root, "same", "xyz"); // 1..32
+
+    auto& segment = rdr[0];
+    {
+      auto it = root.prepare(rdr)->execute(segment);
+      ASSERT_NE(nullptr, dynamic_cast<irs::conjunction<irs::doc_iterator::ptr>*>(it.get()));
+      ASSERT_EQ(nullptr, dynamic_cast<irs::bitset_doc_iterator*>(it.get()));
+    }
+
+    root.dense_intersection(true);
+    {
+      auto it = root.prepare(rdr)->execute(segment);
+      ASSERT_EQ(nullptr, dynamic_cast<irs::conjunction<irs::doc_iterator::ptr>*>(it.get()));
+      ASSERT_NE(nullptr, dynamic_cast<irs::bitset_doc_iterator*>(it.get()));
+    }
+
+    check_query(root, docs_t{ 1, 5, 11, 21, 27, 31 }, rdr);
+  }
 }
 
 TEST_P(boolean_filter_test_case, not_standalone_sequential_ordered) {
@@ -0,0 +1,306 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tests_shared.hpp"
+#include "filter_test_case_base.hpp"
+#include "index/bkd_utils.hpp"
+#include "search/boolean_filter.hpp"
+#include "search/column_filter.hpp"
+#include "search/term_filter.hpp"
+
+namespace {
+
+irs::by_column_range make_filter(
+    const irs::string_ref& field,
+    int64_t min, irs::BoundType min_type,
+    int64_t max, irs::BoundType max_type) {
+  irs::by_column_range filter;
+  *filter.mutable_field() = field;
+  auto& range = filter.mutable_options()->range;
+  range.min = tests::encode_point(min);
+  range.min_type = min_type;
+  range.max = tests::encode_point(max);
+  range.max_type = max_type;
+  return filter;
+}
+
+irs::by_column_terms make_filter(
+    const irs::string_ref& field,
+    std::initializer_list<int64_t> values) {
+  irs::by_column_terms filter;
+  *filter.mutable_field() = field;
+  for (auto value : values) {
+    filter.mutable_options()->terms.emplace(tests::encode_point(value));
+  }
+  return filter;
+}
+
+class column_filter_test_case : public tests::filter_test_case_base {
+ protected:
+  static constexpr size_t DOCS_COUNT = 1000;
+
+  // document 'i' stores 'i' in the "value" column and indexes "rare" into
+  // the "tag" field if 'i' is a multiple of 100, "common" otherwise
+  void add_documents() {
+    auto writer = open_writer();
+
+    {
+      tests::templates::bytes_field value("value");
+      tests::templates::bytes_field tag("tag");
+
+      auto ctx = writer->documents();
+
+      for (size_t i = 0; i < DOCS_COUNT; ++i) {
+        auto doc = ctx.insert();
+        value.value(tests::encode_point(int64_t(i)));
+        tag.value(irs::ref_cast<irs::byte_type>(
+          irs::string_ref(i % 100 ? "common" : "rare")));
+        ASSERT_TRUE(doc.insert<irs::Action::STORE>(value));
+        ASSERT_TRUE(doc.insert<irs::Action::INDEX>(tag));
+      }
+    }
+
+    writer->commit();
+  }
+};
+
+TEST_P(column_filter_test_case, by_column_range) {
+  add_documents();
+  auto rdr = open_reader();
+  ASSERT_EQ(1, rdr->size());
+
+  // [250..300)
+  {
+    docs_t expected;
+    for (irs::doc_id_t i = 250; i < 300; ++i) {
+      expected.push_back(i + irs::doc_limits::min());
+    }
+    check_query(
+      make_filter("value", 250, irs::BoundType::INCLUSIVE,
+                  300, irs::BoundType::EXCLUSIVE),
+      expected, costs_t{ DOCS_COUNT }, *rdr);
+  }
+
+  // (-inf..9]
+  {
+    auto filter = make_filter("value", 0, irs::BoundType::UNBOUNDED,
+                              9, irs::BoundType::INCLUSIVE);
+    check_query(filter, docs_t{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 }, *rdr);
+  }
+
+  // (997..+inf)
+  {
+    auto filter = make_filter("value", 997, irs::BoundType::EXCLUSIVE,
+                              0, irs::BoundType::UNBOUNDED);
+    check_query(filter, docs_t{ 999, 1000 }, *rdr);
+  }
+
+  // empty range
+  {
+    auto filter = make_filter("value", 10, irs::BoundType::INCLUSIVE,
+                              5, irs::BoundType::INCLUSIVE);
+    check_query(filter, docs_t{}, *rdr);
+  }
+
+  // missing column
+  {
+    auto filter = make_filter("missing", 0, irs::BoundType::UNBOUNDED,
+                              0, irs::BoundType::UNBOUNDED);
+    check_query(filter, docs_t{}, *rdr);
+  }
+}
+
+TEST_P(column_filter_test_case, by_column_terms) {
+  add_documents();
+  auto rdr = open_reader();
+  ASSERT_EQ(1, rdr->size());
+
+  check_query(make_filter("value", { 5, 500, -1, 2000 }),
+              docs_t{ 6, 501 }, costs_t{ DOCS_COUNT }, *rdr);
+  check_query(make_filter("value", { 2000 }), docs_t{}, *rdr);
+  check_query(make_filter("missing", { 5 }), docs_t{}, *rdr);
+  check_query(irs::by_column_terms(), docs_t{}, *rdr);
+}
+
+TEST_P(column_filter_test_case, verify_candidates) {
+  add_documents();
+  auto rdr = open_reader();
+  ASSERT_EQ(1, rdr->size());
+
+  irs::And root;
+  {
+    auto& tag = root.add<irs::by_term>();
+    *tag.mutable_field() = "tag";
+    tag.mutable_options()->term = irs::ref_cast<irs::byte_type>(irs::string_ref("rare"));
+  }
+  {
+    auto& value = root.add<irs::by_column_range>();
+    *value.mutable_field() = "value";
+    auto& range = value.mutable_options()->range;
+    range.min = tests::encode_point(250);
+    range.min_type = irs::BoundType::INCLUSIVE;
+    range.max = tests::encode_point(750);
+    range.max_type = irs::BoundType::INCLUSIVE;
+  }
+
+  // the selective term leads the conjunction, column values are checked
+  // for its candidates only
+  check_query(root, docs_t{ 301, 401, 501, 601, 701 },
+              costs_t{ DOCS_COUNT / 100 }, *rdr);
+}
+
+TEST_P(column_filter_test_case, two_phase) {
+  add_documents();
+  auto rdr = open_reader();
+  ASSERT_EQ(1, rdr->size());
+  auto& segment = (*rdr)[0];
+
+  auto prepared = make_filter("value", 250, irs::BoundType::INCLUSIVE,
+                              750, irs::BoundType::INCLUSIVE).prepare(*rdr);
+  ASSERT_NE(nullptr, prepared);
+
+  // standalone iterator looks for the next accepted document
+  {
+    auto it = prepared->execute(segment);
+    ASSERT_EQ(251, it->seek(101));
+    ASSERT_EQ(251, it->value());
+  }
+
+  // non-leading leg of a conjunction reports a rejected candidate via
+  // a lower bound without scanning the column
+  {
+    auto it = prepared->execute(segment);
+    auto* phase = irs::get_mutable<irs::two_phase>(it.get());
+    ASSERT_NE(nullptr, phase);
+    ASSERT_FALSE(phase->enabled);
+    phase->enabled = true;
+
+    ASSERT_EQ(102, it->seek(101));
+    ASSERT_EQ(102, it->seek(101));
+    ASSERT_EQ(103, it->seek(102));
+    ASSERT_EQ(300, it->seek(299));
+    ASSERT_EQ(300, it->value());
+    ASSERT_EQ(301, it->seek(300));
+    ASSERT_EQ(301, it->seek(301));
+    ASSERT_TRUE(it->next());
+    ASSERT_EQ(302, it->value());
+    ASSERT_EQ(751, it->seek(751));
+    ASSERT_EQ(753, it->seek(752));
+    ASSERT_FALSE(it->next());
+    ASSERT_TRUE(irs::doc_limits::eof(it->value()));
+  }
+
+  // conjunction enables two-phase verification for non-leading legs only
+  {
+    irs::And root;
+    {
+      auto& tag = root.add<irs::by_term>();
+      *tag.mutable_field() = "tag";
+      tag.mutable_options()->term = irs::ref_cast<irs::byte_type>(irs::string_ref("rare"));
+    }
+    {
+      auto& value = root.add<irs::by_column_range>();
+      *value.mutable_field() = "value";
+      auto& range = value.mutable_options()->range;
+      range.min = tests::encode_point(250);
+      range.min_type = irs::BoundType::INCLUSIVE;
+      range.max = tests::encode_point(750);
+      range.max_type = irs::BoundType::INCLUSIVE;
+    }
+
+    auto it = root.prepare(*rdr)->execute(segment);
+    ASSERT_EQ(301, it->seek(2));
+    ASSERT_EQ(401, it->seek(302));
+    ASSERT_TRUE(it->next());
+    ASSERT_EQ(501, it->value());
+  }
+}
+
+TEST(by_column_range, ctor) {
+  irs::by_column_range filter;
+  ASSERT_EQ(irs::type<irs::by_column_range>::id(), filter.type());
+  ASSERT_EQ(irs::by_column_range_options{}, filter.options());
+  ASSERT_TRUE(filter.field().empty());
+  ASSERT_EQ(irs::no_boost(), filter.boost());
+}
+
+TEST(by_column_range, equal) {
+  ASSERT_EQ(irs::by_column_range(), irs::by_column_range());
+
+  {
+    auto q0 = make_filter("value", 1, irs::BoundType::INCLUSIVE, 5, irs::BoundType::EXCLUSIVE);
+    auto q1 = make_filter("value", 1, irs::BoundType::INCLUSIVE, 5, irs::BoundType::EXCLUSIVE);
+    ASSERT_EQ(q0, q1);
+    ASSERT_EQ(q0.hash(), q1.hash());
+  }
+
+  {
+    auto q0 = make_filter("value", 1, irs::BoundType::INCLUSIVE, 5, irs::BoundType::EXCLUSIVE);
+    auto q1 = make_filter("value", 1, irs::BoundType::INCLUSIVE, 5, irs::BoundType::INCLUSIVE);
+    ASSERT_NE(q0, q1);
+  }
+
+  {
+    auto q0 = make_filter("value", 1, irs::BoundType::INCLUSIVE, 5, irs::BoundType::EXCLUSIVE);
+    auto q1 = make_filter("value1", 1, irs::BoundType::INCLUSIVE, 5, irs::BoundType::EXCLUSIVE);
+    ASSERT_NE(q0, q1);
+  }
+}
+
+TEST(by_column_terms, ctor) {
+  irs::by_column_terms filter;
+  ASSERT_EQ(irs::type<irs::by_column_terms>::id(), filter.type());
+  ASSERT_EQ(irs::by_column_terms_options{}, filter.options());
+  ASSERT_TRUE(filter.field().empty());
+  ASSERT_EQ(irs::no_boost(), filter.boost());
+}
+
+TEST(by_column_terms, equal) {
+  ASSERT_EQ(irs::by_column_terms(), irs::by_column_terms());
+
+  {
+    auto q0 = make_filter("value", { 1, 2 });
+    auto q1 = make_filter("value", { 2, 1 });
+    ASSERT_EQ(q0, q1);
+    ASSERT_EQ(q0.hash(), q1.hash());
+  }
+
+  {
+    auto q0 = make_filter("value", { 1, 2 });
+    auto q1 = make_filter("value", { 1 });
+    ASSERT_NE(q0, q1);
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(
+  column_filter_test,
+  column_filter_test_case,
+  ::testing::Combine(
+    ::testing::Values(
+      &tests::memory_directory,
+      &tests::fs_directory,
+      &tests::mmap_directory
+    ),
+    ::testing::Values("1_0")
+  ),
+  tests::to_string
+);
+
+}
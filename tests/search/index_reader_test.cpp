@@ -26,6 +26,7 @@
 #include "formats/formats_10.hpp"
 #include "index/index_writer.hpp"
 #include "store/memory_directory.hpp"
+#include "search/term_filter.hpp"
 #include "index/doc_generator.hpp"
 #include "index/index_tests.hpp"
 #include "utils/version_utils.hpp"
@@ -313,6 +314,87 @@ TEST(directory_reader_test, open) {
   ASSERT_EQ(rdr.end(), sub);
 }
 
+TEST(directory_reader_test, open_concurrently) {
+  tests::json_doc_generator gen(
+    test_base::resource("simple_sequential.json"),
+    [] (tests::document& doc, const std::string& name, const tests::json_doc_generator::json_value& data) {
+    if (tests::json_doc_generator::ValueType::STRING == data.vt) {
+      doc.insert(std::make_shared<tests::templates::string_field>(
+        irs::string_ref(name),
+        data.str
+      ));
+    }
+  });
+
+  irs::memory_directory dir;
+  auto codec_ptr = irs::formats::get("1_0");
+  ASSERT_NE(nullptr, codec_ptr);
+
+  // create index with a segment per document
+  {
+    auto writer = irs::index_writer::make(dir, codec_ptr, irs::OM_CREATE);
+
+    for (const tests::document* doc; (doc = gen.next());) {
+      ASSERT_TRUE(insert(*writer,
+        doc->indexed.begin(), doc->indexed.end(),
+        doc->stored.begin(), doc->stored.end()
+      ));
+      writer->commit();
+    }
+  }
+
+  irs::async_utils::thread_pool pool(4, 4);
+  auto expected = irs::directory_reader::open(dir, codec_ptr);
+  auto rdr = irs::directory_reader::open(dir, codec_ptr, &pool);
+  ASSERT_FALSE(!rdr);
+  ASSERT_LT(1, rdr.size());
+  ASSERT_EQ(expected.size(), rdr.size());
+  ASSERT_EQ(expected.docs_count(), rdr.docs_count());
+  ASSERT_EQ(expected.live_docs_count(), rdr.live_docs_count());
+  ASSERT_EQ(expected.meta().filename, rdr.meta().filename);
+
+  // segments are opened in the order of the index meta
+  for (size_t i = 0, size = rdr.size(); i < size; ++i) {
+    ASSERT_EQ(expected[i].docs_count(), rdr[i].docs_count());
+    ASSERT_EQ(rdr.meta().meta.segment(i).meta.docs_count, rdr[i].docs_count());
+
+    const auto* expected_column = expected[i].column_reader("name");
+    const auto* column = rdr[i].column_reader("name");
+    ASSERT_NE(nullptr, expected_column);
+    ASSERT_NE(nullptr, column);
+    auto expected_values = expected_column->values();
+    auto values = column->values();
+    irs::bytes_ref expected_value;
+    irs::bytes_ref actual_value;
+    ASSERT_TRUE(expected_values(1, expected_value));
+    ASSERT_TRUE(values(1, actual_value));
+    ASSERT_EQ(expected_value, actual_value);
+  }
+
+  // reopen reuses unchanged segments
+  {
+    auto writer = irs::index_writer::make(dir, codec_ptr, irs::OM_APPEND);
+    irs::by_term remove_doc1;
+    *remove_doc1.mutable_field() = "name";
+    remove_doc1.mutable_options()->term = irs::ref_cast<irs::byte_type>(irs::string_ref("A"));
+    writer->documents().remove(remove_doc1);
+    writer->commit();
+  }
+
+  // the fully removed first segment is dropped, the others are reused
+  auto reopened = rdr.reopen(codec_ptr, &pool);
+  ASSERT_NE(rdr, reopened);
+  ASSERT_EQ(rdr.size() - 1, reopened.size());
+  ASSERT_EQ(rdr.docs_count() - 1, reopened.docs_count());
+  ASSERT_EQ(rdr.live_docs_count() - 1, reopened.live_docs_count());
+
+  for (size_t i = 0, size = reopened.size(); i < size; ++i) {
+    ASSERT_EQ(
+      static_cast<const irs::segment_reader&>(rdr[i + 1]),
+      static_cast<const irs::segment_reader&>(reopened[i]));
+  }
+}
+
 // ----------------------------------------------------------------------------
 // --SECTION--                                                   Segment reader 
 // ----------------------------------------------------------------------------
@@ -0,0 +1,173 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include <numeric>
+
+#include "tests_shared.hpp"
+#include "index/bkd_utils.hpp"
+#include "index/index_tests.hpp"
+#include "search/point_range_filter.hpp"
+#include "search/term_filter.hpp"
+#include "utils/bkd_tree.hpp"
+
+namespace {
+
+//////////////////////////////////////////////////////////////////////////////
+/// @class point_field
+/// @brief field with a single 1-dimensional point indexed into a bkd tree
+//////////////////////////////////////////////////////////////////////////////
+class point_field final : public tests::field_base {
+ public:
+  explicit point_field(const irs::string_ref& name) {
+    this->name(name);
+  }
+
+  void value(int64_t value) { value_ = tests::encode_point(value); }
+
+  virtual const irs::flags& features() const override {
+    static const irs::flags features{ irs::type<irs::bkd_tree>::get() };
+    return features;
+  }
+
+  virtual irs::token_stream& get_tokens() const override {
+    stream_.reset(irs::bytes_ref(value_));
+    return stream_;
+  }
+
+  virtual bool write(irs::data_output&) const override {
+    return false;
+  }
+
+ private:
+  irs::bstring value_;
+  mutable irs::string_token_stream stream_;
+}; // point_field
+
+irs::by_point_range make_filter(
+    const irs::string_ref& field,
+    int64_t min, int64_t max) {
+  irs::by_point_range filter;
+  *filter.mutable_field() = field;
+  filter.mutable_options()->min = tests::encode_point(min);
+  filter.mutable_options()->max = tests::encode_point(max);
+  return filter;
+}
+
+class point_range_filter_test_case : public tests::index_test_base {
+ protected:
+  static constexpr size_t DOCS_COUNT = 3000; // several leaves per tree
+
+  // document 'i' has point 'i' and is tagged "even" or "odd"
+  void add_segment(irs::index_writer& writer) {
+    point_field ts("ts");
+    tests::templates::string_field tag("tag");
+    auto ctx = writer.documents();
+
+    for (size_t i = 0; i < DOCS_COUNT; ++i) {
+      auto doc = ctx.insert();
+      ts.value(int64_t(i));
+      tag.value(0 == i % 2 ? "even" : "odd");
+      ASSERT_TRUE(doc.insert<irs::Action::INDEX>(ts));
+      ASSERT_TRUE(doc.insert<irs::Action::INDEX>(tag));
+    }
+  }
+
+  // @returns points of documents matched by a filter, i.e. 'doc - 1'
+  static std::vector<int64_t> execute(
+      const irs::index_reader& reader,
+      const irs::filter& filter) {
+    std::vector<int64_t> points;
+    auto prepared = filter.prepare(reader);
+
+    for (auto& segment : reader) {
+      for (auto it = prepared->execute(segment); it->next(); ) {
+        points.push_back(int64_t(it->value() - irs::doc_limits::min()));
+      }
+    }
+
+    return points;
+  }
+};
+
+TEST_P(point_range_filter_test_case, deleted_docs) {
+  auto writer = open_writer();
+  add_segment(*writer);
+  writer->commit();
+
+  std::vector<int64_t> all(1000);
+  std::iota(all.begin(), all.end(), 1000);
+  std::vector<int64_t> even;
+  std::copy_if(all.begin(), all.end(), std::back_inserter(even),
+               [](int64_t v) { return 0 == v % 2; });
+
+  {
+    auto reader = irs::directory_reader::open(dir(), codec());
+    ASSERT_EQ(1, reader.size());
+    ASSERT_EQ(all, execute(reader, make_filter("ts", 1000, 1999)));
+  }
+
+  // remove odd documents
+  {
+    auto odd = irs::memory::make_unique<irs::by_term>();
+    *odd->mutable_field() = "tag";
+    odd->mutable_options()->term = irs::ref_cast<irs::byte_type>(irs::string_ref("odd"));
+    writer->documents().remove(irs::filter::ptr(std::move(odd)));
+  }
+  writer->commit();
+
+  {
+    auto reader = irs::directory_reader::open(dir(), codec());
+    ASSERT_EQ(1, reader.size());
+    ASSERT_EQ(DOCS_COUNT/2, reader.live_docs_count());
+    ASSERT_EQ(even, execute(reader, make_filter("ts", 1000, 1999)));
+    ASSERT_EQ(std::vector<int64_t>{ 0 }, execute(reader, make_filter("ts", 0, 1)));
+    ASSERT_TRUE(execute(reader, make_filter("ts", 1, 1)).empty());
+
+    // iterator still seeks over live documents only
+    auto prepared = make_filter("ts", 0, DOCS_COUNT).prepare(reader);
+    auto it = prepared->execute(reader[0]);
+    ASSERT_EQ(irs::doc_limits::min() + 2, it->seek(irs::doc_limits::min() + 1));
+    ASSERT_EQ(irs::doc_limits::min() + 4, it->seek(irs::doc_limits::min() + 3));
+  }
+}
+
+// Separate definition as MSVC parser fails to do conditional defines in macro expansion
+#if defined(IRESEARCH_SSE2)
+const auto point_range_filter_test_values = ::testing::Values(tests::format_info{"1_6", "1_0"},
+                                                              tests::format_info{"1_6simd", "1_0"});
+#else
+const auto point_range_filter_test_values = ::testing::Values(tests::format_info{"1_6", "1_0"});
+#endif
+
+INSTANTIATE_TEST_CASE_P(
+  point_range_filter_test,
+  point_range_filter_test_case,
+  ::testing::Combine(
+    ::testing::Values(
+      &tests::memory_directory,
+      &tests::fs_directory,
+      &tests::mmap_directory
+    ),
+    point_range_filter_test_values
+  ),
+  tests::to_string
+);
+
+}
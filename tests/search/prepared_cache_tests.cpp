@@ -0,0 +1,295 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "tests_shared.hpp"
+#include "filter_test_case_base.hpp"
+#include "index/index_tests.hpp"
+#include "search/boolean_filter.hpp"
+#include "search/prepared_cache.hpp"
+#include "search/score.hpp"
+#include "search/term_filter.hpp"
+
+namespace {
+
+std::shared_ptr<const irs::filter> make_term(
+    const irs::string_ref& field,
+    const irs::string_ref& term) {
+  auto filter = std::make_shared<irs::by_term>();
+  *filter->mutable_field() = field;
+  filter->mutable_options()->term = irs::ref_cast<irs::byte_type>(term);
+  return filter;
+}
+
+std::vector<irs::doc_id_t> execute(
+    const irs::index_reader& reader,
+    const irs::filter::prepared& query,
+    const irs::order::prepared& ord) {
+  std::vector<irs::doc_id_t> docs;
+
+  for (auto& segment : reader) {
+    for (auto it = query.execute(segment, ord); it->next(); ) {
+      docs.push_back(it->value());
+    }
+  }
+
+  return docs;
+}
+
+class prepared_cache_test : public tests::index_test_base {
+ protected:
+  void add_segment() {
+    tests::json_doc_generator gen(
+      resource("simple_sequential.json"),
+      &tests::generic_json_field_factory);
+    index_test_base::add_segment(gen, irs::OM_CREATE | irs::OM_APPEND);
+  }
+};
+
+TEST_P(prepared_cache_test, disabled) {
+  add_segment();
+  auto reader = static_cast<irs::index_reader::ptr>(open_reader());
+
+  irs::prepared_cache cache(0);
+  ASSERT_EQ(0, cache.max_size());
+
+  auto filter = make_term("name", "A");
+  auto query0 = cache.prepare(reader, filter);
+  ASSERT_NE(nullptr, query0);
+  auto query1 = cache.prepare(reader, filter);
+  ASSERT_NE(nullptr, query1);
+  ASSERT_NE(query0, query1);
+  ASSERT_EQ(0, cache.size());
+  ASSERT_EQ(0, cache.hits());
+  ASSERT_EQ(0, cache.misses());
+  ASSERT_EQ(std::vector<irs::doc_id_t>{ 1 }, execute(*reader, *query0, cache.order()));
+}
+
+TEST_P(prepared_cache_test, hit) {
+  add_segment();
+  auto reader = static_cast<irs::index_reader::ptr>(open_reader());
+
+  irs::prepared_cache cache(4);
+
+  auto query0 = cache.prepare(reader, make_term("name", "A"));
+  ASSERT_NE(nullptr, query0);
+  ASSERT_EQ(1, cache.size());
+  ASSERT_EQ(0, cache.hits());
+  ASSERT_EQ(1, cache.misses());
+
+  // equal filter
+  auto query1 = cache.prepare(reader, make_term("name", "A"));
+  ASSERT_EQ(query0, query1);
+  ASSERT_EQ(1, cache.size());
+  ASSERT_EQ(1, cache.hits());
+  ASSERT_EQ(1, cache.misses());
+  ASSERT_EQ(std::vector<irs::doc_id_t>{ 1 }, execute(*reader, *query1, cache.order()));
+
+  // different filter
+  auto query2 = cache.prepare(reader, make_term("name", "B"));
+  ASSERT_NE(query0, query2);
+  ASSERT_EQ(2, cache.size());
+  ASSERT_EQ(1, cache.hits());
+  ASSERT_EQ(2, cache.misses());
+  ASSERT_EQ(std::vector<irs::doc_id_t>{ 2 }, execute(*reader, *query2, cache.order()));
+
+  const auto stats = cache.stats();
+  ASSERT_EQ(2, stats.size);
+  ASSERT_EQ(2, stats.weight);
+  ASSERT_EQ(4, stats.max_weight);
+  ASSERT_EQ(1, stats.hits);
+  ASSERT_EQ(2, stats.misses);
+
+  // queries of another reader are kept
+  cache.clear(static_cast<irs::index_reader::ptr>(open_reader()));
+  ASSERT_EQ(2, cache.size());
+
+  cache.clear(reader);
+  ASSERT_EQ(0, cache.size());
+  ASSERT_NE(query0, cache.prepare(reader, make_term("name", "A")));
+  ASSERT_EQ(1, cache.size());
+
+  cache.clear();
+  ASSERT_EQ(0, cache.size());
+  ASSERT_NE(query0, cache.prepare(reader, make_term("name", "A")));
+  ASSERT_EQ(1, cache.size());
+}
+
+TEST_P(prepared_cache_test, boost) {
+  add_segment();
+  auto reader = static_cast<irs::index_reader::ptr>(open_reader());
+
+  irs::order ord;
+  ord.add<tests::sort::boost>(false);
+  irs::prepared_cache cache(ord.prepare(), 4);
+  ASSERT_EQ(1, cache.order().size());
+
+  auto filter = make_term("name", "A");
+  auto query0 = cache.prepare(reader, filter);
+  ASSERT_EQ(irs::no_boost(), query0->boost());
+
+  // external boost
+  auto query1 = cache.prepare(reader, filter, 2.f);
+  ASSERT_NE(query0, query1);
+  ASSERT_EQ(2.f, query1->boost());
+  ASSERT_EQ(query1, cache.prepare(reader, filter, 2.f));
+
+  // boost of a filter
+  auto boosted = std::make_shared<irs::by_term>();
+  *boosted->mutable_field() = "name";
+  boosted->mutable_options()->term = irs::ref_cast<irs::byte_type>(irs::string_ref("A"));
+  boosted->boost(2.f);
+  auto query2 = cache.prepare(reader, boosted);
+  ASSERT_NE(query0, query2);
+  ASSERT_NE(query1, query2);
+  ASSERT_EQ(2.f, query2->boost());
+  ASSERT_EQ(query2, cache.prepare(reader, boosted));
+
+  ASSERT_EQ(3, cache.size());
+  ASSERT_EQ(2, cache.hits());
+  ASSERT_EQ(3, cache.misses());
+}
+
+TEST_P(prepared_cache_test, nested_boost) {
+  add_segment();
+  auto reader = static_cast<irs::index_reader::ptr>(open_reader());
+
+  irs::order ord;
+  ord.add<tests::sort::boost>(false);
+  irs::prepared_cache cache(ord.prepare(), 4);
+
+  auto make_and = [](irs::boost_t boost) {
+    auto root = std::make_shared<irs::And>();
+    auto& term = root->add<irs::by_term>();
+    *term.mutable_field() = "name";
+    term.mutable_options()->term = irs::ref_cast<irs::byte_type>(irs::string_ref("A"));
+    term.boost(boost);
+    return root;
+  };
+
+  // filters differing in boosts of nested filters only are scored differently
+  auto query0 = cache.prepare(reader, make_and(1.f));
+  auto query1 = cache.prepare(reader, make_and(3.f));
+  ASSERT_NE(query0, query1);
+  ASSERT_EQ(query0, cache.prepare(reader, make_and(1.f)));
+  ASSERT_EQ(query1, cache.prepare(reader, make_and(3.f)));
+
+  auto score = [&cache, &reader](const irs::filter::prepared& query) {
+    auto& segment = (*reader)[0];
+    auto it = query.execute(segment, cache.order());
+    auto* score = irs::get<irs::score>(*it);
+    EXPECT_NE(nullptr, score);
+    EXPECT_TRUE(it->next());
+    return cache.order().get<irs::boost_t>(score->evaluate(), 0);
+  };
+
+  ASSERT_EQ(1.f, score(*query0));
+  ASSERT_EQ(3.f, score(*query1));
+}
+
+TEST_P(prepared_cache_test, evict) {
+  add_segment();
+  auto reader = static_cast<irs::index_reader::ptr>(open_reader());
+
+  irs::prepared_cache cache(2);
+
+  auto a = cache.prepare(reader, make_term("name", "A"));
+  auto b = cache.prepare(reader, make_term("name", "B"));
+  ASSERT_EQ(2, cache.size());
+  ASSERT_EQ(a, cache.prepare(reader, make_term("name", "A"))); // 'B' becomes the least recently used
+
+  auto c = cache.prepare(reader, make_term("name", "C"));
+  ASSERT_EQ(2, cache.size());
+  ASSERT_EQ(a, cache.prepare(reader, make_term("name", "A")));
+  ASSERT_EQ(c, cache.prepare(reader, make_term("name", "C")));
+  ASSERT_NE(b, cache.prepare(reader, make_term("name", "B")));
+
+  // evicted query is still valid
+  ASSERT_EQ(std::vector<irs::doc_id_t>{ 2 }, execute(*reader, *b, cache.order()));
+
+  cache.max_size(1);
+  ASSERT_EQ(1, cache.size());
+
+  cache.max_size(0);
+  ASSERT_EQ(0, cache.size());
+  ASSERT_NE(a, cache.prepare(reader, make_term("name", "A")));
+  ASSERT_EQ(0, cache.size());
+}
+
+TEST_P(prepared_cache_test, generation) {
+  add_segment();
+  auto reader0 = open_reader();
+
+  irs::prepared_cache cache(4);
+
+  auto filter = make_term("same", "xyz");
+  auto query0 = cache.prepare(static_cast<irs::index_reader::ptr>(reader0), filter);
+  const auto docs0 = execute(*reader0, *query0, cache.order());
+  ASSERT_EQ(reader0.live_docs_count(), docs0.size());
+  ASSERT_EQ(query0, cache.prepare(static_cast<irs::index_reader::ptr>(reader0), filter));
+
+  // copies of a reader share a generation
+  auto copy = reader0;
+  ASSERT_EQ(query0, cache.prepare(static_cast<irs::index_reader::ptr>(copy), filter));
+
+  add_segment();
+  auto reader1 = reader0.reopen();
+  ASSERT_NE(reader0, reader1);
+  ASSERT_EQ(2, reader1.size());
+
+  // new generation
+  auto query1 = cache.prepare(static_cast<irs::index_reader::ptr>(reader1), filter);
+  ASSERT_NE(query0, query1);
+  ASSERT_EQ(2, cache.size());
+  ASSERT_EQ(reader1.live_docs_count(), execute(*reader1, *query1, cache.order()).size());
+  ASSERT_EQ(query1, cache.prepare(static_cast<irs::index_reader::ptr>(reader1), filter));
+
+  // queries for the previous generation don't evict the ones of the new one
+  ASSERT_EQ(query0, cache.prepare(static_cast<irs::index_reader::ptr>(reader0), filter));
+  ASSERT_EQ(query1, cache.prepare(static_cast<irs::index_reader::ptr>(reader1), filter));
+  ASSERT_EQ(2, cache.size());
+  ASSERT_EQ(docs0, execute(*reader0, *query0, cache.order()));
+
+  // queries of the previous generation are evicted as least recently used
+  cache.prepare(static_cast<irs::index_reader::ptr>(reader1), make_term("name", "A"));
+  cache.prepare(static_cast<irs::index_reader::ptr>(reader1), make_term("name", "B"));
+  cache.prepare(static_cast<irs::index_reader::ptr>(reader1), make_term("name", "C"));
+  ASSERT_EQ(4, cache.size());
+  ASSERT_EQ(query1, cache.prepare(static_cast<irs::index_reader::ptr>(reader1), filter));
+  ASSERT_NE(query0, cache.prepare(static_cast<irs::index_reader::ptr>(reader0), filter));
+
+  // evicted query is still valid
+  ASSERT_EQ(docs0, execute(*reader0, *query0, cache.order()));
+}
+
+INSTANTIATE_TEST_CASE_P(
+  prepared_cache_test,
+  prepared_cache_test,
+  ::testing::Combine(
+    ::testing::Values(
+      &tests::memory_directory,
+      &tests::mmap_directory
+    ),
+    ::testing::Values("1_0")
+  ),
+  tests::to_string
+);
+
+}
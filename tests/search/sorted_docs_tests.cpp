@@ -0,0 +1,232 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tests_shared.hpp"
+#include "index/comparer.hpp"
+#include "index/bkd_utils.hpp"
+#include "index/index_tests.hpp"
+#include "search/all_filter.hpp"
+#include "search/sorted_docs.hpp"
+#include "search/term_filter.hpp"
+
+namespace {
+
+// descending order of encoded values, i.e. latest first
+struct greater_comparer final : irs::comparer {
+  virtual bool less(const irs::bytes_ref& lhs, const irs::bytes_ref& rhs) const override {
+    return rhs < lhs;
+  }
+};
+
+class sorted_docs_test : public tests::index_test_base {
+ protected:
+  static constexpr size_t SEGMENTS = 2;
+  static constexpr size_t DOCS_PER_SEGMENT = 500;
+
+  struct entry {
+    int64_t ts;
+    int64_t group;
+    bool even;
+  };
+
+  // every segment is sorted by the "ts" primary sort key, latest first,
+  // timestamps are unique and inserted in a shuffled order
+  void add_segments() {
+    irs::index_writer::init_options opts;
+    opts.comparator = &less_;
+    auto writer = open_writer(irs::OM_CREATE, opts);
+
+    for (size_t segment = 0; segment < SEGMENTS; ++segment) {
+      {
+        tests::templates::bytes_field ts("ts");
+        tests::templates::bytes_field group("group");
+        tests::templates::bytes_field tag("tag");
+        auto ctx = writer->documents();
+
+        for (size_t i = 0; i < DOCS_PER_SEGMENT; ++i) {
+          const entry e{
+            int64_t(segment*DOCS_PER_SEGMENT + (i*7919) % DOCS_PER_SEGMENT),
+            int64_t(i % 5),
+            0 == i % 2 };
+          entries_.push_back(e);
+
+          auto doc = ctx.insert();
+          ts.value(tests::encode_point(e.ts));
+          group.value(tests::encode_point(e.group));
+          tag.value(irs::ref_cast<irs::byte_type>(irs::string_ref(e.even ? "even" : "odd")));
+          ASSERT_TRUE(doc.insert<irs::Action::STORE_SORTED>(ts));
+          ASSERT_TRUE(doc.insert<irs::Action::STORE>(group));
+          ASSERT_TRUE(doc.insert<irs::Action::INDEX>(tag));
+        }
+      }
+
+      writer->commit();
+    }
+  }
+
+  greater_comparer less_;
+  std::vector<entry> entries_;
+};
+
+TEST_P(sorted_docs_test, latest_first) {
+  add_segments();
+  auto reader = irs::directory_reader::open(dir(), codec());
+  ASSERT_EQ(SEGMENTS, reader.size());
+
+  constexpr size_t k = 10;
+  irs::all filter;
+  auto query = filter.prepare(reader);
+
+  irs::sorted_docs_collector collector({ { "", &less_, false } }, k);
+  for (size_t i = 0; i < reader.size(); ++i) {
+    auto docs = query->execute(reader[i]);
+    collector.collect(i, reader[i], *docs);
+  }
+
+  // collection stops right after 'k' hits of a segment
+  ASSERT_LE(collector.visited(), SEGMENTS*(k + 1));
+
+  auto docs = collector.finish();
+  ASSERT_EQ(k, docs.size());
+  for (size_t i = 0; i < k; ++i) {
+    ASSERT_EQ(1, docs[i].values.size());
+    ASSERT_EQ(tests::encode_point(int64_t(SEGMENTS*DOCS_PER_SEGMENT - 1 - i)), docs[i].values[0]);
+    ASSERT_EQ(SEGMENTS - 1, docs[i].segment);
+  }
+}
+
+TEST_P(sorted_docs_test, earliest_first) {
+  add_segments();
+  auto reader = irs::directory_reader::open(dir(), codec());
+
+  constexpr size_t k = 10;
+  irs::all filter;
+  auto query = filter.prepare(reader);
+
+  irs::sorted_docs_collector collector({ { "", &less_, true } }, k);
+  for (size_t i = 0; i < reader.size(); ++i) {
+    auto docs = query->execute(reader[i]);
+    collector.collect(i, reader[i], *docs);
+  }
+
+  // order opposite to the one of segments, all documents are visited
+  ASSERT_EQ(SEGMENTS*DOCS_PER_SEGMENT, collector.visited());
+
+  auto docs = collector.finish();
+  ASSERT_EQ(k, docs.size());
+  for (size_t i = 0; i < k; ++i) {
+    ASSERT_EQ(tests::encode_point(int64_t(i)), docs[i].values[0]);
+    ASSERT_EQ(0, docs[i].segment);
+  }
+}
+
+TEST_P(sorted_docs_test, multiple_keys) {
+  add_segments();
+  auto reader = irs::directory_reader::open(dir(), codec());
+
+  irs::by_term filter;
+  *filter.mutable_field() = "tag";
+  filter.mutable_options()->term = irs::ref_cast<irs::byte_type>(irs::string_ref("even"));
+  auto query = filter.prepare(reader);
+
+  // group ascending, then ts ascending
+  std::vector<entry> expected;
+  for (auto& e : entries_) {
+    if (e.even) {
+      expected.push_back(e);
+    }
+  }
+  std::sort(expected.begin(), expected.end(),
+            [](const entry& lhs, const entry& rhs) {
+    return std::make_pair(lhs.group, lhs.ts) < std::make_pair(rhs.group, rhs.ts);
+  });
+
+  for (size_t k : { size_t(0), size_t(1), size_t(7), size_t(100), expected.size() + 1 }) {
+    auto docs = irs::execute_sorted_top_k(
+      reader, *query, { { "group", nullptr, false }, { "", &less_, true } }, k);
+
+    ASSERT_EQ(std::min(k, expected.size()), docs.size());
+    for (size_t i = 0; i < docs.size(); ++i) {
+      ASSERT_EQ(2, docs[i].values.size());
+      ASSERT_EQ(tests::encode_point(expected[i].group), docs[i].values[0]);
+      ASSERT_EQ(tests::encode_point(expected[i].ts), docs[i].values[1]);
+    }
+  }
+
+  // missing column orders documents by (segment, doc)
+  {
+    auto docs = irs::execute_sorted_top_k(
+      reader, *query, { { "missing", nullptr, false } }, 3);
+    ASSERT_EQ(3, docs.size());
+    for (auto& doc : docs) {
+      ASSERT_EQ(1, doc.values.size());
+      ASSERT_TRUE(doc.values[0].empty());
+      ASSERT_EQ(0, doc.segment);
+    }
+    ASSERT_LT(docs[0].doc, docs[1].doc);
+    ASSERT_LT(docs[1].doc, docs[2].doc);
+  }
+}
+
+TEST_P(sorted_docs_test, merge) {
+  add_segments();
+  auto reader = irs::directory_reader::open(dir(), codec());
+
+  constexpr size_t k = 5;
+  irs::all filter;
+  auto query = filter.prepare(reader);
+  const std::vector<irs::sort_key> keys{ { "group", nullptr, true }, { "", &less_, false } };
+
+  // every segment collected by its own collector
+  irs::sorted_docs_collector collector(std::vector<irs::sort_key>(keys), k);
+  for (size_t i = 0; i < reader.size(); ++i) {
+    irs::sorted_docs_collector segment_collector(std::vector<irs::sort_key>(keys), k);
+    auto docs = query->execute(reader[i]);
+    segment_collector.collect(i, reader[i], *docs);
+    collector.merge(std::move(segment_collector));
+  }
+
+  auto expected = irs::execute_sorted_top_k(reader, *query, keys, k);
+  auto docs = collector.finish();
+  ASSERT_EQ(expected.size(), docs.size());
+  for (size_t i = 0; i < docs.size(); ++i) {
+    ASSERT_EQ(expected[i].values, docs[i].values);
+    ASSERT_EQ(expected[i].segment, docs[i].segment);
+    ASSERT_EQ(expected[i].doc, docs[i].doc);
+  }
+  for (auto& doc : docs) {
+    ASSERT_EQ(tests::encode_point(4), doc.values[0]);
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(
+  sorted_docs_test,
+  sorted_docs_test,
+  ::testing::Combine(
+    ::testing::Values(
+      &tests::memory_directory,
+      &tests::mmap_directory
+    ),
+    ::testing::Values("1_5")
+  ),
+  tests::to_string
+);
+
+}
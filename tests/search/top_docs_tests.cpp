@@ -0,0 +1,403 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tests_shared.hpp"
+#include "index/index_tests.hpp"
+#include "filter_test_case_base.hpp"
+#include "search/boolean_filter.hpp"
+#include "search/prefix_filter.hpp"
+#include "search/score.hpp"
+#include "search/term_filter.hpp"
+#include "search/tfidf.hpp"
+#include "search/top_docs.hpp"
+#include "utils/async_utils.hpp"
+
+namespace {
+
+#ifndef IRESEARCH_DLL
+
+class top_docs_test : public tests::index_test_base {
+ protected:
+  void add_segments(size_t count, size_t docs_per_segment) {
+    tests::templates::europarl_doc_template doc;
+    tests::delim_doc_generator gen(resource("europarl.subset.txt"), doc);
+
+    auto writer = open_writer();
+    for (size_t i = 0; i < count; ++i) {
+      tests::limiting_doc_generator limiting_gen(gen, 0, docs_per_segment);
+      add_segment(*writer, limiting_gen);
+    }
+  }
+
+  static irs::filter::prepared::ptr prepare_query(
+      const irs::index_reader& index,
+      const irs::order::prepared& ord) {
+    irs::Or query;
+    {
+      auto& filter = query.add<irs::by_prefix>();
+      *filter.mutable_field() = "body_anl";
+      filter.mutable_options()->term = irs::ref_cast<irs::byte_type>(irs::string_ref("a"));
+    }
+    {
+      auto& filter = query.add<irs::by_term>();
+      *filter.mutable_field() = "body_anl";
+      filter.mutable_options()->term = irs::ref_cast<irs::byte_type>(irs::string_ref("och"));
+    }
+
+    return query.prepare(index, ord);
+  }
+
+  // evaluate all matched documents, then pick best 'k', ranges are evaluated
+  // the same way as by 'execute_top_k' since the order in which disjunctions
+  // sum up scores of sub-iterators depends on whether 'seek' or 'next' was used
+  static std::vector<irs::scored_doc> exhaustive_top_k(
+      const irs::index_reader& index,
+      const irs::filter::prepared& query,
+      const irs::order::prepared& ord,
+      size_t k,
+      size_t max_range_docs = 0) {
+    std::vector<irs::scored_doc> docs;
+    irs::bstring empty_score(ord.score_size(), 0);
+
+    for (auto& range : irs::partition(index, max_range_docs)) {
+      auto it = query.execute(index[range.segment], ord);
+      auto& score = irs::score::get(*it);
+      for (auto doc = it->seek(range.min); doc < range.max;
+           doc = it->next() ? it->value() : irs::doc_limits::eof()) {
+        docs.emplace_back(
+          ord.empty() ? empty_score : irs::bstring(score.evaluate(), ord.score_size()),
+          range.segment, doc);
+      }
+    }
+
+    std::sort(
+      docs.begin(), docs.end(),
+      [&ord](const irs::scored_doc& lhs, const irs::scored_doc& rhs) {
+        if (!ord.empty()) {
+          if (ord.less(lhs.score.c_str(), rhs.score.c_str())) {
+            return true;
+          }
+
+          if (ord.less(rhs.score.c_str(), lhs.score.c_str())) {
+            return false;
+          }
+        }
+
+        return std::make_pair(lhs.segment, lhs.doc) < std::make_pair(rhs.segment, rhs.doc);
+    });
+
+    docs.resize(std::min(k, docs.size()));
+    return docs;
+  }
+
+  static void assert_equal(
+      const std::vector<irs::scored_doc>& expected,
+      const std::vector<irs::scored_doc>& actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      ASSERT_EQ(expected[i].segment, actual[i].segment);
+      ASSERT_EQ(expected[i].doc, actual[i].doc);
+      ASSERT_EQ(expected[i].score, actual[i].score);
+    }
+  }
+};
+
+TEST_P(top_docs_test, collector) {
+  irs::order ord;
+  ord.add<irs::tfidf_sort>(true);
+  auto prepared_order = ord.prepare();
+  ASSERT_EQ(sizeof(float_t), prepared_order.score_size());
+
+  auto score = [](const float_t& value) {
+    return reinterpret_cast<const irs::byte_type*>(&value);
+  };
+
+  irs::top_docs_collector lhs(prepared_order, 3);
+  ASSERT_TRUE(lhs.empty());
+  ASSERT_TRUE(lhs.collect(0, 1, score(1.f)));
+  ASSERT_TRUE(lhs.collect(0, 2, score(3.f)));
+  ASSERT_TRUE(lhs.collect(0, 3, score(2.f)));
+  ASSERT_FALSE(lhs.collect(0, 4, score(0.5f))); // worse than the worst
+  ASSERT_FALSE(lhs.collect(0, 5, score(1.f))); // tie, visited later
+  ASSERT_TRUE(lhs.collect(0, 6, score(4.f)));
+  ASSERT_EQ(3, lhs.size());
+  ASSERT_EQ(6, lhs.visited());
+
+  irs::top_docs_collector rhs(prepared_order, 3);
+  ASSERT_TRUE(rhs.collect(1, 1, score(3.f)));
+  ASSERT_TRUE(rhs.collect(1, 2, score(5.f)));
+
+  lhs.merge(std::move(rhs));
+  ASSERT_TRUE(rhs.empty());
+  ASSERT_EQ(8, lhs.visited());
+
+  const auto docs = lhs.finish();
+  const std::vector<std::tuple<size_t, irs::doc_id_t, float_t>> expected {
+    { 1, 2, 5.f }, { 0, 6, 4.f }, { 0, 2, 3.f }
+  };
+  ASSERT_EQ(expected.size(), docs.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_EQ(std::get<0>(expected[i]), docs[i].segment);
+    ASSERT_EQ(std::get<1>(expected[i]), docs[i].doc);
+    ASSERT_EQ(std::get<2>(expected[i]),
+              *reinterpret_cast<const float_t*>(docs[i].score.c_str()));
+  }
+}
+
+TEST_P(top_docs_test, execute_ordered) {
+  add_segments(7, 100);
+
+  auto reader = irs::directory_reader::open(dir(), codec());
+  ASSERT_EQ(7, reader.size());
+
+  irs::order ord;
+  ord.add<irs::tfidf_sort>(true);
+  auto prepared_order = ord.prepare();
+  auto query = prepare_query(reader, prepared_order);
+  ASSERT_NE(nullptr, query);
+
+  irs::async_utils::thread_pool pool(4);
+
+  for (size_t k : { 0, 1, 10, 100, 100000 }) {
+    SCOPED_TRACE(k);
+    const auto expected = exhaustive_top_k(reader, *query, prepared_order, k);
+    ASSERT_TRUE(0 == k || !expected.empty());
+
+    assert_equal(expected, irs::execute_top_k(reader, *query, prepared_order, k));
+    assert_equal(expected, irs::execute_top_k(reader, *query, prepared_order, k, &pool));
+  }
+}
+
+TEST_P(top_docs_test, execute_unordered) {
+  add_segments(5, 50);
+
+  auto reader = irs::directory_reader::open(dir(), codec());
+  ASSERT_EQ(5, reader.size());
+
+  const auto& prepared_order = irs::order::prepared::unordered();
+  auto query = prepare_query(reader, prepared_order);
+  ASSERT_NE(nullptr, query);
+
+  irs::async_utils::thread_pool pool(3);
+
+  // documents are taken in order of (segment, doc)
+  for (size_t k : { 1, 25, 100000 }) {
+    SCOPED_TRACE(k);
+    const auto expected = exhaustive_top_k(reader, *query, prepared_order, k);
+    ASSERT_FALSE(expected.empty());
+
+    assert_equal(expected, irs::execute_top_k(reader, *query, prepared_order, k));
+    assert_equal(expected, irs::execute_top_k(reader, *query, prepared_order, k, &pool));
+  }
+}
+
+TEST_P(top_docs_test, partition) {
+  add_segments(3, 50);
+
+  auto reader = irs::directory_reader::open(dir(), codec());
+  ASSERT_EQ(3, reader.size());
+
+  for (size_t max_docs : { 0, 1, 7, 50, 51, 1000 }) {
+    SCOPED_TRACE(max_docs);
+    const auto ranges = irs::partition(reader, max_docs);
+    ASSERT_FALSE(ranges.empty());
+
+    // ranges cover every segment without gaps
+    auto range = ranges.begin();
+    for (size_t i = 0; i < reader.size(); ++i) {
+      irs::doc_id_t expected_min = irs::doc_limits::min();
+      for (; range != ranges.end() && range->segment == i; ++range) {
+        ASSERT_EQ(expected_min, range->min);
+        ASSERT_LT(range->min, range->max);
+        ASSERT_TRUE(!max_docs || range->max - range->min <= max_docs);
+        expected_min = range->max;
+      }
+      ASSERT_EQ(irs::doc_limits::min() + reader[i].docs_count(), expected_min);
+    }
+    ASSERT_EQ(ranges.end(), range);
+  }
+}
+
+TEST_P(top_docs_test, execute_ranges) {
+  add_segments(2, 300);
+
+  auto reader = irs::directory_reader::open(dir(), codec());
+  ASSERT_EQ(2, reader.size());
+
+  irs::order ord;
+  ord.add<irs::tfidf_sort>(true);
+  auto prepared_order = ord.prepare();
+  auto query = prepare_query(reader, prepared_order);
+  ASSERT_NE(nullptr, query);
+
+  irs::async_utils::thread_pool pool(4);
+
+  for (size_t max_range_docs : { 1, 13, 64, 299 }) {
+    for (size_t k : { 1, 10, 100000 }) {
+      SCOPED_TRACE(max_range_docs);
+      SCOPED_TRACE(k);
+      const auto expected = exhaustive_top_k(reader, *query, prepared_order, k,
+                                             max_range_docs);
+      ASSERT_FALSE(expected.empty());
+
+      assert_equal(expected, irs::execute_top_k(reader, *query, prepared_order, k,
+                                                nullptr, max_range_docs));
+      assert_equal(expected, irs::execute_top_k(reader, *query, prepared_order, k,
+                                                &pool, max_range_docs));
+    }
+  }
+}
+
+TEST_P(top_docs_test, execute_term) {
+  add_segments(2, 300);
+
+  auto reader = irs::directory_reader::open(dir(), codec());
+  ASSERT_EQ(2, reader.size());
+
+  // single term query is scored a block of postings at a time
+  irs::by_term query;
+  *query.mutable_field() = "body_anl";
+  query.mutable_options()->term = irs::ref_cast<irs::byte_type>(irs::string_ref("the"));
+
+  for (bool normalize : { true, false }) {
+    SCOPED_TRACE(normalize);
+    irs::order ord;
+    ord.add<irs::tfidf_sort>(true, normalize);
+    auto prepared_order = ord.prepare();
+    auto prepared = query.prepare(reader, prepared_order);
+    ASSERT_NE(nullptr, prepared);
+
+    for (size_t max_range_docs : { 0, 13, 128, 299 }) {
+      for (size_t k : { 1, 10, 100000 }) {
+        SCOPED_TRACE(max_range_docs);
+        SCOPED_TRACE(k);
+        const auto expected = exhaustive_top_k(reader, *prepared, prepared_order, k,
+                                               max_range_docs);
+        ASSERT_FALSE(expected.empty());
+
+        assert_equal(expected, irs::execute_top_k(reader, *prepared, prepared_order, k,
+                                                  nullptr, max_range_docs));
+      }
+    }
+  }
+}
+
+TEST_P(top_docs_test, execute_term_multiple_buckets) {
+  add_segments(2, 300);
+
+  auto reader = irs::directory_reader::open(dir(), codec());
+  ASSERT_EQ(2, reader.size());
+
+  irs::by_term query;
+  *query.mutable_field() = "body_anl";
+  query.mutable_options()->term = irs::ref_cast<irs::byte_type>(irs::string_ref("the"));
+
+  // the second bucket doesn't score the query, so the only scorer is
+  // batched while scores of the order are wider than its own
+  irs::order ord;
+  ord.add<irs::tfidf_sort>(true, false);
+  auto& sort = ord.add<tests::sort::custom_sort>(false);
+  sort.prepare_scorer = [](
+      const irs::sub_reader&, const irs::term_reader&,
+      const irs::byte_type*, irs::byte_type*,
+      const irs::attribute_provider&) -> irs::score_function {
+    return {};
+  };
+  auto prepared_order = ord.prepare();
+  ASSERT_EQ(2, prepared_order.size());
+  ASSERT_LT(sizeof(float_t), prepared_order.score_size());
+  auto prepared = query.prepare(reader, prepared_order);
+  ASSERT_NE(nullptr, prepared);
+
+  {
+    auto docs = prepared->execute(reader[0], prepared_order);
+    ASSERT_TRUE(irs::score::get(*docs).is_batched());
+    ASSERT_NE(nullptr, irs::postings_block::get(*docs));
+  }
+
+  for (size_t max_range_docs : { 0, 13, 299 }) {
+    for (size_t k : { 1, 10, 100000 }) {
+      SCOPED_TRACE(max_range_docs);
+      SCOPED_TRACE(k);
+      const auto expected = exhaustive_top_k(reader, *prepared, prepared_order, k,
+                                             max_range_docs);
+      ASSERT_FALSE(expected.empty());
+
+      assert_equal(expected, irs::execute_top_k(reader, *prepared, prepared_order, k,
+                                                nullptr, max_range_docs));
+    }
+  }
+}
+
+TEST_P(top_docs_test, execute_from_pool_thread) {
+  add_segments(3, 50);
+
+  auto reader = irs::directory_reader::open(dir(), codec());
+  ASSERT_EQ(3, reader.size());
+
+  irs::order ord;
+  ord.add<irs::tfidf_sort>(true);
+  auto prepared_order = ord.prepare();
+  auto query = prepare_query(reader, prepared_order);
+  ASSERT_NE(nullptr, query);
+
+  const auto expected = exhaustive_top_k(reader, *query, prepared_order, 10);
+
+  // the only thread of the pool is busy with the query itself,
+  // the query must be evaluated by the calling thread
+  irs::async_utils::thread_pool pool(1);
+  std::vector<irs::scored_doc> actual;
+  std::mutex mutex;
+  std::condition_variable cond;
+  bool done = false;
+
+  ASSERT_TRUE(pool.run([&]() {
+    auto docs = irs::execute_top_k(reader, *query, prepared_order, 10, &pool);
+    std::lock_guard<std::mutex> lock(mutex);
+    actual = std::move(docs);
+    done = true;
+    cond.notify_all();
+  }));
+
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    ASSERT_TRUE(cond.wait_for(lock, std::chrono::seconds(60), [&done]() { return done; }));
+  }
+
+  pool.stop();
+  assert_equal(expected, actual);
+}
+
+INSTANTIATE_TEST_CASE_P(
+  top_docs_test,
+  top_docs_test,
+  ::testing::Combine(
+    ::testing::Values(
+      &tests::memory_directory,
+      &tests::mmap_directory
+    ),
+    ::testing::Values("1_5")
+  ),
+  tests::to_string
+);
+
+#endif // IRESEARCH_DLL
+
+}
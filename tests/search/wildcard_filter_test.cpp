@@ -23,6 +23,7 @@
 #include "tests_shared.hpp"
 #include "filter_test_case_base.hpp"
 #include "search/wildcard_filter.hpp"
+#include "utils/automaton_cache.hpp"
 
 #ifndef IRESEARCH_DLL
 #include "search/term_filter.hpp"
@@ -498,6 +499,56 @@ TEST_P(wildcard_filter_test_case, visit) {
   }
 }
 
+TEST_P(wildcard_filter_test_case, automaton_cache) {
+  // add segment
+  {
+    tests::json_doc_generator gen(
+      resource("simple_sequential_utf8.json"),
+      &tests::generic_json_field_factory);
+    add_segment( gen );
+  }
+
+  auto rdr = open_reader();
+
+  struct cache_provider : irs::attribute_provider {
+    virtual irs::attribute* get_mutable(irs::type_info::type_id type) override {
+      return irs::type<irs::automaton_cache>::id() == type ? &cache : nullptr;
+    }
+
+    irs::automaton_cache cache{ 1 << 20 };
+  } ctx;
+
+  auto count_docs = [&rdr](const irs::filter::prepared& prepared) {
+    size_t count = 0;
+    for (auto& segment : rdr) {
+      for (auto docs = prepared.execute(segment); docs->next(); ) {
+        ++count;
+      }
+    }
+    return count;
+  };
+
+  const auto filter = make_filter("same", "x_z");
+  const auto expected = count_docs(*filter.prepare(rdr));
+  ASSERT_EQ(32, expected);
+
+  ASSERT_EQ(expected, count_docs(*filter.prepare(rdr, irs::order::prepared::unordered(), &ctx)));
+  ASSERT_EQ(0, ctx.cache.hits());
+  ASSERT_EQ(1, ctx.cache.misses());
+  ASSERT_EQ(1, ctx.cache.size());
+
+  // compiled automaton is reused
+  ASSERT_EQ(expected, count_docs(*filter.prepare(rdr, irs::order::prepared::unordered(), &ctx)));
+  ASSERT_EQ(1, ctx.cache.hits());
+  ASSERT_EQ(1, ctx.cache.misses());
+  ASSERT_EQ(1, ctx.cache.size());
+
+  // patterns without an automaton don't touch the cache
+  ASSERT_EQ(expected, count_docs(*make_filter("same", "xyz%").prepare(rdr, irs::order::prepared::unordered(), &ctx)));
+  ASSERT_EQ(1, ctx.cache.hits());
+  ASSERT_EQ(1, ctx.cache.misses());
+}
+
 INSTANTIATE_TEST_CASE_P(
   wildcard_filter_test,
   wildcard_filter_test_case,
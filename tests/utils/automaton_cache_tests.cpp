@@ -0,0 +1,207 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tests_shared.hpp"
+
+#include "utils/automaton_cache.hpp"
+#include "utils/automaton_utils.hpp"
+#include "utils/levenshtein_default_pdp.hpp"
+#include "utils/levenshtein_utils.hpp"
+
+#include <thread>
+
+namespace {
+
+irs::bytes_ref ref(const irs::string_ref& value) {
+  return irs::ref_cast<irs::byte_type>(value);
+}
+
+}
+
+TEST(automaton_cache_test, disabled) {
+  irs::automaton_cache cache(0);
+
+  auto a0 = cache.wildcard(ref("a%c"));
+  ASSERT_NE(nullptr, a0);
+  ASSERT_TRUE(a0->valid);
+  ASSERT_TRUE(irs::accept<irs::byte_type>(a0->acceptor, ref("abbc")));
+  ASSERT_EQ(0, a0->memory); // not estimated unless cached
+
+  auto a1 = cache.wildcard(ref("a%c"));
+  ASSERT_NE(a0, a1);
+  ASSERT_EQ(0, cache.size());
+  ASSERT_EQ(0, cache.memory());
+  ASSERT_EQ(0, cache.hits());
+  ASSERT_EQ(0, cache.misses());
+}
+
+TEST(automaton_cache_test, global) {
+  ASSERT_EQ(0, irs::automaton_cache::global().max_memory());
+  ASSERT_EQ(&irs::automaton_cache::global(), &irs::automaton_cache::from(nullptr));
+
+  struct empty_provider : irs::attribute_provider {
+    virtual irs::attribute* get_mutable(irs::type_info::type_id) override {
+      return nullptr;
+    }
+  } empty;
+  ASSERT_EQ(&irs::automaton_cache::global(), &irs::automaton_cache::from(&empty));
+
+  struct cache_provider : irs::attribute_provider {
+    virtual irs::attribute* get_mutable(irs::type_info::type_id type) override {
+      return irs::type<irs::automaton_cache>::id() == type ? &cache : nullptr;
+    }
+
+    irs::automaton_cache cache{ 1 };
+  } provider;
+  ASSERT_EQ(&provider.cache, &irs::automaton_cache::from(&provider));
+}
+
+TEST(automaton_cache_test, wildcard) {
+  irs::automaton_cache cache(1 << 20);
+
+  auto a0 = cache.wildcard(ref("a%c"));
+  ASSERT_NE(nullptr, a0);
+  ASSERT_TRUE(a0->valid);
+  ASSERT_EQ(0, cache.hits());
+  ASSERT_EQ(1, cache.misses());
+  ASSERT_EQ(1, cache.size());
+  ASSERT_LT(a0->memory, cache.memory());
+
+  auto a1 = cache.wildcard(ref("a%c"));
+  ASSERT_EQ(a0, a1);
+  ASSERT_EQ(1, cache.hits());
+  ASSERT_EQ(1, cache.misses());
+
+  // matcher copy evaluates the cached automaton
+  auto matcher = a1->matcher;
+  ASSERT_EQ(&a1->acceptor, &matcher.GetFst());
+  ASSERT_TRUE(irs::accept<irs::byte_type>(a1->acceptor, ref("ac")));
+  ASSERT_FALSE(irs::accept<irs::byte_type>(a1->acceptor, ref("ab")));
+
+  auto a2 = cache.wildcard(ref("a_c"));
+  ASSERT_NE(a0, a2);
+  ASSERT_EQ(1, cache.hits());
+  ASSERT_EQ(2, cache.misses());
+  ASSERT_EQ(2, cache.size());
+
+  cache.clear();
+  ASSERT_EQ(0, cache.size());
+  ASSERT_EQ(0, cache.memory());
+  ASSERT_TRUE(a0->valid); // evicted automaton stays valid
+  ASSERT_TRUE(irs::accept<irs::byte_type>(a0->acceptor, ref("abc")));
+}
+
+TEST(automaton_cache_test, levenshtein) {
+  irs::automaton_cache cache(1 << 20);
+
+  const auto& d1 = irs::default_pdp(1, false);
+  const auto& d1t = irs::default_pdp(1, true);
+
+  auto a0 = cache.levenshtein(d1, ref("cat"));
+  ASSERT_TRUE(a0->valid);
+  ASSERT_TRUE(irs::accept<irs::byte_type>(a0->acceptor, ref("cut")));
+  ASSERT_FALSE(irs::accept<irs::byte_type>(a0->acceptor, ref("dog")));
+  ASSERT_EQ(a0, cache.levenshtein(d1, ref("cat")));
+
+  // parameters are the part of a key
+  ASSERT_NE(a0, cache.levenshtein(d1t, ref("cat")));
+  ASSERT_NE(a0, cache.levenshtein(d1, ref("cut")));
+
+  // same term for wildcard is a different key
+  ASSERT_NE(a0, cache.wildcard(ref("cat")));
+
+  ASSERT_EQ(1, cache.hits());
+  ASSERT_EQ(4, cache.misses());
+  ASSERT_EQ(4, cache.size());
+}
+
+TEST(automaton_cache_test, evict) {
+  irs::automaton_cache cache(1 << 20);
+
+  auto a0 = cache.wildcard(ref("a%c"));
+  const auto entry_memory = cache.memory();
+  ASSERT_LT(0, entry_memory);
+
+  // every entry below is of the same size
+  cache.max_memory(entry_memory);
+  ASSERT_EQ(1, cache.size());
+
+  auto a1 = cache.wildcard(ref("b%c"));
+  ASSERT_EQ(1, cache.size());
+  ASSERT_EQ(entry_memory, cache.memory());
+
+  // 'a%c' is evicted, 'b%c' is still cached
+  ASSERT_NE(a0, cache.wildcard(ref("a%c")));
+  ASSERT_EQ(0, cache.hits());
+  ASSERT_EQ(3, cache.misses());
+
+  // least recently used is evicted
+  cache.max_memory(2*entry_memory);
+  auto a2 = cache.wildcard(ref("b%c"));
+  ASSERT_NE(a1, a2); // evicted by 'a%c' above
+  auto a3 = cache.wildcard(ref("a%c"));
+  ASSERT_EQ(2, cache.size());
+  ASSERT_EQ(a2, cache.wildcard(ref("b%c")));
+  auto a4 = cache.wildcard(ref("d%e"));
+  ASSERT_EQ(2, cache.size());
+  ASSERT_EQ(a2, cache.wildcard(ref("b%c")));
+  ASSERT_NE(a3, cache.wildcard(ref("a%c")));
+
+  // entry larger than the limit isn't cached
+  cache.max_memory(1);
+  ASSERT_EQ(0, cache.size());
+  ASSERT_EQ(0, cache.memory());
+  ASSERT_TRUE(cache.wildcard(ref("a%c"))->valid);
+  ASSERT_EQ(0, cache.size());
+}
+
+TEST(automaton_cache_test, concurrent) {
+  constexpr size_t THREADS = 8;
+  constexpr size_t LOOKUPS = 1000;
+  const irs::string_ref patterns[] { "a%", "%b", "a_c", "%d%", "e_%" };
+
+  irs::automaton_cache cache(1 << 20);
+  std::vector<std::thread> threads;
+  std::atomic<bool> failed{false};
+
+  for (size_t i = 0; i < THREADS; ++i) {
+    threads.emplace_back([&cache, &patterns, &failed, i]() {
+      for (size_t j = 0; j < LOOKUPS; ++j) {
+        const auto& pattern = patterns[(i + j) % IRESEARCH_COUNTOF(patterns)];
+        auto a = cache.wildcard(ref(pattern));
+        auto matcher = a->matcher;
+
+        if (!a->valid || &matcher.GetFst() != &a->acceptor) {
+          failed = true;
+        }
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  ASSERT_FALSE(failed);
+  ASSERT_EQ(THREADS*LOOKUPS, cache.hits() + cache.misses());
+  ASSERT_LE(IRESEARCH_COUNTOF(patterns), cache.misses());
+  ASSERT_EQ(IRESEARCH_COUNTOF(patterns), cache.size());
+}
@@ -282,6 +282,28 @@ TEST(bitset_tests, clear_count) {
   ASSERT_FALSE(bs.all());
 }
 
+TEST(bitset_tests, intersect) {
+  const bitset::index_t size = 150;
+
+  bitset lhs(size);
+  bitset rhs(size);
+  for (size_t i = 0; i < size; ++i) {
+    lhs.reset(i, 0 == i % 2);
+    rhs.reset(i, 0 == i % 3);
+  }
+
+  lhs &= rhs;
+  ASSERT_EQ(size, lhs.size());
+  for (size_t i = 0; i < size; ++i) {
+    ASSERT_EQ(0 == i % 6, lhs.test(i));
+  }
+  ASSERT_EQ(25, lhs.count());
+
+  rhs.clear();
+  lhs &= rhs;
+  ASSERT_TRUE(lhs.none());
+}
+
 TEST(bitset_tests, memset) {
   // empty bitset
   {
@@ -0,0 +1,107 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tests_shared.hpp"
+#include "index/bkd_utils.hpp"
+
+#include <numeric>
+
+#include "store/memory_directory.hpp"
+#include "store/store_utils.hpp"
+#include "utils/bkd_tree.hpp"
+#include "utils/type_limits.hpp"
+
+TEST(bkd_tree_test, chunks) {
+  constexpr size_t MAX_POINTS = 1000;
+  constexpr irs::doc_id_t DOCS_COUNT = 3500;
+
+  auto make_x = [](irs::doc_id_t doc) { return int64_t(doc % 97) - 50; };
+  auto make_y = [](irs::doc_id_t doc) { return int64_t(doc / 7); };
+
+  irs::memory_directory dir;
+  irs::bstring index;
+
+  {
+    auto out = dir.create("points");
+    ASSERT_NE(nullptr, out);
+
+    irs::bkd_tree::writer writer(MAX_POINTS);
+    writer.prepare(*out, 2);
+    ASSERT_EQ(2, writer.dims());
+
+    for (irs::doc_id_t doc = irs::doc_limits::min(); doc <= DOCS_COUNT; ++doc) {
+      const auto point = tests::encode_point({ make_x(doc), make_y(doc) });
+      writer.push(point.c_str(), &doc, 1);
+    }
+
+    // a single point of many documents spans several chunks
+    std::vector<irs::doc_id_t> docs(2*MAX_POINTS);
+    std::iota(docs.begin(), docs.end(), DOCS_COUNT + 1);
+    const auto point = tests::encode_point({ 0, -1 });
+    writer.push(point.c_str(), docs.data(), docs.size());
+    ASSERT_EQ(5*MAX_POINTS, writer.size()); // points of flushed chunks
+
+    irs::bytes_output index_out(index);
+    writer.finish(index_out);
+    ASSERT_EQ(DOCS_COUNT + 2*MAX_POINTS, writer.size());
+  }
+
+  auto in = dir.open("points", irs::IOAdvice::NORMAL);
+  ASSERT_NE(nullptr, in);
+
+  irs::bkd_tree tree;
+  irs::bytes_ref_input index_in(index);
+  tree.read(index_in);
+  tree.reset(in.get());
+  ASSERT_TRUE(index_in.eof());
+  ASSERT_EQ(2, tree.dims());
+  ASSERT_EQ(DOCS_COUNT + 2*MAX_POINTS, tree.size());
+
+  auto count_docs = [&tree](const irs::bstring& min, const irs::bstring& max) {
+    size_t count = 0;
+    tree.visit(min, max, [&count](irs::doc_id_t) { ++count; });
+    return count;
+  };
+
+  const std::pair<int64_t, int64_t> boxes[][2] {
+    { { -50, -1 }, { 46, 500 } }, // every point
+    { { -10, 0 }, { 10, 100 } },
+    { { 0, -1 }, { 0, -1 } }, // documents of a single point only
+    { { 40, 450 }, { 46, 500 } },
+    { { 47, 0 }, { 100, 500 } } // nothing
+  };
+
+  for (auto& box : boxes) {
+    size_t expected = 0;
+    for (irs::doc_id_t doc = irs::doc_limits::min(); doc <= DOCS_COUNT; ++doc) {
+      const auto x = make_x(doc);
+      const auto y = make_y(doc);
+      expected += x >= box[0].first && x <= box[1].first
+               && y >= box[0].second && y <= box[1].second;
+    }
+    if (box[0].first <= 0 && 0 <= box[1].first
+        && box[0].second <= -1 && -1 <= box[1].second) {
+      expected += 2*MAX_POINTS;
+    }
+
+    ASSERT_EQ(expected, count_docs(tests::encode_point({ box[0].first, box[0].second }),
+                                   tests::encode_point({ box[1].first, box[1].second })));
+  }
+}
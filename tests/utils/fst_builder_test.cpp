@@ -264,6 +264,117 @@ TEST(immutable_fst_test, read_write) {
   }
 }
 
+
+TEST(immutable_fst_test, read_in_place) {
+  auto expected_data = read_fst_input(test_base::resource("fst"));
+  ASSERT_FALSE(expected_data.empty());
+
+  irs::vector_byte_fst fst;
+  fst_stats stats;
+
+  // build fst
+  {
+    fst_byte_builder builder(fst);
+    builder.reset();
+
+    for (auto& data : expected_data) {
+      builder.add(data.first, irs::byte_weight(data.second.begin(), data.second.end()));
+    }
+
+    stats = builder.finish();
+  }
+
+  irs::bstring buf;
+  {
+    irs::bytes_output out(buf);
+    irs::immutable_byte_fst::Write(fst, out, stats);
+    ASSERT_EQ(buf.size(), irs::immutable_byte_fst::WriteSize(fst, stats));
+    out.write_long(42); // trailing data
+  }
+
+  std::unique_ptr<irs::immutable_byte_fst> read_fst;
+  {
+    // stream gives access to persistent memory, weights aren't copied
+    irs::bytes_ref_input in(buf);
+    read_fst.reset(irs::immutable_byte_fst::Read(in));
+    ASSERT_NE(nullptr, read_fst);
+    ASSERT_EQ(42, in.read_long());
+    ASSERT_TRUE(in.eof());
+  }
+
+  const auto in_place = [&buf](irs::bytes_ref weight) {
+    return weight.empty()
+      || (buf.c_str() <= weight.c_str()
+          && weight.c_str() + weight.size() <= buf.c_str() + buf.size());
+  };
+
+  ASSERT_EQ(fst.NumStates(), read_fst->NumStates());
+  ASSERT_EQ(fst.Start(), read_fst->Start());
+  for (fst::StateIterator<decltype(fst)> it(fst); !it.Done(); it.Next()) {
+    const auto s = it.Value();
+    ASSERT_EQ(fst.NumArcs(s), read_fst->NumArcs(s));
+    ASSERT_EQ(static_cast<irs::bytes_ref>(fst.Final(s)),
+              static_cast<irs::bytes_ref>(read_fst->Final(s)));
+    ASSERT_TRUE(in_place(static_cast<irs::bytes_ref>(read_fst->Final(s))));
+
+    fst::ArcIterator<decltype(fst)> expected_arcs(fst, s);
+    fst::ArcIterator<irs::immutable_byte_fst> actual_arcs(*read_fst, s);
+    for (; !expected_arcs.Done(); expected_arcs.Next(), actual_arcs.Next()) {
+      auto& expected_arc = expected_arcs.Value();
+      auto& actual_arc = actual_arcs.Value();
+      ASSERT_EQ(expected_arc.ilabel, actual_arc.ilabel);
+      ASSERT_EQ(expected_arc.nextstate, actual_arc.nextstate);
+      ASSERT_EQ(static_cast<irs::bytes_ref>(expected_arc.weight),
+                static_cast<irs::bytes_ref>(actual_arc.weight));
+      ASSERT_TRUE(in_place(static_cast<irs::bytes_ref>(actual_arc.weight)));
+    }
+  }
+}
+
+TEST(immutable_fst_test, read_in_place_truncated) {
+  auto expected_data = read_fst_input(test_base::resource("fst"));
+  ASSERT_FALSE(expected_data.empty());
+
+  irs::vector_byte_fst fst;
+  fst_stats stats;
+
+  // build fst
+  {
+    fst_byte_builder builder(fst);
+    builder.reset();
+
+    for (auto& data : expected_data) {
+      builder.add(data.first, irs::byte_weight(data.second.begin(), data.second.end()));
+    }
+
+    stats = builder.finish();
+  }
+
+  irs::bstring buf;
+  {
+    irs::bytes_output out(buf);
+    irs::immutable_byte_fst::Write(fst, out, stats);
+  }
+
+  // truncation anywhere past the header is detected
+  const size_t step = std::max(size_t(1), buf.size() / 97);
+  for (size_t size = buf.size() / 2; size < buf.size(); size += step) {
+    irs::bytes_ref_input in(irs::bytes_ref(buf.c_str(), size));
+    ASSERT_THROW(irs::immutable_byte_fst::Read(in), irs::index_error);
+  }
+
+  {
+    irs::bytes_ref_input in(irs::bytes_ref(buf.c_str(), buf.size() - 1));
+    ASSERT_THROW(irs::immutable_byte_fst::Read(in), irs::index_error);
+  }
+
+  {
+    irs::bytes_ref_input in(buf);
+    std::unique_ptr<irs::immutable_byte_fst> read_fst(irs::immutable_byte_fst::Read(in));
+    ASSERT_NE(nullptr, read_fst);
+    ASSERT_EQ(fst.NumStates(), read_fst->NumStates());
+  }
+}
 }
 
 #endif // IRESEARCH_DLL
@@ -0,0 +1,134 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2026 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tests_shared.hpp"
+
+#include "utils/lru_cache.hpp"
+
+#include <memory>
+
+namespace {
+
+typedef irs::lru_cache<int, std::string, std::shared_ptr<const int>> cache_t;
+
+std::shared_ptr<const int> value(int v) {
+  return std::make_shared<const int>(v);
+}
+
+}
+
+TEST(lru_cache_test, disabled) {
+  cache_t cache(0);
+
+  ASSERT_FALSE(cache.put(0, "a", value(1), 1));
+  ASSERT_EQ(nullptr, cache.get(0, "a"));
+
+  const auto stats = cache.stats();
+  ASSERT_EQ(0, stats.size);
+  ASSERT_EQ(0, stats.weight);
+  ASSERT_EQ(0, stats.max_weight);
+  ASSERT_EQ(0, stats.hits);
+  ASSERT_EQ(1, stats.misses);
+}
+
+TEST(lru_cache_test, get_put) {
+  cache_t cache(10);
+
+  ASSERT_EQ(nullptr, cache.get(0, "a"));
+  ASSERT_TRUE(cache.put(0, "a", value(1), 2));
+  ASSERT_FALSE(cache.put(0, "a", value(2), 2)); // already cached
+  ASSERT_TRUE(cache.put(1, "a", value(3), 3)); // same key, another group
+  ASSERT_FALSE(cache.put(1, "b", value(4), 11)); // too heavy
+
+  auto v0 = cache.get(0, "a");
+  ASSERT_NE(nullptr, v0);
+  ASSERT_EQ(1, *v0);
+  auto v1 = cache.get(1, "a");
+  ASSERT_NE(nullptr, v1);
+  ASSERT_EQ(3, *v1);
+  ASSERT_EQ(nullptr, cache.get(1, "b"));
+
+  const auto stats = cache.stats();
+  ASSERT_EQ(2, stats.size);
+  ASSERT_EQ(5, stats.weight);
+  ASSERT_EQ(10, stats.max_weight);
+  ASSERT_EQ(2, stats.hits);
+  ASSERT_EQ(2, stats.misses);
+  ASSERT_EQ(stats.size, cache.size());
+  ASSERT_EQ(stats.weight, cache.weight());
+  ASSERT_EQ(stats.hits, cache.hits());
+  ASSERT_EQ(stats.misses, cache.misses());
+}
+
+TEST(lru_cache_test, evict) {
+  cache_t cache(3);
+
+  ASSERT_TRUE(cache.put(0, "a", value(1), 1));
+  ASSERT_TRUE(cache.put(0, "b", value(2), 1));
+  ASSERT_TRUE(cache.put(1, "c", value(3), 1));
+
+  // 'a' becomes the most recently used, 'b' is evicted
+  auto a = cache.get(0, "a");
+  ASSERT_NE(nullptr, a);
+  ASSERT_TRUE(cache.put(1, "d", value(4), 1));
+  ASSERT_EQ(3, cache.size());
+  ASSERT_EQ(nullptr, cache.get(0, "b"));
+  ASSERT_NE(nullptr, cache.get(1, "c"));
+
+  // heavy value evicts several ones
+  ASSERT_TRUE(cache.put(2, "e", value(5), 2));
+  ASSERT_EQ(2, cache.size());
+  ASSERT_EQ(3, cache.weight());
+  ASSERT_EQ(nullptr, cache.get(0, "a"));
+  ASSERT_EQ(1, *a); // evicted value stays valid
+
+  // shrinking the limit evicts least recently used values
+  cache.max_weight(2);
+  ASSERT_EQ(1, cache.size());
+  ASSERT_NE(nullptr, cache.get(2, "e"));
+
+  cache.clear();
+  ASSERT_EQ(0, cache.size());
+  ASSERT_EQ(0, cache.weight());
+  ASSERT_EQ(2, cache.max_weight());
+}
+
+TEST(lru_cache_test, erase_group) {
+  cache_t cache(10);
+
+  ASSERT_TRUE(cache.put(0, "a", value(1), 1));
+  ASSERT_TRUE(cache.put(1, "a", value(2), 2));
+  ASSERT_TRUE(cache.put(0, "b", value(3), 3));
+
+  cache.erase(0);
+  ASSERT_EQ(1, cache.size());
+  ASSERT_EQ(2, cache.weight());
+  ASSERT_EQ(nullptr, cache.get(0, "a"));
+  ASSERT_EQ(nullptr, cache.get(0, "b"));
+  ASSERT_NE(nullptr, cache.get(1, "a"));
+
+  cache.erase(0); // no such group
+  ASSERT_EQ(1, cache.size());
+
+  // group may be reused after eviction
+  ASSERT_TRUE(cache.put(0, "a", value(4), 1));
+  ASSERT_EQ(4, *cache.get(0, "a"));
+}
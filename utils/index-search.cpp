@@ -58,6 +58,7 @@
 #include "search/prefix_filter.hpp"
 #include "search/score.hpp"
 #include "search/term_filter.hpp"
+#include "search/top_docs.hpp"
 #include "search/wildcard_filter.hpp"
 #include "search/ngram_similarity_filter.hpp"
 #include "store/fs_directory.hpp"
@@ -99,6 +100,7 @@ const std::string SCORER_ARG = "scorer-arg";
 const std::string SCORER_ARG_FMT = "scorer-arg-format";
 const std::string DIR_TYPE = "dir-type";
 const std::string FORMAT = "format";
+const std::string PRUNE = "prune";
 
 }
 
@@ -433,6 +435,7 @@ int search(
     size_t limit,
     bool shuffle,
     bool csv,
+    bool prune,
     size_t scored_terms_limit,
     const std::string& scorer,
     const std::string& scorer_arg_format,
@@ -493,6 +496,7 @@ int search(
   std::cout << TOPN << "=" << limit << std::endl;
   std::cout << RND << "=" << shuffle << std::endl;
   std::cout << CSV << "=" << csv << std::endl;
+  std::cout << PRUNE << "=" << prune << std::endl;
   std::cout << SCORED_TERMS_LIMIT << "=" << scored_terms_limit << std::endl;
   std::cout << SCORER << "=" << scorer << std::endl;
   std::cout << SCORER_ARG_FMT << "=" << scorer_arg_format << std::endl;
@@ -573,7 +577,7 @@ int search(
 
   // indexer threads
   for (size_t i = search_threads; i; --i) {
-    thread_pool.run([&task_provider, &reader, &order, limit, &out, csv, scored_terms_limit]()->void {
+    thread_pool.run([&task_provider, &reader, &order, limit, &out, csv, prune, scored_terms_limit]()->void {
       static const std::string analyzer_name("text");
       static const std::string analyzer_args("{\"locale\":\"en\", \"stopwords\":[\"abc\", \"def\", \"ghi\"]}"); // from index-put
       auto analyzer = irs::analysis::analyzers::get(analyzer_name, irs::type<irs::text_format::json>::get(), analyzer_args);
@@ -581,6 +585,11 @@ int search(
       std::string tmpBuf;
       const timers_t building_timers("building");
       const timers_t execution_timers("execution");
+      std::unique_ptr<timers_t> top_k_execution_timers;
+
+      if (prune) {
+        top_k_execution_timers = irs::memory::make_unique<timers_t>("top-k execution");
+      }
 
       std::vector<std::pair<float_t, irs::doc_id_t>> sorted;
       sorted.reserve(limit);
@@ -666,11 +675,43 @@ int search(
 
         const auto tdiff = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - start);
 
+        // execute task once again with the library collector which lets
+        // iterators skip documents that can't get into the top, compare
+        // against full scoring above
+        size_t top_k_doc_count = 0;
+        std::chrono::milliseconds top_k_tdiff{};
+        std::vector<irs::scored_doc> top_docs;
+
+        if (prune) {
+          const auto top_k_start = std::chrono::system_clock::now();
+
+          {
+            irs::timer_utils::scoped_timer timer(*(top_k_execution_timers->stat[size_t(task->category)]));
+            irs::top_docs_collector collector(order, limit);
+
+            for (size_t i = 0, size = reader.size(); i < size; ++i) {
+              auto docs = filter->execute(reader[i], order); // query segment
+              collector.collect(i, *docs);
+            }
+
+            top_k_doc_count = collector.visited();
+            top_docs = collector.finish();
+          }
+
+          top_k_tdiff = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - top_k_start);
+        }
+
         // output task results
         {
           std::stringstream ss;
           if (csv) {
-            ss << stringCategory(task->category) << "," << task->text << "," << doc_count << "," << tdiff.count() / 1000. << "," << tdiff.count() << '\n';
+            ss << stringCategory(task->category) << "," << task->text << "," << doc_count << "," << tdiff.count() / 1000. << "," << tdiff.count();
+
+            if (prune) {
+              ss << "," << top_k_doc_count << "," << top_k_tdiff.count() / 1000. << "," << top_k_tdiff.count();
+            }
+
+            ss << '\n';
           } else {
             ss << "TASK: cat=" << stringCategory(task->category) << " q='body:" << task->text << "' hits=" << doc_count << '\n'
                 << "  " << tdiff.count() / 1000. << " msec\n"
@@ -680,6 +721,16 @@ int search(
               ss << "  doc=" << entry.second << " score=" << entry.first << '\n';
             }
 
+            if (prune) {
+              ss << "  top-k visited=" << top_k_doc_count << '\n'
+                 << "  " << top_k_tdiff.count() / 1000. << " msec\n";
+
+              for (auto& entry : top_docs) {
+                ss << "  segment=" << entry.segment << " doc=" << entry.doc
+                   << " score=" << order.get<float_t>(entry.score.c_str(), 0) << '\n';
+              }
+            }
+
             ss << '\n';
           }
 
@@ -713,6 +764,7 @@ int search(const cmdline::parser& args) {
   const size_t thrs = args.get<size_t>(THR);
   const size_t topN = args.get<size_t>(TOPN);
   const bool csv = args.exist(CSV);
+  const bool prune = args.exist(PRUNE);
   const size_t scored_terms_limit = args.get<size_t>(SCORED_TERMS_LIMIT);
   const auto scorer = args.get<std::string>(SCORER);
   const auto scorer_arg = args.exist(SCORER_ARG) ? irs::string_ref(args.get<std::string>(SCORER_ARG)) : irs::string_ref::NIL;
@@ -729,7 +781,8 @@ int search(const cmdline::parser& args) {
             << "Scorer used for ranking query results="      << scorer             << '\n'
             << "Configuration argument format for query scorer=" << scorer_arg_format << '\n'
             << "Configuration argument for query scorer="    << scorer_arg         << '\n'
-            << "Output CSV="                                 << csv                << std::endl;
+            << "Output CSV="                                 << csv                << '\n'
+            << "Compare with pruning top-k collector="       << prune              << std::endl;
 
   std::fstream in(args.get<std::string>(INPUT), std::fstream::in);
 
@@ -747,10 +800,10 @@ int search(const cmdline::parser& args) {
       return 1;
     }
 
-    return search(path, dir_type, format, in, out, maxtasks, repeat, thrs, topN, shuffle, csv, scored_terms_limit, scorer, scorer_arg_format, scorer_arg);
+    return search(path, dir_type, format, in, out, maxtasks, repeat, thrs, topN, shuffle, csv, prune, scored_terms_limit, scorer, scorer_arg_format, scorer_arg);
   }
 
-  return search(path, dir_type, format, in, std::cout, maxtasks, repeat, thrs, topN, shuffle, csv, scored_terms_limit, scorer, scorer_arg_format, scorer_arg);
+  return search(path, dir_type, format, in, std::cout, maxtasks, repeat, thrs, topN, shuffle, csv, prune, scored_terms_limit, scorer, scorer_arg_format, scorer_arg);
 }
 
 int search(int argc, char* argv[]) {
@@ -772,6 +825,7 @@ int search(int argc, char* argv[]) {
   cmdsearch.add<std::string>(SCORER_ARG_FMT, 0, "Configuration argument format for query scorer", false, "json"); // 'json' is the argument format for 'bm25'
   cmdsearch.add(RND, 0, "Shuffle tasks");
   cmdsearch.add(CSV, 0, "CSV output");
+  cmdsearch.add(PRUNE, 0, "Execute tasks once again collecting top documents with score threshold feedback");
 
   cmdsearch.parse(argc, argv);
 